@@ -145,6 +145,7 @@ typedef struct PyConfig {
     int tracemalloc;
     int perf_profiling;
     int import_time;
+    int gc_adaptive;
     int code_debug_ranges;
     int show_ref_count;
     int dump_refs;
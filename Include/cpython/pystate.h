@@ -228,6 +228,9 @@ struct _ts {
     _PyStackChunk *datastack_chunk;
     PyObject **datastack_top;
     PyObject **datastack_limit;
+
+    /* Free small blocks kept by the object allocator for this thread */
+    struct _obmalloc_thread_cache *obmalloc_cache;
     /* XXX signal handlers should also be here */
 
     /* The following fields are here to avoid allocation during init.
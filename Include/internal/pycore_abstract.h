@@ -19,6 +19,9 @@ _PyIndex_Check(PyObject *obj)
 PyObject *_PyNumber_PowerNoMod(PyObject *lhs, PyObject *rhs);
 PyObject *_PyNumber_InPlacePowerNoMod(PyObject *lhs, PyObject *rhs);
 
+// Length hint of a zip object, see Python/bltinmodule.c
+extern Py_ssize_t _PyZip_LengthHint(PyObject *zip);
+
 #ifdef __cplusplus
 }
 #endif
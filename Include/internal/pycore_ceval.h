@@ -78,6 +78,8 @@ extern int _PyIsPerfTrampolineActive(void);
 extern PyStatus _PyPerfTrampoline_AfterFork_Child(void);
 #ifdef PY_HAVE_PERF_TRAMPOLINE
 extern _PyPerf_Callbacks _Py_perfmap_callbacks;
+extern _PyPerf_Callbacks _Py_perfmap_jit_callbacks;
+extern int _PyPerfJit_CopyParentDump(void *state, pid_t parent_pid);
 #endif
 
 static inline PyObject*
@@ -58,6 +58,7 @@ struct _ceval_runtime_state {
         struct code_arena_st *code_arena;
         struct trampoline_api_st trampoline_api;
         FILE *map_file;
+        int persist_after_fork;
 #else
         int _not_used;
 #endif
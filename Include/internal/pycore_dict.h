@@ -43,6 +43,8 @@ typedef struct {
 extern bool _PyDict_IsKeyImmutable(PyObject* op, PyObject* key);
 extern PyDictKeysObject *_PyDict_NewKeysForClass(void);
 extern PyObject *_PyDict_FromKeys(PyObject *, PyObject *, PyObject *);
+extern void _PyDict_PresizeFromIterator(PyDictObject *mp, PyObject *iter,
+                                        PyObject *key);
 
 /* Gets a version number unique to the current state of the keys of dict, if possible.
  * Returns the version number, or zero if it was not possible to get a version number. */
@@ -117,9 +119,13 @@ struct _dictkeysobject {
 
     /* "PyDictKeyEntry or PyDictUnicodeEntry dk_entries[USABLE_FRACTION(DK_SIZE(dk))];" array follows:
        see the DK_ENTRIES() macro */
+
+    /* Large DICT_KEYS_UNICODE tables are followed by a "uint8_t
+       dk_tags[DK_SIZE(dk)]" array as well: see "Tagged tables" in
+       Objects/dictobject.c */
 };
 
-/* This must be no more than 250, for the prefix size to fit in one byte. */
+/* This must be no more than 245, for the prefix size to fit in one byte. */
 #define SHARED_KEYS_MAX_SIZE 30
 #define NEXT_LOG2_SHARED_KEYS_MAX_SIZE 6
 
@@ -127,7 +133,14 @@ struct _dictkeysobject {
  *
  * The PyObject *values are preceded by an array of bytes holding
  * the insertion order and size.
- * [-1] = prefix size. [-2] = used size. size[-2-n...] = insertion order.
+ * [-1] = prefix size. [-2] = used size. [-3] = capacity.
+ * size[-3-n...] = insertion order.
+ *
+ * The capacity is the number of values.  The values only have room for the
+ * keys that the shared keys had when they were allocated, and are grown when
+ * a value with a higher index is set: an instance that sets an attribute
+ * which no other instance of its type has set so far still shares the keys
+ * and keeps its values, as long as the shared keys have room.
  */
 struct _dictvalues {
     PyObject *values[1];
@@ -191,15 +204,22 @@ extern PyObject *_PyDict_FromItems(
         PyObject *const *values, Py_ssize_t values_offset,
         Py_ssize_t length);
 
+static inline size_t
+_PyDictValues_Capacity(PyDictValues *values)
+{
+    return ((uint8_t *)values)[-3];
+}
+
 static inline void
 _PyDictValues_AddToInsertionOrder(PyDictValues *values, Py_ssize_t ix)
 {
     assert(ix < SHARED_KEYS_MAX_SIZE);
+    assert((size_t)ix < _PyDictValues_Capacity(values));
     uint8_t *size_ptr = ((uint8_t *)values)-2;
     int size = *size_ptr;
-    assert(size+2 < ((uint8_t *)values)[-1]);
+    assert(size+3 < ((uint8_t *)values)[-1]);
     size++;
-    size_ptr[-size] = (uint8_t)ix;
+    size_ptr[-1-size] = (uint8_t)ix;
     *size_ptr = size;
 }
 
@@ -53,14 +53,20 @@ static inline int _PyObject_GC_MAY_BE_TRACKED(PyObject *obj) {
 #define _PyGC_PREV_SHIFT           (2)
 #define _PyGC_PREV_MASK            (((uintptr_t) -1) << _PyGC_PREV_SHIFT)
 
-// Lowest bit of _gc_next is used for flags only in GC.
-// But it is always 0 for normal code.
+/* Bit 0 of _gc_next tells which "space" of the oldest generation the object
+   is in while that generation is collected incrementally. */
+#define _PyGC_NEXT_MASK_OLD_SPACE_1    (1)
+
+// Lowest two bits of _gc_next are used for flags.  Bit 0 is the old space
+// bit above, bit 1 is used only in GC.
 static inline PyGC_Head* _PyGCHead_NEXT(PyGC_Head *gc) {
-    uintptr_t next = gc->_gc_next;
+    uintptr_t next = (gc->_gc_next & _PyGC_PREV_MASK);
     return _Py_CAST(PyGC_Head*, next);
 }
 static inline void _PyGCHead_SET_NEXT(PyGC_Head *gc, PyGC_Head *next) {
-    gc->_gc_next = _Py_CAST(uintptr_t, next);
+    uintptr_t unext = _Py_CAST(uintptr_t, next);
+    assert((unext & ~_PyGC_PREV_MASK) == 0);
+    gc->_gc_next = ((gc->_gc_next & ~_PyGC_PREV_MASK) | unext);
 }
 
 // Lowest two bits of _gc_prev is used for _PyGC_PREV_MASK_* flags.
@@ -144,6 +150,9 @@ struct gc_generation {
                   generations */
 };
 
+/* Number of buckets of the histograms in gc_generation_stats */
+#define GC_HISTOGRAM_SIZE 32
+
 /* Running stats per generation */
 struct gc_generation_stats {
     /* total number of collections */
@@ -152,6 +161,41 @@ struct gc_generation_stats {
     Py_ssize_t collected;
     /* total number of uncollectable objects (put into gc.garbage) */
     Py_ssize_t uncollectable;
+    /* total time spent collecting */
+    _PyTime_t duration;
+    /* total number of objects visited while looking for unreachable ones,
+       and its parts visited by the steps of the search: initializing the
+       gc_refs, subtracting the internal references, and moving the
+       unreachable objects (or marking the reachable ones in parallel) */
+    Py_ssize_t visited;
+    Py_ssize_t visited_update_refs;
+    Py_ssize_t visited_subtract_refs;
+    Py_ssize_t visited_move_unreachable;
+    /* total number of reachable objects found by the collections */
+    Py_ssize_t survived;
+    /* total time spent clearing weak references and calling their callbacks */
+    _PyTime_t weakrefs_duration;
+    /* total time spent calling finalizers */
+    _PyTime_t finalize_duration;
+    /* number of collections by duration in microseconds and by number of
+       visited objects; a value v is counted in the bucket whose index is
+       the bit length of v, the last bucket also counting larger values */
+    Py_ssize_t duration_histogram[GC_HISTOGRAM_SIZE];
+    Py_ssize_t visited_histogram[GC_HISTOGRAM_SIZE];
+};
+
+/* Number of increments whose pause is kept in gc_increment_stats */
+#define GC_INCREMENT_HISTORY 64
+
+/* Running stats of the incremental collection of the oldest generation */
+struct gc_increment_stats {
+    /* total number of increments */
+    Py_ssize_t increments;
+    /* longest pause of an increment */
+    _PyTime_t max_pause;
+    /* pauses of the last increments, indexed by increments modulo
+       GC_INCREMENT_HISTORY */
+    _PyTime_t pauses[GC_INCREMENT_HISTORY];
 };
 
 struct _gc_runtime_state {
@@ -169,6 +213,9 @@ struct _gc_runtime_state {
     PyGC_Head *generation0;
     /* a permanent generation which won't be collected */
     struct gc_generation permanent_generation;
+    /* Number of objects that gc.freeze() made immortal and removed from
+       the collector's lists */
+    Py_ssize_t immortalized;
     struct gc_generation_stats generation_stats[NUM_GENERATIONS];
     /* true if we are currently running the collector */
     int collecting;
@@ -187,6 +234,39 @@ struct _gc_runtime_state {
        collections, and are awaiting to undergo a full collection for
        the first time. */
     Py_ssize_t long_lived_pending;
+
+    /* Target pause of an increment of the oldest generation, or 0 if the
+       oldest generation is collected all at once. */
+    _PyTime_t incremental_budget;
+    /* Phase of the current incremental collection (GC_PHASE_*) */
+    int incremental_phase;
+    /* Old space bit of the objects of the oldest generation that the
+       current incremental collection has already visited.  The objects
+       it has still to visit are at the front of the generation list. */
+    int visited_space;
+    /* Number of objects an increment can examine within the budget */
+    Py_ssize_t increment_work;
+    /* Number of objects that survived the increments of the current
+       incremental collection */
+    Py_ssize_t increment_survivors;
+    /* Objects reachable from the roots of the interpreter that remain to
+       be traversed while marking.  They are out of the generation lists
+       until then, and leave this list when they are untracked. */
+    PyGC_Head mark_pending;
+    struct gc_increment_stats increment_stats;
+    /* Number of threads marking the reachable objects in full collections */
+    int mark_threads;
+    /* Helper threads of the parallel marking, started by the first
+       collection which uses them */
+    struct gc_mark_shared *mark_pool;
+    /* Whether the thresholds of the young generations adapt to the survival
+       rate and the cost of their collections (PyConfig.gc_adaptive) */
+    int adaptive;
+    /* Thresholds set by gc.set_threshold(), below which the adapted
+       thresholds never go */
+    int base_thresholds[NUM_GENERATIONS];
+    /* End of the last collection of each generation */
+    _PyTime_t last_collection_end[NUM_GENERATIONS];
 };
 
 
@@ -200,6 +280,7 @@ extern void _PyTuple_ClearFreeList(PyInterpreterState *interp);
 extern void _PyFloat_ClearFreeList(PyInterpreterState *interp);
 extern void _PyList_ClearFreeList(PyInterpreterState *interp);
 extern void _PyDict_ClearFreeList(PyInterpreterState *interp);
+extern void _PyGen_ClearFreeList(PyInterpreterState *interp);
 extern void _PyAsyncGen_ClearFreeLists(PyInterpreterState *interp);
 extern void _PyContext_ClearFreeList(PyInterpreterState *interp);
 extern void _Py_ScheduleGC(PyInterpreterState *interp);
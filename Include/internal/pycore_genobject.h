@@ -14,6 +14,7 @@ extern PyObject *_PyAsyncGenValueWrapperNew(PyThreadState *state, PyObject *);
 
 /* runtime lifecycle */
 
+extern void _PyGen_Fini(PyInterpreterState *);
 extern void _PyAsyncGen_Fini(PyInterpreterState *);
 
 
@@ -21,9 +22,32 @@ extern void _PyAsyncGen_Fini(PyInterpreterState *);
 
 #ifndef WITH_FREELISTS
 // without freelists
+#  define _PyGen_MAXFREELIST 0
 #  define _PyAsyncGen_MAXFREELIST 0
 #endif
 
+#ifndef _PyGen_MAXFREELIST
+#  define _PyGen_MAXFREELIST 16
+#endif
+
+/* Generator, coroutine and async generator objects embed their frame, so
+   their size depends on co_framesize.  Frames are rounded up to a multiple
+   of _PyGen_FREELIST_QUANTUM slots and each multiple gets its own freelist;
+   frames needing more than the largest size class bypass the freelists. */
+#define _PyGen_FREELIST_QUANTUM 4
+#define _PyGen_FREELIST_NCLASSES 32
+
+struct _Py_gen_state {
+#if _PyGen_MAXFREELIST > 0
+    /* free_list[i] is a singly-linked list of objects with room for
+       i * _PyGen_FREELIST_QUANTUM frame slots, linked via abuse of
+       their ob_type members.  All three generator types share the
+       same layout, so the lists are shared between them too. */
+    PyGenObject *free_list[_PyGen_FREELIST_NCLASSES];
+    int numfree[_PyGen_FREELIST_NCLASSES];
+#endif
+};
+
 #ifndef _PyAsyncGen_MAXFREELIST
 #  define _PyAsyncGen_MAXFREELIST 80
 #endif
@@ -42,6 +66,8 @@ struct _Py_async_gen_state {
 #endif
 };
 
+PyAPI_FUNC(void) _PyGen_DebugMallocStats(FILE *out);
+
 
 #ifdef __cplusplus
 }
@@ -61,8 +61,35 @@ typedef uint32_t _PyMonitoringEventSet;
 #define PY_MONITORING_SYS_TRACE_ID 7
 
 
+/* Native consumers of events.
+ * A tool can have LINE, INSTRUCTION, JUMP and BRANCH events appended to a
+ * buffer and drained in bulk, and can record the lines it sees without
+ * calling into Python, instead of having a callback called per event. */
+
+typedef struct {
+    PyCodeObject *code;
+    int offset;   /* In bytes */
+    int event;
+    int arg;      /* Line number for LINE, destination offset for JUMP and BRANCH */
+} _PyMonitoringBufferEntry;
+
+typedef struct _PyMonitoringConsumer {
+    /* Ring buffer of events, or NULL */
+    _PyMonitoringBufferEntry *buffer;
+    Py_ssize_t size;
+    Py_ssize_t start;
+    Py_ssize_t length;
+    /* Called with the list of buffered events when the buffer is full,
+       or NULL to overwrite the oldest events */
+    PyObject *flush;
+    /* dict: code object -> set of the line numbers executed, or NULL */
+    PyObject *lines;
+} _PyMonitoringConsumer;
+
 PyObject *_PyMonitoring_RegisterCallback(int tool_id, int event_id, PyObject *obj);
 
+extern void _PyMonitoring_ClearConsumer(PyInterpreterState *interp, int tool_id);
+
 int _PyMonitoring_SetEvents(int tool_id, _PyMonitoringEventSet events);
 
 extern int
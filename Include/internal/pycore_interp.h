@@ -21,7 +21,7 @@ extern "C" {
 #include "pycore_exceptions.h"    // struct _Py_exc_state
 #include "pycore_floatobject.h"   // struct _Py_float_state
 #include "pycore_function.h"      // FUNC_MAX_WATCHERS
-#include "pycore_genobject.h"     // struct _Py_async_gen_state
+#include "pycore_genobject.h"     // struct _Py_gen_state
 #include "pycore_gc.h"            // struct _gc_runtime_state
 #include "pycore_global_objects.h"  // struct _Py_interp_static_objects
 #include "pycore_import.h"        // struct _import_state
@@ -173,6 +173,7 @@ struct _is {
     struct _Py_tuple_state tuple;
     struct _Py_list_state list;
     struct _Py_dict_state dict_state;
+    struct _Py_gen_state gen;
     struct _Py_async_gen_state async_gen;
     struct _Py_context_state context;
     struct _Py_exc_state exc_state;
@@ -190,6 +191,9 @@ struct _is {
     Py_ssize_t sys_tracing_threads; /* Count of threads with c_tracefunc set */
     PyObject *monitoring_callables[PY_MONITORING_TOOL_IDS][_PY_MONITORING_EVENTS];
     PyObject *monitoring_tool_names[PY_MONITORING_TOOL_IDS];
+    struct _PyMonitoringConsumer *monitoring_consumers[PY_MONITORING_TOOL_IDS];
+    uint8_t monitoring_buffered_tools;    /* Tools with an event buffer */
+    uint8_t monitoring_recording_tools;   /* Tools recording lines */
 
     struct _Py_interp_cached_objects cached_objects;
     struct _Py_interp_static_objects static_objects;
@@ -33,8 +33,13 @@ struct _Py_list_state {
     PyListObject *free_list[PyList_MAXFREELIST];
     int numfree;
 #endif
+    /* Number of threads sorting large lists of ints, floats or strs */
+    int sort_threads;
 };
 
+/* Maximum number of threads set by sys._set_sort_threads() */
+#define _PyList_MAX_SORT_THREADS 64
+
 #define _PyList_ITEMS(op) _Py_RVALUE(_PyList_CAST(op)->ob_item)
 
 extern int
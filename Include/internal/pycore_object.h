@@ -15,6 +15,12 @@ extern "C" {
 #include "pycore_runtime.h"       // _PyRuntime
 #include "pycore_regions.h"      // _Py_DEFAULT_REGION
 
+#ifdef _Py_REGION_FIELD
+#  define _PyObject_REGION_INIT_FIELD .ob_region = _Py_DEFAULT_REGION
+#else
+#  define _PyObject_REGION_INIT_FIELD
+#endif
+
 /* We need to maintain an internal copy of Py{Var}Object_HEAD_INIT to avoid
    designated initializer conflicts in C++20. If we use the deinition in
    object.h, we will be mixing designated and non-designated initializers in
@@ -28,7 +34,7 @@ extern "C" {
         _PyObject_EXTRA_INIT              \
         .ob_refcnt = _Py_IMMORTAL_REFCNT, \
         .ob_type = (type),                \
-        .ob_region = _Py_DEFAULT_REGION   \
+        _PyObject_REGION_INIT_FIELD       \
     },
 #define _PyVarObject_HEAD_INIT(type, size)    \
     {                                         \
@@ -72,7 +78,8 @@ static inline void _Py_RefcntAdd(PyObject* op, Py_ssize_t n)
 
 static inline void _Py_SetImmortal(PyObject *op)
 {
-    if (op) {
+    // Immutable objects are already immortal
+    if (op && !_Py_IsImmutable(op)) {
         op->ob_refcnt = _Py_IMMORTAL_REFCNT;
     }
 }
@@ -82,7 +89,7 @@ static inline void _Py_SetImmortal(PyObject *op)
 static inline void _Py_ClearImmortal(PyObject *op)
 {
     if (op) {
-        assert(op->ob_refcnt == _Py_IMMORTAL_REFCNT);
+        assert(_Py_IsImmortal(op));
         op->ob_refcnt = 1;
         Py_DECREF(op);
     }
@@ -96,10 +103,12 @@ static inline void _Py_ClearImmortal(PyObject *op)
 static inline void _Py_SetImmutable(PyObject *op)
 {
     if(op) {
+#ifdef _Py_REGION_FIELD
         op->ob_region = _Py_IMMUTABLE;
+#endif
         // TODO once reference counting across regions is fully working
         // we no longer need to make all immutable objects immortal
-        op->ob_refcnt = _Py_IMMORTAL_REFCNT;
+        op->ob_refcnt = _Py_IMMUTABLE_REFCNT;
     }
 }
 #define _Py_SetImmutable(op) _Py_SetImmutable(_PyObject_CAST(op))
@@ -177,7 +186,9 @@ _PyObject_Init(PyObject *op, PyTypeObject *typeobj)
 {
     assert(op != NULL);
     Py_SET_TYPE(op, typeobj);
+#ifdef _Py_REGION_FIELD
     Py_SET_REGION(op, _Py_DEFAULT_REGION);
+#endif
     if (_PyType_HasFeature(typeobj, Py_TPFLAGS_HEAPTYPE)) {
         Py_INCREF(typeobj);
     }
@@ -288,6 +288,11 @@ struct arena_object {
     /* Singly-linked list of available pools. */
     struct pool_header* freepools;
 
+    /* The number of pools in freepools that have been used since their
+     * pages were last given back to the OS.
+     */
+    uint ndirtypools;
+
     /* Whenever this arena_object is not associated with an allocated
      * arena, the nextarena member is used to link all unassociated
      * arena_objects in the singly-linked `unused_arena_objects` list.
@@ -500,6 +505,8 @@ struct _obmalloc_mgmt {
     size_t ntimes_arena_allocated;
     /* High water mark (max value ever seen) for narenas_currently_allocated. */
     size_t narenas_highwater;
+    /* Number of times the pages of a free pool were given back to the OS. */
+    size_t npools_purged;
 
     Py_ssize_t raw_allocated_blocks;
 };
@@ -657,8 +664,67 @@ struct _obmalloc_usage {
 #endif /* WITH_PYMALLOC_RADIX_TREE */
 
 
+/*==========================================================================*/
+/* Per-thread caches of free blocks.
+ *
+ * Each thread state keeps the small blocks its thread frees, up to
+ * OBMALLOC_CACHE_BLOCKS per size class, and its next allocations of the same
+ * size class are served from them without touching the pools.  A thread
+ * thus reuses the blocks it touched last, and the pools, shared by all the
+ * threads of the interpreter, are only used when its cache is empty or full.
+ * The cached blocks are still allocated as far as their pools know; they go
+ * back to them when the thread state is cleared.
+ */
+#define OBMALLOC_CACHE_BLOCKS 32
+
+struct _obmalloc_thread_cache {
+    /* The allocator state the blocks belong to */
+    struct _obmalloc_state *state;
+    /* Free blocks by size class, singly linked through their first word */
+    pymem_block *blocks[NB_SMALL_SIZE_CLASSES];
+    uint nblocks[NB_SMALL_SIZE_CLASSES];
+    /* Allocations served from the cache, and not */
+    size_t hits;
+    size_t misses;
+};
+
+struct _obmalloc_cache_stats {
+    /* Number of blocks in the caches of the threads */
+    Py_ssize_t cached_blocks;
+    /* Counters of the caches of the threads that are gone */
+    size_t hits;
+    size_t misses;
+};
+
+
+/*==========================================================================*/
+/* Sampling census of the object allocations.
+ *
+ * While it runs, about one object allocation in `interval` is sampled.  The
+ * census counts the sampled objects by type and pymalloc size class, and the
+ * deallocations of the sampled objects with their lifetimes, measured in
+ * number of object allocations.  See sys._start_alloc_census().
+ */
+struct _obmalloc_census {
+    int enabled;
+    Py_ssize_t interval;
+    /* Allocations left before the next sample */
+    Py_ssize_t countdown;
+    uint64_t rng;
+    /* Number of object allocations since the census started */
+    uint64_t clock;
+    /* type -> the statistics of its objects by size class */
+    struct _Py_hashtable_t *types;
+    /* sampled object still alive -> its sample */
+    struct _Py_hashtable_t *samples;
+};
+
+
 struct _obmalloc_global_state {
     int dump_debug_stats;
+    int arena_hugepages;
+    /* Number of allocator states with a running census */
+    int census_active;
     Py_ssize_t interpreter_leaks;
 };
 
@@ -666,6 +732,8 @@ struct _obmalloc_state {
     struct _obmalloc_pools pools;
     struct _obmalloc_mgmt mgmt;
     struct _obmalloc_usage usage;
+    struct _obmalloc_cache_stats cache;
+    struct _obmalloc_census census;
 };
 
 
@@ -685,6 +753,17 @@ extern Py_ssize_t _Py_GetGlobalAllocatedBlocks(void);
 extern Py_ssize_t _PyInterpreterState_GetAllocatedBlocks(PyInterpreterState *);
 extern void _PyInterpreterState_FinalizeAllocatedBlocks(PyInterpreterState *);
 
+/* Give the blocks in the cache of a thread state back to their pools */
+extern void _PyObject_ClearThreadCache(PyThreadState *tstate);
+
+/* The census of the object allocations of the current interpreter */
+extern int _PyObject_StartAllocCensus(Py_ssize_t interval);
+extern void _PyObject_StopAllocCensus(void);
+extern PyObject* _PyObject_GetAllocCensus(void);
+extern void _PyObject_ClearAllocCensus(PyInterpreterState *);
+extern void _PyObject_AllocCensusNewReference(PyObject *);
+extern void _PyObject_AllocCensusDealloc(PyObject *);
+
 
 #ifdef WITH_PYMALLOC
 // Export the symbol for the 3rd party guppy3 project
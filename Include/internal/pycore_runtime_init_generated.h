@@ -968,6 +968,7 @@ extern "C" {
     INIT_ID(ident), \
     INIT_ID(ignore), \
     INIT_ID(imag), \
+    INIT_ID(immortalize), \
     INIT_ID(importlib), \
     INIT_ID(in_fd), \
     INIT_ID(incoming), \
@@ -986,6 +987,7 @@ extern "C" {
     INIT_ID(instructions), \
     INIT_ID(intern), \
     INIT_ID(intersection), \
+    INIT_ID(interval), \
     INIT_ID(is_running), \
     INIT_ID(isatty), \
     INIT_ID(isinstance), \
@@ -1151,6 +1153,7 @@ extern "C" {
     INIT_ID(reversed), \
     INIT_ID(s), \
     INIT_ID(salt), \
+    INIT_ID(sampling_interval), \
     INIT_ID(sched_priority), \
     INIT_ID(scheduler), \
     INIT_ID(seek), \
@@ -31,6 +31,11 @@ struct _PyTraceMalloc_Config {
     /* limit of the number of frames in a traceback, 1 by default.
        Variable protected by the GIL. */
     int max_nframe;
+
+    /* Mean number of bytes allocated between two traced memory blocks,
+       or 0 to trace all memory blocks.
+       Variable protected by the GIL. */
+    size_t sampling_interval;
 };
 
 
@@ -103,6 +108,19 @@ struct _tracemalloc_runtime_state {
 
     struct tracemalloc_traceback empty_traceback;
 
+    /* Number of bytes left to allocate before the next memory block is
+       traced, if sampling_interval is non-zero.
+       Protected by the GIL. */
+    size_t bytes_until_sample;
+    /* State of the random number generator drawing sampling intervals.
+       Protected by the GIL. */
+    uint64_t sampling_rng;
+    /* Counting filter of the addresses of the traced memory blocks of the
+       default domain, used to skip untraced blocks cheaply when they are
+       freed, or NULL if sampling_interval is 0.
+       Modified with TABLES_LOCK() held. */
+    uint8_t *sampled_filter;
+
     Py_tss_t reentrant_key;
 };
 
@@ -112,6 +130,7 @@ struct _tracemalloc_runtime_state {
             .initialized = TRACEMALLOC_NOT_INITIALIZED, \
             .tracing = 0, \
             .max_nframe = 1, \
+            .sampling_interval = 0, \
         }, \
         .reentrant_key = Py_tss_NEEDS_INIT, \
     }
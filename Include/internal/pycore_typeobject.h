@@ -119,6 +119,9 @@ extern PyObject * _PyType_GetBases(PyTypeObject *type);
 extern PyObject * _PyType_GetMRO(PyTypeObject *type);
 extern PyObject* _PyType_GetSubclasses(PyTypeObject *);
 extern int _PyType_HasSubclasses(PyTypeObject *);
+/* Whether tp_traverse and tp_is_gc of the instances of the type are the
+   ones of the static builtin types, or of Python subclasses of them */
+extern int _PyType_HasBuiltinTraverse(PyTypeObject *);
 
 // PyType_Ready() must be called if _PyType_IsReady() is false.
 // See also the Py_TPFLAGS_READY flag.
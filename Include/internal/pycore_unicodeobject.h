@@ -63,6 +63,8 @@ struct _Py_unicode_state {
 extern void _PyUnicode_InternInPlace(PyInterpreterState *interp, PyObject **p);
 extern void _PyUnicode_ClearInterned(PyInterpreterState *interp);
 
+extern int _PyUnicode_AppendNoClear(PyObject **p_left, PyObject *right);
+
 
 #ifdef __cplusplus
 }
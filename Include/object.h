@@ -128,6 +128,25 @@ check by comparing the reference count field to the immortality reference count.
 #define _Py_DEFAULT_REGION ((Py_uintptr_t)0)
 #define _Py_IMMUTABLE ((Py_uintptr_t)1)
 
+/*
+VeronaPy: Objects have an ob_region field to store the region they are in if
+Python is configured --with-regions, and on 32-bit systems.
+
+Otherwise the only region state is immutability, and as immutable objects are
+immortal, it is stored in the upper half of their reference count, which is
+unused: the reference count of an immutable object is _Py_IMMUTABLE_REFCNT.
+Objects thus need no extra field.
+*/
+#if defined(Py_REGIONS) || SIZEOF_VOID_P <= 4
+#  define _Py_REGION_FIELD
+#  define _Py_IMMUTABLE_REFCNT _Py_IMMORTAL_REFCNT
+#  define _PyObject_REGION_INIT(region) , (region)
+#else
+#  define _Py_IMMUTABLE_REFCNT \
+    ((Py_ssize_t)_Py_IMMORTAL_REFCNT | ((Py_ssize_t)1 << 32))
+#  define _PyObject_REGION_INIT(region)
+#endif
+
 // Make all internal uses of PyObject_HEAD_INIT immortal while preserving the
 // C-API expectation that the refcnt will be set to 1.
 #ifdef Py_BUILD_CORE
@@ -135,16 +154,16 @@ check by comparing the reference count field to the immortality reference count.
     {                               \
         _PyObject_EXTRA_INIT        \
         { _Py_IMMORTAL_REFCNT },    \
-        (type),                     \
-        _Py_DEFAULT_REGION          \
+        (type)                      \
+        _PyObject_REGION_INIT(_Py_DEFAULT_REGION) \
     },
 #else
 #define PyObject_HEAD_INIT(type) \
     {                            \
         _PyObject_EXTRA_INIT     \
         { 1 },                   \
-        (type),                  \
-        _Py_DEFAULT_REGION       \
+        (type)                   \
+        _PyObject_REGION_INIT(_Py_DEFAULT_REGION) \
     },
 #endif /* Py_BUILD_CORE */
 
@@ -193,9 +212,11 @@ struct _object {
 #endif
 
     PyTypeObject *ob_type;
+#ifdef _Py_REGION_FIELD
     // VeronaPy: Field used for tracking which region this objects is stored in.
     // Bottom bits stolen for distinguishing types of region ptr.
     Py_uintptr_t ob_region;
+#endif
 };
 
 /* Cast argument to PyObject* type. */
@@ -216,6 +237,11 @@ PyAPI_FUNC(int) Py_Is(PyObject *x, PyObject *y);
 
 
 static inline Py_ssize_t Py_REFCNT(PyObject *ob) {
+#ifndef _Py_REGION_FIELD
+    if (ob->ob_refcnt == _Py_IMMUTABLE_REFCNT) {
+        return _Py_IMMORTAL_REFCNT;
+    }
+#endif
     return ob->ob_refcnt;
 }
 #if !defined(Py_LIMITED_API) || Py_LIMITED_API+0 < 0x030b0000
@@ -232,7 +258,12 @@ static inline PyTypeObject* Py_TYPE(PyObject *ob) {
 #endif
 
 static inline Py_uintptr_t Py_REGION(PyObject *ob) {
+#ifdef _Py_REGION_FIELD
     return ob->ob_region;
+#else
+    return (ob->ob_refcnt == _Py_IMMUTABLE_REFCNT
+            ? _Py_IMMUTABLE : _Py_DEFAULT_REGION);
+#endif
 }
 #if !defined(Py_LIMITED_API) || Py_LIMITED_API+0 < 0x030b0000
 #  define Py_REGION(ob) Py_REGION(_PyObject_CAST(ob))
@@ -271,7 +302,11 @@ static inline int Py_IS_TYPE(PyObject *ob, PyTypeObject *type) {
 
 static inline Py_ALWAYS_INLINE int _Py_IsImmutable(PyObject *op)
 {
+#ifdef _Py_REGION_FIELD
     return op->ob_region == _Py_IMMUTABLE;
+#else
+    return op->ob_refcnt == _Py_IMMUTABLE_REFCNT;
+#endif
 }
 #define _Py_IsImmutable(op) _Py_IsImmutable(_PyObject_CAST(op))
 
@@ -308,7 +343,16 @@ static inline void Py_SET_SIZE(PyVarObject *ob, Py_ssize_t size) {
 #endif
 
 static inline void Py_SET_REGION(PyObject *ob, Py_uintptr_t region) {
+#ifdef _Py_REGION_FIELD
     ob->ob_region = region;
+#else
+    if (region == _Py_IMMUTABLE) {
+        ob->ob_refcnt = _Py_IMMUTABLE_REFCNT;
+    }
+    else if (ob->ob_refcnt == _Py_IMMUTABLE_REFCNT) {
+        ob->ob_refcnt = _Py_IMMORTAL_REFCNT;
+    }
+#endif
 }
 #if !defined(Py_LIMITED_API) || Py_LIMITED_API+0 < 0x030b0000
 #  define Py_SET_REGION(ob, region) Py_SET_REGION(_PyObject_CAST(ob), (region))
@@ -40,6 +40,8 @@ PyAPI_FUNC(int) PyUnstable_PerfMapState_Init(void);
 PyAPI_FUNC(int) PyUnstable_WritePerfMapEntry(const void *code_addr, unsigned int code_size, const char *entry_name);
 
 PyAPI_FUNC(void) PyUnstable_PerfMapState_Fini(void);
+
+PyAPI_FUNC(int) PyUnstable_CopyPerfMapFile(const char *parent_filename);
 #endif
 
 #ifndef Py_LIMITED_API
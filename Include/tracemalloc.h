@@ -52,12 +52,20 @@ PyAPI_FUNC(int) _PyTraceMalloc_Init(void);
 /* Start tracemalloc */
 PyAPI_FUNC(int) _PyTraceMalloc_Start(int max_nframe);
 
+/* Start tracemalloc, tracing one memory block every sampling_interval bytes
+   allocated on average, or all memory blocks if sampling_interval is 0 */
+PyAPI_FUNC(int) _PyTraceMalloc_StartSampling(int max_nframe,
+                                             size_t sampling_interval);
+
 /* Stop tracemalloc */
 PyAPI_FUNC(void) _PyTraceMalloc_Stop(void);
 
 /* Get the tracemalloc traceback limit */
 PyAPI_FUNC(int) _PyTraceMalloc_GetTracebackLimit(void);
 
+/* Get the tracemalloc sampling interval in bytes, 0 if not sampling */
+PyAPI_FUNC(size_t) _PyTraceMalloc_GetSamplingInterval(void);
+
 /* Get the memory usage of tracemalloc in bytes */
 PyAPI_FUNC(size_t) _PyTraceMalloc_GetMemory(void);
 
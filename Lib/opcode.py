@@ -344,6 +344,7 @@ def pseudo_op(name, op, real_ops):
         "BINARY_OP_ADD_INT",
         "BINARY_OP_ADD_UNICODE",
         "BINARY_OP_INPLACE_ADD_UNICODE",
+        "BINARY_OP_INPLACE_ADD_UNICODE_STORE",
         "BINARY_OP_MULTIPLY_FLOAT",
         "BINARY_OP_MULTIPLY_INT",
         "BINARY_OP_SUBTRACT_FLOAT",
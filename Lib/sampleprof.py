@@ -0,0 +1,221 @@
+#! /usr/bin/env python3
+
+"""Python interface for the '_sampleprof' statistical profiler.
+   Compatible with the 'profile' module.
+"""
+
+__all__ = ["run", "runctx", "Profile"]
+
+import _sampleprof
+import importlib.machinery
+import io
+import profile as _pyprofile
+
+# ____________________________________________________________
+# Simple interface
+
+def run(statement, filename=None, sort=-1):
+    return _pyprofile._Utils(Profile).run(statement, filename, sort)
+
+def runctx(statement, globals, locals, filename=None, sort=-1):
+    return _pyprofile._Utils(Profile).runctx(statement, globals, locals,
+                                             filename, sort)
+
+run.__doc__ = _pyprofile.run.__doc__
+runctx.__doc__ = _pyprofile.runctx.__doc__
+
+# ____________________________________________________________
+
+class Profile(_sampleprof.Sampler):
+    """Profile(interval=0.01, max_depth=128, all_threads=True)
+
+    Builds a profiler that records the stacks of the running threads
+    every interval seconds, instead of timing every call.  The time
+    reported for a function is the number of samples in which it was
+    running (tottime) or on the stack (cumtime), multiplied by the
+    interval; the call counts are sample counts too.
+    """
+
+    # Most of the functionality is in the base class.
+    # This subclass only adds methods compatible with cProfile.Profile.
+
+    def enable(self):
+        self.start()
+
+    def disable(self):
+        self.stop()
+
+    def print_stats(self, sort=-1):
+        import pstats
+        pstats.Stats(self).strip_dirs().sort_stats(sort).print_stats()
+
+    def dump_stats(self, file):
+        import marshal
+        with open(file, 'wb') as f:
+            self.create_stats()
+            marshal.dump(self.stats, f)
+
+    def create_stats(self):
+        self.disable()
+        self.snapshot_stats()
+
+    def snapshot_stats(self):
+        interval = self.interval
+        selfcounts = {}
+        totalcounts = {}
+        callercounts = {}
+        for stack, count in self.get_stacks().items():
+            funcs = [label(code) for code, lineno in stack]
+            leaf = funcs[-1]
+            selfcounts[leaf] = selfcounts.get(leaf, 0) + count
+            # Recursive functions are only counted once per sample.
+            for func in set(funcs):
+                totalcounts[func] = totalcounts.get(func, 0) + count
+            for edge in set(zip(funcs, funcs[1:])):
+                callercounts[edge] = callercounts.get(edge, 0) + count
+        self.stats = {}
+        for func, total in totalcounts.items():
+            tt = selfcounts.get(func, 0) * interval
+            self.stats[func] = total, total, tt, total * interval, {}
+        for (caller, callee), count in callercounts.items():
+            t = count * interval
+            self.stats[callee][4][caller] = count, count, t, t
+
+    def folded(self):
+        """Return the samples in the "folded" format of flame graph tools.
+
+        Every line is a stack, from its outermost frame to the frame that
+        was running, with frames separated by semicolons, followed by the
+        number of times it was sampled.
+        """
+        lines = []
+        for stack, count in self.get_stacks().items():
+            frames = ';'.join(f'{code.co_qualname} ({code.co_filename}:{lineno})'
+                              for code, lineno in stack)
+            lines.append(f'{frames} {count}\n')
+        lines.sort()
+        return ''.join(lines)
+
+    def write_folded(self, file):
+        with open(file, 'w', encoding='utf-8') as f:
+            f.write(self.folded())
+
+    # The following two methods can be called by clients to use
+    # a profiler to profile a statement, given as a string.
+
+    def run(self, cmd):
+        import __main__
+        dict = __main__.__dict__
+        return self.runctx(cmd, dict, dict)
+
+    def runctx(self, cmd, globals, locals):
+        self.enable()
+        try:
+            exec(cmd, globals, locals)
+        finally:
+            self.disable()
+        return self
+
+    # This method is more useful to profile a single function call.
+    def runcall(self, func, /, *args, **kw):
+        self.enable()
+        try:
+            return func(*args, **kw)
+        finally:
+            self.disable()
+
+    def __enter__(self):
+        self.enable()
+        return self
+
+    def __exit__(self, *exc_info):
+        self.disable()
+
+# ____________________________________________________________
+
+def label(code):
+    return (code.co_filename, code.co_firstlineno, code.co_name)
+
+# ____________________________________________________________
+
+def main():
+    import os
+    import sys
+    import runpy
+    import pstats
+    from optparse import OptionParser
+    usage = ("sampleprof.py [-i interval] [-o output_file_path | -f folded_file_path] "
+             "[-s sort] [-m module | scriptfile] [arg] ...")
+    parser = OptionParser(usage=usage)
+    parser.allow_interspersed_args = False
+    parser.add_option('-i', '--interval', dest="interval", type="float",
+        help="Time between samples, in seconds", default=0.01)
+    parser.add_option('-o', '--outfile', dest="outfile",
+        help="Save stats to <outfile>", default=None)
+    parser.add_option('-f', '--folded', dest="folded",
+        help="Save the stacks to <folded> for flame graph tools", default=None)
+    parser.add_option('-s', '--sort', dest="sort",
+        help="Sort order when printing to stdout, based on pstats.Stats class",
+        default=2,
+        choices=sorted(pstats.Stats.sort_arg_dict_default))
+    parser.add_option('-m', dest="module", action="store_true",
+        help="Profile a library module", default=False)
+
+    if not sys.argv[1:]:
+        parser.print_usage()
+        sys.exit(2)
+
+    (options, args) = parser.parse_args()
+    sys.argv[:] = args
+
+    # The script that we're profiling may chdir, so capture the absolute path
+    # to the output files at startup.
+    if options.outfile is not None:
+        options.outfile = os.path.abspath(options.outfile)
+    if options.folded is not None:
+        options.folded = os.path.abspath(options.folded)
+
+    if len(args) > 0:
+        if options.module:
+            code = "run_module(modname, run_name='__main__')"
+            globs = {
+                'run_module': runpy.run_module,
+                'modname': args[0]
+            }
+        else:
+            progname = args[0]
+            sys.path.insert(0, os.path.dirname(progname))
+            with io.open_code(progname) as fp:
+                code = compile(fp.read(), progname, 'exec')
+            spec = importlib.machinery.ModuleSpec(name='__main__', loader=None,
+                                                  origin=progname)
+            globs = {
+                '__spec__': spec,
+                '__file__': spec.origin,
+                '__name__': spec.name,
+                '__package__': None,
+                '__cached__': None,
+            }
+        prof = Profile(interval=options.interval)
+        try:
+            prof.runctx(code, globs, None)
+        except SystemExit:
+            pass
+        try:
+            if options.folded is not None:
+                prof.write_folded(options.folded)
+            elif options.outfile is not None:
+                prof.dump_stats(options.outfile)
+            else:
+                prof.print_stats(options.sort)
+        except BrokenPipeError as exc:
+            # Prevent "Exception ignored" during interpreter shutdown.
+            sys.stdout = None
+            sys.exit(exc.errno)
+    else:
+        parser.print_usage()
+    return parser
+
+# When invoked as main program, invoke the profiler on a script
+if __name__ == '__main__':
+    main()
@@ -395,6 +395,101 @@ def test_find_shift_table_overflow(self):
         self.checkequal(len(text2) - N*len("de") - len(pattern2),
                         text2, 'find', pattern2)
 
+    # Needles of up to 32 characters are looked for in blocks of 16 bytes
+    # of windows of the haystack, comparing only the windows whose first and
+    # last characters match the needle's.  The helpers below take a function
+    # mapping their ASCII text to wider characters, for the str kinds.
+
+    def _check_short_needles(self, widen):
+        letters = widen(''.join(c for c in string.ascii_letters
+                                if c not in 'axy'))
+        a, x, y = widen('a'), widen('x'), widen('y')
+        for m in (2, 3, 5, 8, 9, 15, 16, 17, 31, 32, 33):
+            needle = a + letters[:m - 2] + a if m > 2 else a + letters[0]
+            decoy = a + y * (m - 2) + a if m > 2 else None
+            missing = needle[:-1] + widen('!')
+            for n in (m - 1, *range(m, m + 18), m + 31, m + 32, m + 33):
+                with self.subTest(m=m, n=n):
+                    for p in range(n - m + 1):
+                        text = x * p + needle + x * (n - m - p)
+                        if decoy is not None and p >= m:
+                            text = text[:p - m] + decoy + text[p:]
+                        self.checkequal(p, text, 'find', needle)
+                        self.checkequal(p, text, 'rfind', needle)
+                        self.checkequal(1, text, 'count', needle)
+                        self.checkequal([text[:p], text[p + m:]],
+                                        text, 'split', needle)
+                        self.checkequal(-1, text, 'find', missing)
+                        self.checkequal(0, text, 'count', missing)
+                        self.checkequal(2, text + needle, 'count', needle)
+                        self.checkequal(n, text + needle, 'rfind', needle)
+                    text = x * n
+                    if n >= m:
+                        text = needle[:-1] + x * (n - m + 1)
+                    self.checkequal(-1, text, 'find', needle)
+                    self.checkequal(0, text, 'count', needle)
+
+    def _check_short_needle_switch(self, widen):
+        # Many windows match the first and last characters of the needle
+        # only, so that the search switches to the two-way algorithm a few
+        # hundred characters in when there is enough haystack left.
+        needle, decoy = widen('abcdea'), widen('ayyyya')
+        m = len(needle)
+        for n in 2400, 3000, 6000:
+            base = decoy * (n // m)
+            with self.subTest(n=n):
+                self.checkequal(-1, base, 'find', needle)
+                self.checkequal(0, base, 'count', needle)
+                for p in range(0, n - m + 1, 7):
+                    text = base[:p] + needle + base[p + m:]
+                    self.checkequal(p, text, 'find', needle)
+                    self.checkequal(1, text, 'count', needle)
+                    if p >= 100 + m:
+                        text = text[:100] + needle + text[100 + m:]
+                        self.checkequal(100, text, 'find', needle)
+                        self.checkequal(2, text, 'count', needle)
+                        self.checkequal(p, text, 'rfind', needle)
+
+    def _check_count_char_blocks(self, widen):
+        # Matches are summed in blocks of 16 bytes, 255 at most at a time.
+        a, x = widen('a'), widen('x')
+        for n in range(40):
+            with self.subTest(n=n):
+                for p in range(n):
+                    text = x * p + a + x * (n - p - 1)
+                    self.checkequal(1, text, 'count', a)
+                    self.checkequal(n - 1, text, 'count', x)
+        for n in (1019, 1020, 1021, 2039, 2040, 2041,
+                  4079, 4080, 4081, 8160, 8161):
+            self.checkequal(n, a * n, 'count', a)
+            self.checkequal((n + 1) // 2, (a + x) * (n // 2) + a * (n % 2),
+                            'count', a)
+
+    def test_find_short_needle_blocks(self):
+        self._check_short_needles(str)
+
+    def test_find_short_needle_switch(self):
+        self._check_short_needle_switch(str)
+
+    def test_count_char_blocks(self):
+        self._check_count_char_blocks(str)
+
+    def test_split_whitespace_blocks(self):
+        # split() skips the bytes which cannot be whitespace 16 at a time,
+        # then checks the control characters it stops at.
+        for n in range(1, 40):
+            word = 'w' * n
+            with self.subTest(n=n):
+                for p in range(n):
+                    for space in ' ', '\t', '\n':
+                        text = word[:p] + space + word[p + 1:]
+                        self.checkequal([s for s in (word[:p], word[p + 1:])
+                                         if s], text, 'split')
+                    text = word[:p] + '\x01' + word[p + 1:]
+                    self.checkequal([text], text, 'split')
+                    self.checkequal(['u' + text, text],
+                                    'u' + text + ' ' + text, 'split')
+
     def test_lower(self):
         self.checkequal('hello', 'HeLLo', 'lower')
         self.checkequal('hello', 'hello', 'lower')
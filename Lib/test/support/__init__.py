@@ -780,13 +780,18 @@ def python_is_optimized():
             final_opt = opt
     return final_opt not in ('', '-O0', '-Og')
 
-# VeronaPy: Added the extra region pointer here.
-# The getobjects pointers will be removed later.
-_header = 'nPP'
+_header = 'nP'
 _align = '0n'
 if hasattr(sys, "getobjects"):
     _header = '2P' + _header
     _align = '0P'
+# VeronaPy: Objects have an extra region pointer when Python is configured
+# --with-regions, and on 32-bit platforms.
+def _has_region_field():
+    import struct
+    return object.__basicsize__ > struct.calcsize(_header)
+if _has_region_field():
+    _header += 'P'
 _vheader = _header + 'n'
 
 def calcobjsize(fmt):
@@ -917,6 +917,95 @@ def test_incremental_errors(self):
                 self.assertRaises(UnicodeDecodeError, dec.decode, data)
 
 
+class UTF8BlocksTest(unittest.TestCase):
+    # Runs of ASCII characters are decoded and encoded 16 at a time: test the
+    # lengths around one and two blocks, with the data at every alignment
+    # and a non-ASCII character of each kind at every position of the block.
+
+    BLOCK_LENGTHS = (15, 16, 17, 31, 32, 33)
+    WIDE_CHARS = ('\xe9', '\u20ac', '\U0001f600')
+
+    @staticmethod
+    def ascii_text(n):
+        return ''.join(chr(0x20 + i % 0x5f) for i in range(n))
+
+    def check_decode_aligned(self, data, errors, expected):
+        buf = bytearray(len(data) + 16)
+        for start in range(16):
+            buf[start:start + len(data)] = data
+            view = memoryview(buf)[start:start + len(data)]
+            self.assertEqual(codecs.utf_8_decode(view, errors, True),
+                             (expected, len(data)))
+
+    def test_decode_blocks(self):
+        for n in self.BLOCK_LENGTHS:
+            text = self.ascii_text(n)
+            self.check_decode_aligned(text.encode('ascii'), 'strict', text)
+            for ch in self.WIDE_CHARS:
+                for pos in range(n):
+                    with self.subTest(n=n, ch=ch, pos=pos):
+                        s = text[:pos] + ch + text[pos + 1:]
+                        self.check_decode_aligned(s.encode('utf-8'),
+                                                  'strict', s)
+
+    def test_decode_blocks_errors(self):
+        for n in self.BLOCK_LENGTHS:
+            text = self.ascii_text(n)
+            # The kind of the string being built when the error is found.
+            for prefix in ('', *self.WIDE_CHARS):
+                head = prefix.encode('utf-8')
+                for pos in range(n):
+                    with self.subTest(n=n, prefix=prefix, pos=pos):
+                        before, after = text[:pos], text[pos + 1:]
+                        data = (head + before.encode('ascii') + b'\xff'
+                                + after.encode('ascii'))
+                        with self.assertRaises(UnicodeDecodeError) as cm:
+                            data.decode('utf-8')
+                        self.assertEqual(cm.exception.start, len(head) + pos)
+                        for errors, repl in (('replace', '\ufffd'),
+                                             ('surrogateescape', '\udcff')):
+                            expected = prefix + before + repl + after
+                            self.check_decode_aligned(data, errors, expected)
+                            if not prefix:
+                                self.assertEqual(data.decode('ascii', errors),
+                                                 expected)
+
+    def test_encode_blocks(self):
+        for n in self.BLOCK_LENGTHS:
+            text = self.ascii_text(n)
+            self.assertEqual(text.encode('utf-8'), text.encode('ascii'))
+            for ch in self.WIDE_CHARS:
+                for pos in range(n):
+                    with self.subTest(n=n, ch=ch, pos=pos):
+                        s = text[:pos] + ch + text[pos + 1:]
+                        expected = (text[:pos].encode('ascii')
+                                    + ch.encode('utf-8')
+                                    + text[pos + 1:].encode('ascii'))
+                        self.assertEqual(s.encode('utf-8'), expected)
+                        # The same text after a non-ASCII character
+                        self.assertEqual(('\xe9' + s).encode('utf-8'),
+                                         b'\xc3\xa9' + expected)
+
+    def test_encode_blocks_errors(self):
+        for n in self.BLOCK_LENGTHS:
+            text = self.ascii_text(n)
+            for prefix in ('', '\U0001f600'):
+                head = prefix.encode('utf-8')
+                for pos in range(n):
+                    with self.subTest(n=n, prefix=prefix, pos=pos):
+                        before, after = text[:pos], text[pos + 1:]
+                        s = prefix + before + '\udcff' + after
+                        with self.assertRaises(UnicodeEncodeError) as cm:
+                            s.encode('utf-8')
+                        self.assertEqual(cm.exception.start, len(prefix) + pos)
+                        for errors, repl in (('replace', b'?'),
+                                             ('surrogateescape', b'\xff')):
+                            expected = (head + before.encode('ascii') + repl
+                                        + after.encode('ascii'))
+                            self.assertEqual(s.encode('utf-8', errors),
+                                             expected)
+
+
 class UTF7Test(ReadTest, unittest.TestCase):
     encoding = "utf-7"
 
@@ -5612,6 +5612,41 @@ class B(A):
         self.assertLess(sys.getsizeof(vars(a2)), sys.getsizeof({"a":1}))
         self.assertLess(sys.getsizeof(vars(b)), sys.getsizeof({"a":1}))
 
+    @support.cpython_only
+    def test_conditional_attributes(self):
+        # Instances which set some attributes only conditionally keep
+        # sharing keys, and keep their values out of a dict
+        class A:
+            def __init__(self, i):
+                self.x = i
+                if i % 2:
+                    self.odd = i
+                if i % 40 == 39:
+                    self.rare = i
+                if i % 50 == 49:
+                    self.rarer = i
+                self.y = i
+
+        objs = [A(i) for i in range(100)]
+        for i, a in enumerate(objs):
+            self.assertFalse(any(isinstance(r, dict)
+                                 for r in gc.get_referents(a)))
+            self.assertEqual(a.x, i)
+            self.assertEqual(a.y, i)
+            self.assertEqual(getattr(a, 'rare', None),
+                             i if i % 40 == 39 else None)
+            self.assertEqual(getattr(a, 'rarer', None),
+                             i if i % 50 == 49 else None)
+            self.assertEqual(hasattr(a, 'odd'), i % 2 == 1)
+        a = objs[0]
+        a.rare = 'r'
+        del a.x
+        self.assertEqual(list(vars(a)), ['y', 'rare'])
+        a.odd = 'o'
+        self.assertEqual(vars(a), {'y': 0, 'rare': 'r', 'odd': 'o'})
+        self.assertEqual(vars(objs[99]),
+                         {'x': 99, 'odd': 99, 'rarer': 99, 'y': 99})
+
 
 class DebugHelperMeta(type):
     """
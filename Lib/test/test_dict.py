@@ -1109,6 +1109,179 @@ class C:
         self.assertGreater(sys.getsizeof(d), before_resize)
         self.assertEqual(list(d), ['x', 2])
 
+    @support.cpython_only
+    def test_presize_from_length_hint(self):
+        # Bulk constructions size the dict once after the length hint of
+        # their iterable, whatever the kind of their keys
+        for keys in ([str(i) for i in range(1000)], list(range(1000))):
+            expected = dict.fromkeys(keys)
+            size = sys.getsizeof(expected)
+            values = [None] * len(keys)
+            for d in (dict(zip(keys, values)),
+                      dict(zip(iter(keys), values + values)),
+                      dict([(k, None) for k in keys]),
+                      dict.fromkeys(iter(keys)),
+                      {k: None for k in keys},
+                      {k: v for k, v in zip(keys, values)}):
+                self.assertEqual(d, expected)
+                self.assertEqual(sys.getsizeof(d), size)
+
+        # Wrong hints and duplicate keys only cost memory
+        class Hint:
+            def __init__(self, items, hint):
+                self.items = items
+                self.hint = hint
+            def __iter__(self):
+                return iter(self.items)
+            def __length_hint__(self):
+                return self.hint
+
+        items = [(i % 10, i) for i in range(100)]
+        for hint in (0, 5, 100, 10000, 2**40, sys.maxsize // 4, sys.maxsize):
+            self.assertEqual(dict(Hint(items, hint)), dict(items[-10:]))
+            d = dict.fromkeys(Hint([k for k, v in items], hint))
+            self.assertEqual(d, dict.fromkeys(range(10)))
+
+        class BadHint(Hint):
+            def __length_hint__(self):
+                raise ZeroDivisionError
+        self.assertRaises(ZeroDivisionError, dict, BadHint(items, 0))
+
+    def test_presize_bound(self):
+        # The length hint counts the items rather than the distinct keys,
+        # and a dict never shrinks: the presize is bounded as in
+        # _PyDict_NewPresized(), except for the views of a dict.
+        bound = sys.getsizeof(dict.fromkeys(range((2 << 17) // 3)))
+        n = 300_000
+        pairs = [(i % 3, i) for i in range(n)]
+        self.assertLessEqual(sys.getsizeof(dict(pairs)), bound)
+        d = {}
+        d.update(pairs)
+        self.assertLessEqual(sys.getsizeof(d), bound)
+        d = dict.fromkeys([i % 3 for i in range(n)])
+        self.assertLessEqual(sys.getsizeof(d), bound)
+
+        class Hint:
+            def __iter__(self):
+                return iter([(i, i) for i in range(10)])
+            def __length_hint__(self):
+                return 10**7
+        d = dict(Hint())
+        self.assertEqual(d, {i: i for i in range(10)})
+        self.assertLessEqual(sys.getsizeof(d), bound)
+        d = dict.fromkeys(k for k, v in Hint())
+        self.assertLessEqual(sys.getsizeof(d), bound)
+
+        big = dict.fromkeys(range(n))
+        self.assertGreater(sys.getsizeof(big), bound)
+        self.assertEqual(sys.getsizeof(dict(big.items())), sys.getsizeof(big))
+        self.assertEqual(sys.getsizeof(dict.fromkeys(big.keys())),
+                         sys.getsizeof(big))
+
+    # Str-keyed tables of 2**16 slots or more are probed by groups of slots,
+    # after a tag of the hash kept per slot.
+    LARGE = 50_000
+
+    def large_str_dict(self):
+        keys = [f'key{i}' for i in range(self.LARGE)]
+        return keys, {k: i for i, k in enumerate(keys)}
+
+    def check_large_str_dict(self, d, expected):
+        self.assertEqual(len(d), len(expected))
+        for k, v in expected.items():
+            # An equal but distinct str compares its characters.
+            self.assertEqual(d[k[:1] + k[1:]], v)
+        for i in range(0, self.LARGE, 7):
+            k = f'missing{i}'
+            self.assertNotIn(k, d)
+            self.assertIsNone(d.get(k))
+
+    def test_large_str_keys_delete_reinsert(self):
+        keys, d = self.large_str_dict()
+        expected = dict(d)
+        for k in keys[::2]:
+            del d[k]
+            del expected[k]
+        self.check_large_str_dict(d, expected)
+        for k in keys[::2]:
+            self.assertNotIn(k, d)
+            self.assertRaises(KeyError, d.__getitem__, k)
+        for i, k in enumerate(keys[::2]):
+            d[k] = -i
+            expected[k] = -i
+        self.check_large_str_dict(d, expected)
+        self.assertEqual(list(d), keys[1::2] + keys[::2])
+
+    def test_large_str_keys_popitem(self):
+        keys, d = self.large_str_dict()
+        for i in range(len(keys) - 1, len(keys) // 3, -1):
+            self.assertEqual(d.popitem(), (keys[i], i))
+        self.assertEqual(len(d), len(keys) // 3 + 1)
+        for i, k in enumerate(keys):
+            self.assertEqual(d.get(k), i if i <= len(keys) // 3 else None)
+        d['new'] = -1
+        self.assertEqual(d.popitem(), ('new', -1))
+        self.assertEqual(d.popitem(), (keys[len(keys) // 3], len(keys) // 3))
+
+    def test_large_str_keys_reuse_deleted_slots(self):
+        # The new keys can take the slots left by the deleted ones, whose
+        # tags must not match them any more.
+        keys, d = self.large_str_dict()
+        expected = dict(d)
+        for i in range(20_000):
+            old = keys[i]
+            new = f'new{i}'
+            del d[old]
+            del expected[old]
+            self.assertNotIn(old, d)
+            d[new] = i
+            expected[new] = i
+            self.assertEqual(d[new], i)
+        self.check_large_str_dict(d, expected)
+        for k in keys[:20_000]:
+            self.assertNotIn(k, d)
+
+    def test_large_str_keys_generic_fallback(self):
+        class Str:
+            # Equal to a str, with the same hash, but not a str.
+            def __init__(self, s):
+                self.s = s
+            def __hash__(self):
+                return hash(self.s)
+            def __eq__(self, other):
+                return other == self.s
+
+        class Collider:
+            # Only equal to itself, with the hash of a str.
+            def __init__(self, s):
+                self.hash = hash(s)
+            def __hash__(self):
+                return self.hash
+
+        keys, d = self.large_str_dict()
+        expected = dict(d)
+        # Lookups of keys that are not strs take the generic path.
+        for i in range(0, len(keys), 101):
+            self.assertEqual(d[Str(keys[i])], i)
+            self.assertNotIn(Str(f'missing{i}'), d)
+            self.assertNotIn(Collider(keys[i]), d)
+        # Keys that are not strs turn the table generic, and the ones that
+        # collide with str keys are probed past them.
+        colliders = [Collider(k) for k in keys[::500]]
+        for c in colliders:
+            d[c] = c
+            expected[c] = c
+        d[Str(keys[0])] = 'updated'
+        expected[keys[0]] = 'updated'
+        self.assertEqual(len(d), len(expected))
+        for k, v in expected.items():
+            self.assertIs(d[k], v)
+        for c in colliders:
+            del d[c]
+        for k in keys[::500]:
+            self.assertIn(k, d)
+            self.assertNotIn(Collider(k), d)
+
     def test_iterator_pickling(self):
         for proto in range(pickle.HIGHEST_PROTOCOL + 1):
             data = {1:"a", 2:"b", 3:"c"}
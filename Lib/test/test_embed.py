@@ -451,6 +451,7 @@ class InitConfigTests(EmbeddingTestsMixin, unittest.TestCase):
         'tracemalloc': 0,
         'perf_profiling': 0,
         'import_time': 0,
+        'gc_adaptive': 0,
         'code_debug_ranges': 1,
         'show_ref_count': 0,
         'dump_refs': 0,
@@ -908,6 +909,7 @@ def test_init_compat_env(self):
             'tracemalloc': 2,
             'perf_profiling': 0,
             'import_time': 1,
+            'gc_adaptive': 1,
             'code_debug_ranges': 0,
             'malloc_stats': 1,
             'inspect': 1,
@@ -941,6 +943,7 @@ def test_init_python_env(self):
             'tracemalloc': 2,
             'perf_profiling': 0,
             'import_time': 1,
+            'gc_adaptive': 1,
             'code_debug_ranges': 0,
             'malloc_stats': 1,
             'inspect': 1,
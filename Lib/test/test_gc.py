@@ -1,18 +1,22 @@
 import unittest
 import unittest.mock
 from test.support import (verbose, refcount_test,
-                          cpython_only, requires_subprocess)
+                          cpython_only, requires_subprocess, requires_fork,
+                          sleeping_retry, wait_process, SHORT_TIMEOUT)
 from test.support.import_helper import import_module
 from test.support.os_helper import temp_dir, TESTFN, unlink
 from test.support.script_helper import assert_python_ok, make_script
 from test.support import threading_helper
 
+import collections
 import gc
+import os
 import sys
 import sysconfig
 import textwrap
 import threading
 import time
+import warnings
 import weakref
 
 try:
@@ -785,10 +789,18 @@ def __del__(self):
     def test_get_stats(self):
         stats = gc.get_stats()
         self.assertEqual(len(stats), 3)
-        for st in stats:
+        keys = {"collected", "collections", "uncollectable", "duration",
+                "visited", "visited_update_refs", "visited_subtract_refs",
+                "visited_move_unreachable", "survived", "threshold",
+                "weakrefs_duration", "finalize_duration",
+                "duration_histogram", "visited_histogram"}
+        for st in stats[:2]:
             self.assertIsInstance(st, dict)
-            self.assertEqual(set(st),
-                             {"collected", "collections", "uncollectable"})
+            self.assertEqual(set(st), keys)
+        self.assertEqual(set(stats[2]),
+                         keys | {"increments", "increment_pauses",
+                                 "max_increment_pause"})
+        for st in stats:
             self.assertGreaterEqual(st["collected"], 0)
             self.assertGreaterEqual(st["collections"], 0)
             self.assertGreaterEqual(st["uncollectable"], 0)
@@ -808,12 +820,132 @@ def test_get_stats(self):
         self.assertEqual(new[1]["collections"], old[1]["collections"])
         self.assertEqual(new[2]["collections"], old[2]["collections"] + 1)
 
+    def test_get_stats_work(self):
+        if gc.isenabled():
+            self.addCleanup(gc.enable)
+            gc.disable()
+        objects = [[] for i in range(1000)]
+        gc.collect(0)
+        old = gc.get_stats()[0]
+        gc.collect(0)
+        new = gc.get_stats()[0]
+        # The objects were moved to the next generation
+        self.assertLess(new["visited"] - old["visited"], len(objects))
+        self.assertLess(new["survived"] - old["survived"], len(objects))
+        self.assertGreaterEqual(new["visited"], old["visited"])
+        self.assertGreaterEqual(new["duration"], old["duration"])
+        for key in ("duration_histogram", "visited_histogram"):
+            self.assertEqual(len(new[key]), 32)
+            self.assertEqual(sum(new[key]), new["collections"])
+            self.assertEqual(sum(new[key]) - sum(old[key]), 1)
+        gc.collect(2)
+        old = gc.get_stats()[2]
+        objects.append(objects)
+        gc.collect(2)
+        new = gc.get_stats()[2]
+        # update_refs(), subtract_refs() and move_unreachable() visit every
+        # object at least once
+        steps = ("visited_update_refs", "visited_subtract_refs",
+                 "visited_move_unreachable")
+        for key in steps:
+            self.assertGreaterEqual(new[key] - old[key], len(objects))
+        self.assertEqual(sum(new[key] for key in steps), new["visited"])
+        bucket = (new["visited"] - old["visited"]).bit_length()
+        self.assertEqual(new["visited_histogram"][bucket],
+                         old["visited_histogram"][bucket] + 1)
+        self.assertGreaterEqual(new["duration"] - old["duration"],
+                                (new["weakrefs_duration"]
+                                 - old["weakrefs_duration"])
+                                + (new["finalize_duration"]
+                                   - old["finalize_duration"]))
+
+    def test_get_stats_threshold(self):
+        thresholds = gc.get_threshold()
+        self.addCleanup(gc.set_threshold, *thresholds)
+        gc.set_threshold(500, 7, 9)
+        self.assertEqual(gc.get_threshold(), (500, 7, 9))
+        self.assertEqual([st["threshold"] for st in gc.get_stats()],
+                         [500, 7, 9])
+
+    def test_adaptive_thresholds(self):
+        code = textwrap.dedent("""
+            import gc
+
+            gc.set_threshold(100, 10, 10)
+            # Nearly all the objects survive: the young collections are
+            # made rarer
+            objects = [[i] for i in range(100_000)]
+            stats = gc.get_stats()
+            assert stats[0]["threshold"] > 100, stats[0]
+            assert stats[0]["threshold"] <= 100 * 64, stats[0]
+            assert stats[0]["collections"] < len(objects) // 100, stats[0]
+            assert stats[2]["threshold"] == 10, stats[2]
+            # Nearly all of them are garbage: back to the set threshold
+            for i in range(100_000):
+                l = []
+                l.append(l)
+            assert gc.get_stats()[0]["threshold"] == 100
+            assert gc.get_threshold() == (100, 10, 10)
+        """)
+        assert_python_ok("-X", "gc_adaptive", "-c", code)
+        assert_python_ok("-c", code, PYTHONGCADAPTIVE="1")
+        # The thresholds are fixed by default
+        code = textwrap.dedent("""
+            import gc
+
+            gc.set_threshold(100, 10, 10)
+            objects = [[i] for i in range(100_000)]
+            assert gc.get_stats()[0]["threshold"] == 100
+        """)
+        assert_python_ok("-c", code)
+
     def test_freeze(self):
         gc.freeze()
         self.assertGreater(gc.get_freeze_count(), 0)
         gc.unfreeze()
         self.assertEqual(gc.get_freeze_count(), 0)
 
+    def test_freeze_immortalize(self):
+        # The objects stay immortal, so freeze them in another process
+        code = textwrap.dedent("""
+            import gc
+            import os
+            import sys
+
+            class A:
+                pass
+
+            def func():
+                return ('spam', 1.5)
+
+            objs = [A() for i in range(100)]
+            gc.freeze(immortalize=True)
+            count = gc.get_freeze_count()
+            assert count >= 100, count
+            assert not gc.is_tracked(objs)
+            assert not gc.is_tracked(objs[0])
+            assert gc.is_tracked([])
+            refcount = sys.getrefcount(objs)
+            consts = func.__code__.co_consts
+            assert sys.getrefcount(consts[-1]) > 2**20
+            copies = [objs] * 1000
+            assert sys.getrefcount(objs) == refcount
+            del copies
+            # Frozen objects are never deallocated
+            del objs, A, func
+
+            # Unfreezing and collecting leave them alone
+            gc.unfreeze()
+            assert gc.get_freeze_count() == count
+            l = []
+            l.append(l)
+            del l
+            assert gc.collect() >= 1
+            print(len(consts))
+        """)
+        rc, out, err = assert_python_ok("-c", code)
+        self.assertEqual(out.strip(), b"2")
+
     def test_get_objects(self):
         gc.collect()
         l = []
@@ -1144,6 +1276,10 @@ def test_collect(self):
             self.assertTrue("generation" in info)
             self.assertTrue("collected" in info)
             self.assertTrue("uncollectable" in info)
+            self.assertTrue("duration" in info)
+            self.assertTrue("visited" in info)
+            self.assertTrue("weakrefs_duration" in info)
+            self.assertTrue("finalize_duration" in info)
 
     def test_collect_generation(self):
         self.preclean()
@@ -1187,6 +1323,26 @@ def test_collect_garbage(self):
         # Uncollectables should be gone
         self.assertEqual(len(gc.garbage), 0)
 
+    def test_collect_work(self):
+        self.preclean()
+        objects = [[] for i in range(100)]
+        gc.collect()
+        for v in self.visit:
+            info = v[2]
+            if v[1] == "start":
+                self.assertEqual(info["visited"], 0)
+                self.assertEqual(info["duration"], 0.0)
+                continue
+            steps = ("visited_update_refs", "visited_subtract_refs",
+                     "visited_move_unreachable")
+            for key in steps:
+                self.assertGreaterEqual(info[key], len(objects))
+            self.assertEqual(sum(info[key] for key in steps), info["visited"])
+            self.assertGreaterEqual(info["duration"], 0.0)
+            self.assertGreaterEqual(info["duration"],
+                                    info["weakrefs_duration"]
+                                    + info["finalize_duration"])
+
 
     @unittest.skipIf(BUILD_WITH_NDEBUG,
                      'built with -NDEBUG')
@@ -1388,6 +1544,241 @@ def __del__(self):
             self.assertEqual(x, None)
 
 
+class IncrementalGCTests(unittest.TestCase):
+    def setUp(self):
+        self.addCleanup(gc.set_threshold, *gc.get_threshold())
+        self.addCleanup(gc.disable)
+        self.addCleanup(gc.set_incremental, 0)
+        gc.collect()
+        gc.set_incremental(0.001)
+        gc.enable()
+
+    def run_increments(self, until, limit=10**6):
+        # Allocate containers, keeping some alive so that the oldest
+        # generation grows enough to start an incremental collection.
+        keep = []
+        for i in range(limit):
+            if i % 100 == 0 and until():
+                return
+            keep.append([])
+        self.fail("the incremental collection didn't finish")
+
+    def test_set_incremental(self):
+        self.assertEqual(gc.get_incremental(), 0.001)
+        gc.set_incremental(0.5)
+        self.assertEqual(gc.get_incremental(), 0.5)
+        self.assertRaises(ValueError, gc.set_incremental, -1)
+        self.assertRaises(TypeError, gc.set_incremental, "1")
+        self.assertEqual(gc.get_incremental(), 0.5)
+        gc.set_incremental(0)
+        self.assertEqual(gc.get_incremental(), 0.0)
+
+    def test_collect_old_cycles(self):
+        class A:
+            pass
+        cycles = []
+        for i in range(1000):
+            a = A()
+            a.b = A()
+            a.b.a = a
+            cycles.append(a)
+        refs = [weakref.ref(a) for a in cycles]
+        # Move the cycles to the oldest generation.
+        gc.collect(1)
+        del a, cycles
+        self.assertTrue(all(r() is not None for r in refs))
+        self.run_increments(lambda: all(r() is None for r in refs))
+
+    def test_stats(self):
+        old = gc.get_stats()[2]
+        self.run_increments(
+            lambda: gc.get_stats()[2]["collections"] > old["collections"])
+        new = gc.get_stats()[2]
+        self.assertGreater(new["increments"], old["increments"])
+        pauses = new["increment_pauses"]
+        self.assertEqual(len(pauses), min(new["increments"], 64))
+        for pause in pauses:
+            self.assertGreaterEqual(pause, 0.0)
+            self.assertLessEqual(pause, new["max_increment_pause"])
+
+    def test_frozen_objects(self):
+        l = []
+        l.append(l)
+        gc.freeze()
+        self.addCleanup(gc.unfreeze)
+        count = gc.get_freeze_count()
+        old = gc.get_stats()[2]
+        self.run_increments(
+            lambda: gc.get_stats()[2]["collections"] > old["collections"])
+        self.assertEqual(gc.get_freeze_count(), count)
+        self.assertFalse(any(o is l for o in gc.get_objects()))
+        gc.unfreeze()
+        self.assertTrue(any(o is l for o in gc.get_objects(generation=2)))
+
+    def test_full_collection(self):
+        # A full collection in the middle of an incremental one.
+        old = gc.get_stats()[2]
+        self.run_increments(
+            lambda: gc.get_stats()[2]["increments"] > old["increments"])
+        class A:
+            pass
+        a = A()
+        a.a = a
+        ref = weakref.ref(a)
+        del a
+        gc.collect()
+        self.assertIsNone(ref())
+        old = gc.get_stats()[2]
+        self.run_increments(
+            lambda: gc.get_stats()[2]["collections"] > old["collections"])
+
+    def test_marking_holds_no_references(self):
+        # Objects marked from the roots are freed as soon as they are
+        # dropped, even while they wait to be traversed.
+        class A:
+            pass
+        objs = [A() for i in range(10000)]
+        sys._test_gc_objs = objs
+        self.addCleanup(delattr, sys, "_test_gc_objs")
+        old = gc.get_stats()[2]
+        def drop():
+            if objs:
+                ref = weakref.ref(objs.pop())
+                self.assertIsNone(ref())
+            return gc.get_stats()[2]["collections"] > old["collections"]
+        self.run_increments(drop)
+
+
+
+@threading_helper.requires_working_threading()
+class ParallelMarkingTests(unittest.TestCase):
+    # Parallel marking only applies to heaps of 100,000 objects or more.
+    size = 150_000
+
+    def setUp(self):
+        self.addCleanup(gc.set_mark_threads, gc.get_mark_threads())
+        if gc.isenabled():
+            self.addCleanup(gc.enable)
+            gc.disable()
+        gc.set_mark_threads(4)
+
+    def test_set_mark_threads(self):
+        self.assertEqual(gc.get_mark_threads(), 4)
+        gc.set_mark_threads(0)
+        self.assertEqual(gc.get_mark_threads(), 1)
+        self.assertRaises(ValueError, gc.set_mark_threads, -1)
+        self.assertRaises(TypeError, gc.set_mark_threads, 1.5)
+        self.assertEqual(gc.get_mark_threads(), 1)
+
+    def test_collect(self):
+        class A:
+            pass
+        # A long cycle of live objects, and cycles referring to it.
+        head = A()
+        node = head
+        for i in range(self.size):
+            node.next = A()
+            node = node.next
+        node.next = head
+        live = [weakref.ref(node)]
+        cycles = []
+        for i in range(1000):
+            a = A()
+            a.self = a
+            a.chain = head
+            cycles.append(weakref.ref(a))
+        del a, node
+        # Live objects referred to only from the garbage.
+        b = A()
+        b.nested = [[[i]] for i in range(100)]
+        a = A()
+        a.b = b
+        a.self = a
+        cycles.append(weakref.ref(a))
+        live.append(weakref.ref(b))
+        del a
+        self.assertGreaterEqual(gc.collect(), 1001)
+        self.assertTrue(all(r() is None for r in cycles))
+        self.assertTrue(all(r() is not None for r in live))
+        self.assertEqual(b.nested[99], [[99]])
+        del head
+        self.assertGreaterEqual(gc.collect(), self.size)
+        self.assertIsNone(live[0]())
+
+    def test_extension_types(self):
+        # The helper threads leave the objects of types defined outside of
+        # the core, and of their subclasses, to the collecting thread.
+        class D(collections.deque):
+            pass
+        class A:
+            pass
+        nodes = [collections.deque([D([A()])])
+                 for i in range(self.size // 3)]
+        live = [weakref.ref(node[0][0]) for node in nodes[::1000]]
+        a = A()
+        a.self = a
+        a.deque = collections.deque([nodes, D([a])])
+        garbage = weakref.ref(a)
+        del a
+        self.assertGreaterEqual(gc.collect(), 3)
+        self.assertIsNone(garbage())
+        self.assertTrue(all(r() is not None for r in live))
+        del nodes
+        self.assertTrue(all(r() is None for r in live))
+
+    def make_garbage(self):
+        # A cycle large enough to be marked in parallel
+        head = [None]
+        node = head
+        for i in range(self.size):
+            node[0] = [None]
+            node = node[0]
+        node[0] = head
+
+    @unittest.skipUnless(os.path.isdir('/proc/self/task'),
+                         'requires /proc/self/task')
+    def test_helper_threads(self):
+        # The helpers are started once, and exit when their number changes.
+        def nthreads():
+            return len(os.listdir('/proc/self/task'))
+        gc.set_mark_threads(1)
+        before = nthreads()
+        gc.set_mark_threads(4)
+        self.make_garbage()
+        gc.collect()
+        self.assertEqual(nthreads(), before + 3)
+        self.make_garbage()
+        gc.collect()
+        self.assertEqual(nthreads(), before + 3)
+        gc.set_mark_threads(2)
+        self.make_garbage()
+        gc.collect()
+        for _ in sleeping_retry(SHORT_TIMEOUT):
+            if nthreads() == before + 1:
+                break
+        gc.set_mark_threads(0)
+        for _ in sleeping_retry(SHORT_TIMEOUT):
+            if nthreads() == before:
+                break
+
+    @requires_fork()
+    def test_fork(self):
+        # The child process starts its own helper threads.
+        self.make_garbage()
+        gc.collect()
+        with warnings.catch_warnings(category=DeprecationWarning,
+                                     action='ignore'):
+            # the helper threads are still running
+            pid = os.fork()
+        if pid == 0:
+            try:
+                self.make_garbage()
+                os._exit(0 if gc.collect() >= self.size else 1)
+            finally:
+                os._exit(2)
+        wait_process(pid, exitcode=0)
+
+
 class PythonFinalizationTests(unittest.TestCase):
     def test_ast_fini(self):
         # bpo-44184: Regression test for subtype_dealloc() when deallocating
@@ -242,6 +242,89 @@ def loop():
         #This should not raise
         loop()
 
+
+class FreelistTest(unittest.TestCase):
+    # Generator-like objects are recycled through per-frame-size freelists;
+    # a recycled object must behave exactly like a freshly allocated one.
+
+    @staticmethod
+    def make_genfunc(nlocals, kind='def'):
+        names = [f'v{i}' for i in range(nlocals)]
+        lines = [f'{kind} f(start):']
+        lines += [f'    {name} = start + {i}' for i, name in enumerate(names)]
+        lines.append(f'    yield sum(({", ".join(names)},))')
+        lines.append(f'    yield {names[-1]}')
+        ns = {}
+        exec('\n'.join(lines), ns)
+        return ns['f']
+
+    def test_reuse_across_frame_sizes(self):
+        funcs = [self.make_genfunc(n) for n in (1, 3, 4, 5, 17, 60, 200)]
+        for _ in range(3):
+            for n, func in zip((1, 3, 4, 5, 17, 60, 200), funcs):
+                gens = [func(k) for k in range(20)]
+                for k, g in enumerate(gens):
+                    self.assertEqual(list(g),
+                                     [sum(range(k, k + n)), k + n - 1])
+                del gens
+
+    def test_reuse_across_generator_types(self):
+        genfunc = self.make_genfunc(8)
+
+        async def coro(a, b, c, d, e, f, g, h):
+            return a + b + c + d + e + f + g + h
+
+        async def agen(a, b, c, d, e, f, g, h):
+            yield a + b + c + d + e + f + g + h
+
+        for _ in range(50):
+            self.assertEqual(next(genfunc(1)), 36)
+            c = coro(*range(8))
+            with self.assertRaises(StopIteration) as cm:
+                c.send(None)
+            self.assertEqual(cm.exception.value, 28)
+            a = agen(*range(8))
+            with self.assertRaises(StopIteration) as cm:
+                a.asend(None).send(None)
+            self.assertEqual(cm.exception.value, 28)
+            a.aclose().close()
+
+    def test_recycled_state_is_reset(self):
+        def gen():
+            try:
+                yield 1
+            except ValueError:
+                yield sys.exception()
+
+        for _ in range(20):
+            g = gen()
+            self.assertIsNone(g.gi_frame.f_back)
+            self.assertEqual(g.__name__, 'gen')
+            self.assertFalse(g.gi_running)
+            self.assertEqual(next(g), 1)
+            self.assertIsInstance(g.throw(ValueError()), ValueError)
+            wr = weakref.ref(g)
+            del g
+            self.assertIsNone(wr())
+            g = gen()
+            self.assertIsNone(g.gi_yieldfrom)
+            self.assertFalse(g.gi_suspended)
+            self.assertEqual(list(g), [1])
+            self.assertEqual(sys.getsizeof(g), sys.getsizeof(gen()))
+
+    def test_unawaited_coroutine_after_reuse(self):
+        async def coro():
+            pass
+
+        for _ in range(5):
+            c = coro()
+            c.close()
+        with self.assertWarns(RuntimeWarning):
+            c = coro()
+            del c
+            support.gc_collect()
+
+
 class ExceptionTest(unittest.TestCase):
     # Tests for the issue #23353: check that the currently handled exception
     # is correctly saved/restored in PyEval_EvalFrameEx().
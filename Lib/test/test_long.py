@@ -12,6 +12,7 @@
 BASE = 2 ** SHIFT
 MASK = BASE - 1
 KARATSUBA_CUTOFF = 70   # from longobject.c
+TOOM3_CUTOFF = 300      # from longobject.c
 
 # Max number of base BASE digits to use in test cases.  Doubling
 # this will more than double the runtime.
@@ -229,6 +230,38 @@ def test_karatsuba(self):
                          1)
                     self.assertEqual(x, y)
 
+    def test_toom3(self):
+        digits = [TOOM3_CUTOFF - 1, TOOM3_CUTOFF, TOOM3_CUTOFF + 1,
+                  TOOM3_CUTOFF + 2, TOOM3_CUTOFF * 3 // 2, TOOM3_CUTOFF * 2,
+                  TOOM3_CUTOFF * 10]
+        bits = [digit * SHIFT for digit in digits]
+        rng = random.Random(0)
+        for abits in bits:
+            for bbits in bits:
+                if bbits < abits:
+                    continue
+                with self.subTest(abits=abits, bbits=bbits):
+                    # Same identity as in test_karatsuba
+                    a = (1 << abits) - 1
+                    b = (1 << bbits) - 1
+                    self.assertEqual(a * b, (1 << (abits + bbits)) -
+                                            (1 << abits) - (1 << bbits) + 1)
+                    # Random signed operands, checked against schoolbook
+                    # products of their pieces.
+                    a = rng.getrandbits(abits) * rng.choice((1, -1))
+                    b = rng.getrandbits(bbits) * rng.choice((1, -1))
+                    mask = (1 << (SHIFT * 50)) - 1
+                    b_lo = abs(b) & mask
+                    b_hi = abs(b) >> (SHIFT * 50)
+                    expected = a * b_lo + ((a * b_hi) << (SHIFT * 50))
+                    if b < 0:
+                        expected = -expected
+                    self.assertEqual(a * b, expected)
+                    self.assertEqual(a * a, a ** 2)
+                    self.assertEqual(a * a, (-a) * (-a))
+                    self.assertEqual(divmod(a * b + 1, b),
+                                     (a, 1) if b > 0 else (a - 1, b + 1))
+
     def check_bitop_identities_1(self, x):
         eq = self.assertEqual
         with self.subTest(x=x):
@@ -1652,6 +1652,184 @@ def get_expected(name, call_method, ns):
                 )
 
 
+class TestNativeConsumers(MonitoringTestBase, unittest.TestCase):
+
+    def tearDown(self):
+        sys.monitoring.set_events(TEST_TOOL, 0)
+        sys.monitoring.set_events(TEST_TOOL2, 0)
+        sys.monitoring.set_event_buffer(TEST_TOOL, 0)
+        sys.monitoring.set_event_buffer(TEST_TOOL2, 0)
+        sys.monitoring.set_record_lines(TEST_TOOL, False)
+        sys.monitoring.register_callback(TEST_TOOL, E.LINE, None)
+        sys.monitoring.restart_events()
+        super().tearDown()
+
+    def test_buffer_lines(self):
+
+        def func():
+            x = 1
+            for a in range(2):
+                x += a
+
+        code = func.__code__
+        sys.monitoring.set_event_buffer(TEST_TOOL, 100)
+        sys.monitoring.set_local_events(TEST_TOOL, code, E.LINE | E.BRANCH)
+        func()
+        sys.monitoring.set_local_events(TEST_TOOL, code, 0)
+        events = sys.monitoring.drain_event_buffer(TEST_TOOL)
+        self.assertEqual(sys.monitoring.drain_event_buffer(TEST_TOOL), [])
+        for event_code, offset, event, arg in events:
+            self.assertIs(event_code, code)
+            self.assertIn(event, (E.LINE, E.BRANCH))
+        lines = [arg - code.co_firstlineno
+                 for _, _, event, arg in events if event == E.LINE]
+        self.assertEqual(lines, [1, 2, 3, 2, 3, 2])
+        branches = [(line_from_offset(code, offset), line_from_offset(code, arg))
+                    for _, offset, event, arg in events if event == E.BRANCH]
+        self.assertEqual(branches, [(2, 2), (2, 2), (2, 2)])
+
+    def test_buffer_instructions(self):
+        code = f1.__code__
+        sys.monitoring.set_event_buffer(TEST_TOOL, 100)
+        sys.monitoring.set_local_events(TEST_TOOL, code, E.INSTRUCTION)
+        f1()
+        sys.monitoring.set_local_events(TEST_TOOL, code, 0)
+        events = sys.monitoring.drain_event_buffer(TEST_TOOL)
+        offsets = [offset for _, offset, _, _ in events]
+        self.assertEqual(offsets, sorted(offsets))
+        self.assertEqual([arg for _, _, _, arg in events], offsets)
+        self.assertEqual(offsets,
+                         [i.offset for i in dis.get_instructions(code)
+                          if i.opname != 'RESUME'])
+
+    def test_buffer_overwrites_oldest(self):
+
+        def func():
+            for i in range(10):
+                pass
+
+        code = func.__code__
+        sys.monitoring.set_event_buffer(TEST_TOOL, 3)
+        sys.monitoring.set_local_events(TEST_TOOL, code, E.LINE)
+        func()
+        sys.monitoring.set_local_events(TEST_TOOL, code, 0)
+        events = sys.monitoring.drain_event_buffer(TEST_TOOL)
+        self.assertEqual(len(events), 3)
+        self.assertEqual([arg - code.co_firstlineno for _, _, _, arg in events],
+                         [1, 2, 1])
+
+    def test_buffer_flush(self):
+
+        def func():
+            for i in range(10):
+                pass
+
+        flushed = []
+        code = func.__code__
+        sys.monitoring.set_event_buffer(TEST_TOOL, 4, flushed.append)
+        sys.monitoring.set_local_events(TEST_TOOL, code, E.LINE)
+        func()
+        sys.monitoring.set_local_events(TEST_TOOL, code, 0)
+        rest = sys.monitoring.drain_event_buffer(TEST_TOOL)
+        self.assertEqual([len(batch) for batch in flushed], [4] * 5)
+        events = [e for batch in flushed for e in batch] + rest
+        self.assertEqual([arg - code.co_firstlineno for _, _, _, arg in events],
+                         [1, 2] * 10 + [1])
+
+    def test_buffer_flush_error(self):
+
+        def flush(events):
+            raise ZeroDivisionError
+
+        code = floop.__code__
+        sys.monitoring.set_event_buffer(TEST_TOOL, 1, flush)
+        sys.monitoring.set_local_events(TEST_TOOL, code, E.LINE)
+        try:
+            with self.assertRaises(ZeroDivisionError):
+                floop()
+        finally:
+            sys.monitoring.set_local_events(TEST_TOOL, code, 0)
+
+    def test_buffer_and_callbacks(self):
+        # Callbacks are still called for the tools without a buffer.
+        code = floop.__code__
+        seen = []
+        sys.monitoring.register_callback(TEST_TOOL2, E.LINE,
+                                         lambda code, line: seen.append(line))
+        self.addCleanup(sys.monitoring.register_callback, TEST_TOOL2, E.LINE, None)
+        sys.monitoring.set_event_buffer(TEST_TOOL, 100)
+        sys.monitoring.set_local_events(TEST_TOOL, code, E.LINE)
+        sys.monitoring.set_local_events(TEST_TOOL2, code, E.LINE)
+        floop()
+        sys.monitoring.set_local_events(TEST_TOOL, code, 0)
+        sys.monitoring.set_local_events(TEST_TOOL2, code, 0)
+        events = sys.monitoring.drain_event_buffer(TEST_TOOL)
+        self.assertEqual([arg for _, _, _, arg in events], seen)
+
+    def test_buffer_errors(self):
+        self.assertRaises(ValueError, sys.monitoring.set_event_buffer, TEST_TOOL, -1)
+        self.assertRaises(TypeError, sys.monitoring.set_event_buffer, TEST_TOOL, 1, 1)
+        self.assertRaises(ValueError, sys.monitoring.set_event_buffer, 6, 1)
+        self.assertRaises(ValueError, sys.monitoring.drain_event_buffer, TEST_TOOL)
+
+    def test_record_lines(self):
+        called = []
+        sys.monitoring.register_callback(TEST_TOOL, E.LINE,
+                                         lambda *args: called.append(args))
+        sys.monitoring.set_record_lines(TEST_TOOL, True)
+        sys.monitoring.set_events(TEST_TOOL, E.LINE)
+        floop()
+        floop()
+        sys.monitoring.set_events(TEST_TOOL, 0)
+        lines = sys.monitoring.get_recorded_lines(TEST_TOOL)
+        self.assertEqual(called, [])
+        first = floop.__code__.co_firstlineno
+        self.assertEqual(lines[floop.__code__], frozenset({first + 1, first + 2}))
+        sys.monitoring.set_record_lines(TEST_TOOL, False)
+        self.assertRaises(ValueError, sys.monitoring.get_recorded_lines, TEST_TOOL)
+
+    def test_record_lines_disables(self):
+        # Once a line has been recorded, it is not reported again until
+        # events are restarted.
+        sys.monitoring.set_record_lines(TEST_TOOL, True)
+        sys.monitoring.set_event_buffer(TEST_TOOL2, 100)
+        code = floop.__code__
+        sys.monitoring.set_local_events(TEST_TOOL, code, E.LINE)
+        floop()
+        sys.monitoring.set_record_lines(TEST_TOOL, False)
+        sys.monitoring.set_record_lines(TEST_TOOL, True)
+        floop()
+        self.assertEqual(sys.monitoring.get_recorded_lines(TEST_TOOL), {})
+        sys.monitoring.restart_events()
+        floop()
+        sys.monitoring.set_local_events(TEST_TOOL, code, 0)
+        self.assertEqual(len(sys.monitoring.get_recorded_lines(TEST_TOOL)[code]), 2)
+
+    def test_free_tool_id_clears_consumer(self):
+        # A freed id is reused without the buffer and the recorded lines
+        # of its previous user.
+        sys.monitoring.set_event_buffer(TEST_TOOL, 100)
+        sys.monitoring.set_record_lines(TEST_TOOL2, True)
+        code = floop.__code__
+        sys.monitoring.set_local_events(TEST_TOOL, code, E.LINE)
+        sys.monitoring.set_local_events(TEST_TOOL2, code, E.LINE)
+        floop()
+        sys.monitoring.set_local_events(TEST_TOOL, code, 0)
+        sys.monitoring.set_local_events(TEST_TOOL2, code, 0)
+        for tool in (TEST_TOOL, TEST_TOOL2):
+            sys.monitoring.free_tool_id(tool)
+            sys.monitoring.use_tool_id(tool, "reused")
+        self.assertRaises(ValueError, sys.monitoring.drain_event_buffer, TEST_TOOL)
+        self.assertRaises(ValueError, sys.monitoring.get_recorded_lines, TEST_TOOL2)
+        called = []
+        sys.monitoring.register_callback(TEST_TOOL, E.LINE,
+                                         lambda *args: called.append(args))
+        sys.monitoring.set_local_events(TEST_TOOL, code, E.LINE)
+        floop()
+        sys.monitoring.set_local_events(TEST_TOOL, code, 0)
+        self.assertTrue(called)
+
+
 class TestSetGetEvents(MonitoringTestBase, unittest.TestCase):
 
     def test_global(self):
@@ -1,4 +1,6 @@
 import unittest
+from test import support
+from test.support import import_helper
 
 
 class TestLoadSuperAttrCache(unittest.TestCase):
@@ -481,6 +483,124 @@ def f(x, y):
             f()
 
 
+class TestBinaryOpCache(unittest.TestCase):
+    def test_inplace_add_str_to_attribute(self):
+        class Class:
+            pass
+
+        class Slots:
+            __slots__ = ("buf",)
+
+        for cls in (Class, Slots):
+            obj = cls()
+            obj.buf = ""
+            old = []
+            for i in range(1025):
+                if i % 100 == 0:
+                    old.append(obj.buf)
+                obj.buf += "ab"
+            self.assertEqual(obj.buf, "ab" * 1025)
+            self.assertEqual(old, ["ab" * i for i in range(0, 1025, 100)])
+
+    def test_inplace_add_str_to_item(self):
+        def add(container, sub):
+            for _ in range(1025):
+                container[sub] += "ab"
+            return container[sub]
+
+        self.assertEqual(add({"k": "", "x": "y"}, "k"), "ab" * 1025)
+        self.assertEqual(add(["", "x"], 0), "ab" * 1025)
+        self.assertEqual(add(["x", ""], -1), "ab" * 1025)
+        d = {1: "", "k": ""}
+        self.assertEqual(add(d, 1), "ab" * 1025)
+        self.assertEqual(d, {1: "ab" * 1025, "k": ""})
+
+    @support.cpython_only
+    def test_inplace_add_str_no_memory(self):
+        # A failed append leaves the old string where it was.
+        _testcapi = import_helper.import_module('_testcapi')
+
+        class Class:
+            pass
+
+        class Slots:
+            __slots__ = ("buf",)
+
+        def add_attr(obj, s):
+            obj.buf += s
+
+        def add_item(container, sub, s):
+            container[sub] += s
+
+        for cls in (Class, Slots):
+            obj = cls()
+            obj.buf = ""
+            for _ in range(100):
+                add_attr(obj, "ab")
+            with self.assertRaises(MemoryError):
+                _testcapi.set_nomemory(0)
+                try:
+                    add_attr(obj, "cd")
+                finally:
+                    _testcapi.remove_mem_hooks()
+            self.assertEqual(obj.buf, "ab" * 100)
+
+        for container, sub in (({"k": ""}, "k"), ([""], 0), ([""], -1)):
+            for _ in range(100):
+                add_item(container, sub, "ab")
+            with self.assertRaises(MemoryError):
+                _testcapi.set_nomemory(0)
+                try:
+                    add_item(container, sub, "cd")
+                finally:
+                    _testcapi.remove_mem_hooks()
+            self.assertEqual(container[sub], "ab" * 100)
+
+    def test_inplace_add_str_store_observes_old_value(self):
+        seen = []
+
+        class Class:
+            def __setattr__(self, name, value):
+                seen.append(getattr(self, name, None))
+                object.__setattr__(self, name, value)
+
+        class Dict(dict):
+            def __setitem__(self, key, value):
+                seen.append(self[key])
+                dict.__setitem__(self, key, value)
+
+        obj = Class()
+        obj.buf = ""
+        d = Dict(k="")
+        for _ in range(1025):
+            obj.buf += "ab"
+            d["k"] += "ab"
+        self.assertEqual(obj.buf, "ab" * 1025)
+        self.assertEqual(d["k"], "ab" * 1025)
+        self.assertNotIn(None, seen[1:])
+        self.assertEqual(seen[-2:], ["ab" * 1024] * 2)
+
+    def test_inplace_add_str_key_eq_observes_old_value(self):
+        seen = []
+        d = {}
+
+        class Key:
+            def __eq__(self, other):
+                seen.extend(d.values())
+                return False
+
+            def __hash__(self):
+                return hash("k")
+
+        d[Key()] = ""
+        d["k"] = ""
+        for _ in range(1025):
+            d["k"] += "ab"
+        self.assertEqual(d["k"], "ab" * 1025)
+        self.assertTrue(seen)
+        self.assertNotIn(None, seen)
+
+
 if __name__ == "__main__":
     import unittest
     unittest.main()
@@ -1,5 +1,6 @@
 import unittest
 import string
+import struct
 import subprocess
 import sys
 import sysconfig
@@ -13,6 +14,11 @@
 )
 from test.support.os_helper import temp_dir
 
+try:
+    import _testinternalcapi
+except ImportError:
+    _testinternalcapi = None
+
 
 if not support.has_subprocess_support:
     raise unittest.SkipTest("test module requires subprocess")
@@ -29,16 +35,60 @@ def supports_trampoline_profiling():
     raise unittest.SkipTest("perf trampoline profiling not supported")
 
 
+JITDUMP_MAGIC = 0x4A695444
+JIT_CODE_LOAD = 0
+JIT_CODE_DEBUG_INFO = 2
+
+
+def read_jitdump(path):
+    """Parse a jitdump file into its header and a list of code loads.
+
+    Every code load is a (pid, name, code_addr, code, lines) tuple where
+    *lines* is the list of (filename, lineno) entries of the line table
+    that precedes it.
+    """
+    data = path.read_bytes()
+    header = struct.unpack_from("<IIIIIIQQ", data)
+    magic, version, header_size, _, _, pid, _, _ = header
+    loads = []
+    lines = []
+    offset = header_size
+    while offset < len(data):
+        record_id, size, _ = struct.unpack_from("<IIQ", data, offset)
+        body = offset + 16
+        if record_id == JIT_CODE_DEBUG_INFO:
+            _, nr_entry = struct.unpack_from("<QQ", data, body)
+            entry = body + 16
+            lines = []
+            for _ in range(nr_entry):
+                _, lineno, _ = struct.unpack_from("<QII", data, entry)
+                end = data.index(b"\0", entry + 16)
+                lines.append((data[entry + 16:end].decode(), lineno))
+                entry = end + 1
+        elif record_id == JIT_CODE_LOAD:
+            load_pid, _, _, code_addr, code_size, _ = struct.unpack_from(
+                "<IIQQQQ", data, body)
+            end = data.index(b"\0", body + 40)
+            name = data[body + 40:end].decode()
+            code = data[end + 1:end + 1 + code_size]
+            loads.append((load_pid, name, code_addr, code, lines))
+            lines = []
+        offset += size
+    return (magic, version, pid), loads
+
+
 class TestPerfTrampoline(unittest.TestCase):
     def setUp(self):
         super().setUp()
         self.perf_files = set(pathlib.Path("/tmp/").glob("perf-*.map"))
+        self.perf_files |= set(pathlib.Path("/tmp/").glob("jit-*.dump"))
 
     def tearDown(self) -> None:
         super().tearDown()
         files_to_delete = (
-            set(pathlib.Path("/tmp/").glob("perf-*.map")) - self.perf_files
-        )
+            set(pathlib.Path("/tmp/").glob("perf-*.map"))
+            | set(pathlib.Path("/tmp/").glob("jit-*.dump"))
+        ) - self.perf_files
         for file in files_to_delete:
             file.unlink()
 
@@ -180,6 +230,182 @@ def baz():
         self.assertIn(f"py::bar:{script}", perf_file_contents)
         self.assertIn(f"py::baz:{script}", perf_file_contents)
 
+    def test_jitdump_works(self):
+        code = """if 1:
+                def foo():
+                    pass
+
+                def bar():
+                    foo()
+
+                bar()
+                """
+        with temp_dir() as script_dir:
+            script = make_script(script_dir, "perftest", code)
+            for args, env in [(["-Xperf_jit"], {}),
+                              ([], {"PYTHON_PERF_JIT_SUPPORT": "1"})]:
+                with self.subTest(args=args, env=env):
+                    env = dict(os.environ, **env)
+                    with subprocess.Popen(
+                        [sys.executable, *args, script],
+                        text=True,
+                        stderr=subprocess.PIPE,
+                        stdout=subprocess.PIPE,
+                        env=env,
+                    ) as process:
+                        stdout, stderr = process.communicate()
+
+                    self.assertEqual(stderr, "")
+                    self.assertEqual(stdout, "")
+                    self.assertFalse(
+                        pathlib.Path(f"/tmp/perf-{process.pid}.map").exists())
+                    jit_file = pathlib.Path(f"/tmp/jit-{process.pid}.dump")
+                    (magic, version, pid), loads = read_jitdump(jit_file)
+                    self.assertEqual(magic, JITDUMP_MAGIC)
+                    self.assertEqual(version, 1)
+                    self.assertEqual(pid, process.pid)
+                    by_name = {load[1]: load for load in loads}
+                    for name, lineno in [("foo", 2), ("bar", 5)]:
+                        load = by_name[f"py::{name}:{script}"]
+                        load_pid, _, code_addr, code, lines = load
+                        self.assertEqual(load_pid, process.pid)
+                        self.assertNotEqual(code_addr, 0)
+                        self.assertTrue(code)
+                        self.assertEqual(lines, [(script, lineno)])
+                    # All trampolines are copies of the same code.
+                    self.assertEqual(len({load[3] for load in loads}), 1)
+
+    def test_jitdump_sys_api(self):
+        code = """if 1:
+                import sys
+                def foo():
+                    pass
+
+                sys.activate_stack_trampoline("perf_jit")
+                assert sys.is_stack_trampoline_active() is True
+                foo()
+                sys.deactivate_stack_trampoline()
+                assert sys.is_stack_trampoline_active() is False
+                """
+        with temp_dir() as script_dir:
+            script = make_script(script_dir, "perftest", code)
+            with subprocess.Popen(
+                [sys.executable, script],
+                text=True,
+                stderr=subprocess.PIPE,
+                stdout=subprocess.PIPE,
+            ) as process:
+                stdout, stderr = process.communicate()
+
+        self.assertEqual(stderr, "")
+        self.assertEqual(process.returncode, 0)
+        _, loads = read_jitdump(pathlib.Path(f"/tmp/jit-{process.pid}.dump"))
+        self.assertIn(f"py::foo:{script}", [load[1] for load in loads])
+
+    def _run_forking_script(self, backend, persist, remove_parent_file=False):
+        code = f"""if 1:
+                import os, sys
+                import _testinternalcapi
+
+                def remove_parent_file():
+                    if {backend!r} == "perf":
+                        os.unlink(f"/tmp/perf-{{os.getpid()}}.map")
+                    else:
+                        os.unlink(f"/tmp/jit-{{os.getpid()}}.dump")
+
+                def before_fork():
+                    pass
+
+                def after_fork():
+                    pass
+
+                sys.activate_stack_trampoline({backend!r})
+                _testinternalcapi.perf_trampoline_set_persist_after_fork({persist})
+                before_fork()
+                if {remove_parent_file}:
+                    remove_parent_file()
+                pid = os.fork()
+                if pid == 0:
+                    print(os.getpid())
+                    after_fork()
+                else:
+                    _, status = os.waitpid(-1, 0)
+                    sys.exit(status)
+                """
+        with temp_dir() as script_dir:
+            script = make_script(script_dir, "perftest", code)
+            with subprocess.Popen(
+                [sys.executable, script],
+                text=True,
+                stderr=subprocess.PIPE,
+                stdout=subprocess.PIPE,
+            ) as process:
+                stdout, stderr = process.communicate()
+
+        self.assertEqual(process.returncode, 0)
+        if remove_parent_file:
+            self.assertIn("RuntimeWarning: cannot copy the", stderr)
+        else:
+            self.assertEqual(stderr, "")
+        return script, process.pid, int(stdout.strip())
+
+    @support.requires_fork()
+    @unittest.skipIf(_testinternalcapi is None, "requires _testinternalcapi")
+    def test_trampoline_persists_after_fork(self):
+        script, pid, child_pid = self._run_forking_script("perf", 1)
+        parent = pathlib.Path(f"/tmp/perf-{pid}.map").read_text()
+        child = pathlib.Path(f"/tmp/perf-{child_pid}.map").read_text()
+        before = next(line for line in parent.splitlines()
+                      if f"py::before_fork:{script}" in line)
+        # The child reuses the trampoline compiled by the parent.
+        self.assertIn(before, child.splitlines())
+        self.assertIn(f"py::after_fork:{script}", child)
+        self.assertNotIn(f"py::after_fork:{script}", parent)
+
+    @support.requires_fork()
+    @unittest.skipIf(_testinternalcapi is None, "requires _testinternalcapi")
+    def test_jitdump_persists_after_fork(self):
+        for persist in (0, 1):
+            with self.subTest(persist=persist):
+                script, pid, child_pid = self._run_forking_script(
+                    "perf_jit", persist)
+                _, parent = read_jitdump(
+                    pathlib.Path(f"/tmp/jit-{pid}.dump"))
+                (_, _, header_pid), child = read_jitdump(
+                    pathlib.Path(f"/tmp/jit-{child_pid}.dump"))
+                self.assertEqual(header_pid, child_pid)
+                self.assertTrue(all(load[0] == child_pid for load in child))
+                parent_addrs = {load[1]: load[2] for load in parent}
+                child_addrs = {load[1]: load[2] for load in child}
+                self.assertIn(f"py::after_fork:{script}", child_addrs)
+                before = f"py::before_fork:{script}"
+                if persist:
+                    self.assertEqual(child_addrs[before], parent_addrs[before])
+                else:
+                    self.assertNotIn(before, child_addrs)
+
+    @support.requires_fork()
+    @unittest.skipIf(_testinternalcapi is None, "requires _testinternalcapi")
+    def test_persist_after_fork_without_parent_file(self):
+        # Without the file of the parent to copy, the child warns and starts
+        # a file of its own, as without persist_after_fork.
+        for backend in ("perf", "perf_jit"):
+            with self.subTest(backend=backend):
+                script, pid, child_pid = self._run_forking_script(
+                    backend, 1, remove_parent_file=True)
+                if backend == "perf":
+                    child = pathlib.Path(
+                        f"/tmp/perf-{child_pid}.map").read_text()
+                    names = [line.split(" ", 2)[2]
+                             for line in child.splitlines()]
+                else:
+                    (_, _, header_pid), loads = read_jitdump(
+                        pathlib.Path(f"/tmp/jit-{child_pid}.dump"))
+                    self.assertEqual(header_pid, child_pid)
+                    names = [load[1] for load in loads]
+                self.assertIn(f"py::after_fork:{script}", names)
+                self.assertNotIn(f"py::before_fork:{script}", names)
+
     def test_sys_api_with_existing_trampoline(self):
         code = """if 1:
                 import sys
@@ -0,0 +1,235 @@
+"""Test suite for the sampleprof module."""
+
+import pstats
+import time
+import unittest
+from test.support import import_helper, os_helper, threading_helper
+from test.support.script_helper import assert_python_ok, assert_python_failure
+
+_sampleprof = import_helper.import_module('_sampleprof')
+import sampleprof
+
+
+def busy(seconds):
+    deadline = time.monotonic() + seconds
+    while time.monotonic() < deadline:
+        pass
+
+def caller(seconds):
+    busy(seconds)
+
+def recursive(n, seconds):
+    if n:
+        return recursive(n - 1, seconds)
+    busy(seconds)
+
+
+class SamplerTest(unittest.TestCase):
+    interval = 0.001
+
+    def sampler(self, **kwargs):
+        sampler = _sampleprof.Sampler(interval=self.interval, **kwargs)
+        # Make sure we clean ourselves up if the test fails for some reason.
+        self.addCleanup(sampler.stop)
+        return sampler
+
+    def sample(self, sampler, func, *args):
+        sampler.start()
+        try:
+            func(*args)
+        finally:
+            sampler.stop()
+
+    def test_defaults(self):
+        sampler = _sampleprof.Sampler()
+        self.assertEqual(sampler.interval, 0.01)
+        self.assertEqual(sampler.max_depth, 128)
+        self.assertTrue(sampler.all_threads)
+        self.assertFalse(sampler.running)
+        self.assertEqual(sampler.samples, 0)
+        self.assertEqual(sampler.dropped, 0)
+        self.assertEqual(sampler.get_stacks(), {})
+
+    def test_bad_arguments(self):
+        self.assertRaises(ValueError, _sampleprof.Sampler, interval=0)
+        self.assertRaises(ValueError, _sampleprof.Sampler, interval=-1)
+        self.assertRaises(ValueError, _sampleprof.Sampler, max_depth=0)
+        self.assertRaises(TypeError, _sampleprof.Sampler, interval="1")
+
+    def test_start_stop(self):
+        sampler = self.sampler()
+        sampler.start()
+        self.assertTrue(sampler.running)
+        # start() and stop() can be called twice.
+        sampler.start()
+        busy(0.05)
+        sampler.stop()
+        self.assertFalse(sampler.running)
+        sampler.stop()
+        samples = sampler.samples
+        self.assertGreater(samples, 0)
+        busy(0.01)
+        self.assertEqual(sampler.samples, samples)
+
+    def test_second_sampler(self):
+        sampler = self.sampler()
+        sampler.start()
+        other = self.sampler()
+        self.assertRaises(RuntimeError, other.start)
+        sampler.stop()
+        other.start()
+        other.stop()
+
+    def test_stacks(self):
+        sampler = self.sampler()
+        self.sample(sampler, caller, 0.1)
+        stacks = sampler.get_stacks()
+        self.assertGreater(len(stacks), 0)
+        self.assertLessEqual(sum(stacks.values()), sampler.samples)
+        for stack, count in stacks.items():
+            self.assertIsInstance(count, int)
+            for code, lineno in stack:
+                self.assertIsInstance(code, type(busy.__code__))
+                self.assertIsInstance(lineno, int)
+        # Most samples end in busy() called from caller().
+        names = {}
+        for stack, count in stacks.items():
+            key = tuple(code.co_name for code, lineno in stack[-2:])
+            names[key] = names.get(key, 0) + count
+        self.assertEqual(max(names, key=names.get), ('caller', 'busy'))
+        # Stacks start at the outermost frame.
+        longest = max(stacks, key=len)
+        self.assertIn(busy.__code__, [code for code, lineno in longest])
+        self.assertEqual(longest[-1][0], busy.__code__)
+
+    def test_line_numbers(self):
+        sampler = self.sampler()
+        self.sample(sampler, busy, 0.05)
+        first = busy.__code__.co_firstlineno
+        for stack in sampler.get_stacks():
+            code, lineno = stack[-1]
+            if code is busy.__code__:
+                self.assertIn(lineno - first, (1, 2, 3))
+
+    def test_max_depth(self):
+        sampler = self.sampler(max_depth=5)
+        self.sample(sampler, recursive, 20, 0.05)
+        stacks = sampler.get_stacks()
+        self.assertGreater(len(stacks), 0)
+        for stack in stacks:
+            self.assertLessEqual(len(stack), 5)
+        # The innermost frames are kept.
+        self.assertIn(busy.__code__, {stack[-1][0] for stack in stacks})
+
+    def test_clear(self):
+        sampler = self.sampler()
+        self.sample(sampler, busy, 0.05)
+        self.assertGreater(sampler.samples, 0)
+        sampler.clear()
+        self.assertEqual(sampler.samples, 0)
+        self.assertEqual(sampler.get_stacks(), {})
+
+    @threading_helper.requires_working_threading()
+    def test_all_threads(self):
+        import threading
+
+        sampler = self.sampler()
+        thread = threading.Thread(target=caller, args=(0.1,))
+        sampler.start()
+        try:
+            thread.start()
+            busy(0.1)
+            thread.join()
+        finally:
+            sampler.stop()
+        codes = {code for stack in sampler.get_stacks()
+                 for code, lineno in stack}
+        self.assertIn(caller.__code__, codes)
+
+    def test_stop_on_dealloc(self):
+        code = """if 1:
+            import _sampleprof
+            _sampleprof.Sampler(interval=0.001).start()
+        """
+        assert_python_ok("-c", code)
+
+
+class ProfileTest(unittest.TestCase):
+
+    def profile(self, func, *args):
+        prof = sampleprof.Profile(interval=0.001)
+        self.addCleanup(prof.disable)
+        prof.runcall(func, *args)
+        return prof
+
+    def test_context_manager(self):
+        prof = sampleprof.Profile(interval=0.001)
+        with prof as p:
+            self.assertIs(p, prof)
+            self.assertTrue(prof.running)
+            busy(0.01)
+        self.assertFalse(prof.running)
+
+    def test_stats(self):
+        prof = self.profile(caller, 0.1)
+        prof.create_stats()
+        busy_label = sampleprof.label(busy.__code__)
+        caller_label = sampleprof.label(caller.__code__)
+        cc, nc, tt, ct, callers = prof.stats[busy_label]
+        self.assertEqual(cc, nc)
+        self.assertGreater(tt, 0)
+        self.assertGreaterEqual(ct, tt)
+        self.assertIn(caller_label, callers)
+        cc, nc, tt, ct, callers = prof.stats[caller_label]
+        self.assertGreater(ct, tt)
+        # pstats understands the stats.
+        stats = pstats.Stats(prof)
+        self.assertIn(busy_label, stats.stats)
+
+    def test_recursion_counted_once(self):
+        prof = self.profile(recursive, 10, 0.05)
+        prof.create_stats()
+        cc, nc, tt, ct, callers = prof.stats[sampleprof.label(recursive.__code__)]
+        self.assertLessEqual(nc, prof.samples)
+
+    def test_dump_stats(self):
+        prof = self.profile(busy, 0.05)
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        prof.dump_stats(os_helper.TESTFN)
+        stats = pstats.Stats(os_helper.TESTFN)
+        self.assertIn(sampleprof.label(busy.__code__), stats.stats)
+
+    def test_folded(self):
+        prof = self.profile(caller, 0.05)
+        lines = prof.folded().splitlines()
+        self.assertGreater(len(lines), 0)
+        total = 0
+        for line in lines:
+            frames, count = line.rsplit(' ', 1)
+            total += int(count)
+            self.assertTrue(frames.split(';'))
+        self.assertLessEqual(total, prof.samples)
+        self.assertTrue(any(';caller (' in line and ';busy (' in line
+                            for line in lines))
+
+
+class TestCommandLine(unittest.TestCase):
+    def test_sort(self):
+        rc, out, err = assert_python_failure('-m', 'sampleprof', '-s', 'demo')
+        self.assertGreater(rc, 0)
+        self.assertIn(b"option -s: invalid choice: 'demo'", err)
+
+    def test_folded(self):
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        code = "import time\nt = time.monotonic()\nwhile time.monotonic() - t < 0.05: pass\n"
+        with open(os_helper.TESTFN + '.py', 'w') as f:
+            f.write(code)
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN + '.py')
+        assert_python_ok('-m', 'sampleprof', '-i', '0.001',
+                         '-f', os_helper.TESTFN, os_helper.TESTFN + '.py')
+        with open(os_helper.TESTFN) as f:
+            self.assertIn('<module>', f.read())
+
+
+if __name__ == "__main__":
+    unittest.main()
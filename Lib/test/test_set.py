@@ -340,6 +340,29 @@ def test_do_not_rehash_dict_keys(self):
         self.assertEqual(sum(elem.hash_count for elem in d), n)
         self.assertEqual(d3, dict.fromkeys(d, 123))
 
+    def test_do_not_rehash_dict_keys_view(self):
+        class D(dict):
+            def __iter__(self):
+                raise AssertionError('keys views iterate the table')
+        n = 10
+        d = D.fromkeys(map(HashCountingInt, range(n)))
+        count = lambda: sum(elem.hash_count for elem in d.keys())
+        self.assertEqual(count(), n)
+        s = self.thetype(d.keys())
+        self.assertEqual(s, self.thetype(range(n)))
+        self.assertEqual(count(), n)
+        self.assertEqual(s.intersection(d.keys()), s)
+        self.assertEqual(s.difference(d.keys()), self.thetype())
+        self.assertEqual(self.thetype(range(2*n)).difference(d.keys()),
+                         self.thetype(range(n, 2*n)))
+        self.assertEqual(count(), n)
+        if hasattr(s, 'symmetric_difference_update'):
+            s.difference_update(d.keys())
+            self.assertEqual(s, set())
+            s.symmetric_difference_update(d.keys())
+            self.assertEqual(s, set(range(n)))
+        self.assertEqual(count(), n)
+
     def test_container_iterator(self):
         # Bug #3680: tp_traverse was not implemented for set iterator object
         class C(object):
@@ -1,7 +1,10 @@
 from test import support
+from test.support import import_helper, threading_helper
 import random
+import sys
 import unittest
 from functools import cmp_to_key
+from operator import itemgetter
 
 verbose = support.verbose
 nerrors = 0
@@ -384,6 +387,153 @@ def test_none_in_tuples(self):
         actual = sorted([(None, 2), (None, 1)])
         self.assertEqual(actual, expected)
 
+class TestRadixSort(unittest.TestCase):
+    # Lists of 256 ints, floats or latin-1 strs or more are sorted by radix,
+    # unless they look mostly sorted.  Tuples of one key are always sorted by
+    # the mergesort, which gives the expected results.
+
+    def check(self, L, **kwargs):
+        expected = [x for x, in sorted([(x,) for x in L], **kwargs)]
+        actual = sorted(L, **kwargs)
+        self.assertEqual(len(actual), len(expected))
+        for a, e in zip(actual, expected):
+            self.assertIs(a, e)
+        expected = sorted(zip(L, range(len(L))), key=lambda p: (p[0],),
+                          **kwargs)
+        actual = sorted(zip(L, range(len(L))), key=itemgetter(0), **kwargs)
+        self.assertEqual(actual, expected)
+
+    def test_ints(self):
+        rng = random.Random(0)
+        for n in 256, 1000, 20_000:
+            for bits in 4, 12, 29:
+                L = [rng.randrange(-1 << bits, 1 << bits) + 0
+                     for _ in range(n)]
+                with self.subTest(n=n, bits=bits):
+                    self.check(L)
+                    self.check(L, reverse=True)
+        self.check([rng.randrange(1000, 1010) for _ in range(1000)])
+        self.check([-2**30 + 1, 2**30 - 1] * 500)
+
+    def test_floats(self):
+        rng = random.Random(0)
+        specials = [0.0, -0.0, float('inf'), float('-inf'),
+                    5e-324, -5e-324, 1.7976931348623157e308]
+        L = [rng.choice(specials) if rng.random() < 0.3 else
+             rng.uniform(-1e6, 1e6) for _ in range(5000)]
+        self.check(L)
+        self.check(L, reverse=True)
+        self.check([rng.randrange(10) / 4 for _ in range(1000)])
+        L[::10] = [float('nan')] * len(L[::10])
+        self.check(L)
+
+    def test_strs(self):
+        rng = random.Random(0)
+        alphabet = 'ab\xe9\xff\x00'
+        L = [''.join(rng.choice(alphabet) for _ in range(rng.randrange(8)))
+             for _ in range(5000)]
+        self.check(L)
+        self.check(L, reverse=True)
+        L = [str(rng.randrange(10**6)) for _ in range(5000)]
+        self.check(L)
+        # Groups of more than 32 strs at every depth.
+        L = ['a' * k + 'b' + str(rng.randrange(100))
+             for k in range(40) for _ in range(50)]
+        rng.shuffle(L)
+        self.check(L)
+        # A long common prefix.
+        L = ['x' * 1000 + str(rng.randrange(10**6)) for _ in range(1000)]
+        self.check(L)
+
+    def test_mostly_sorted(self):
+        L = list(range(0, 20_000, 2))
+        L[::100] = range(1, 20_000, 200)
+        self.check(L)
+        self.check([str(x) for x in L])
+
+    def test_chunks(self):
+        # Lists of more than 2**18 keys are sorted by radix in chunks, which
+        # the mergesort merges.
+        rng = random.Random(0)
+        n = 2 * 2**18 + 1000
+        L = [rng.randrange(-1 << 20, 1 << 20) for _ in range(n)]
+        self.check(L)
+        self.check([x / 7 for x in L])
+        self.check([str(x) for x in L[:2**18 + 1]])
+        # A NaN in the last chunk sends all keys to the mergesort.
+        L = [rng.random() for _ in range(n)]
+        L[-10] = float('nan')
+        self.check(L)
+
+    @support.cpython_only
+    def test_no_memory(self):
+        # Without memory for the radix sort, the mergesort sorts the list.
+        # 300 keys in random order need no more than its temp array.
+        _testcapi = import_helper.import_module('_testcapi')
+        rng = random.Random(0)
+        for L in ([rng.randrange(1000) for _ in range(300)],
+                  [rng.random() for _ in range(300)],
+                  [str(rng.randrange(1000)) for _ in range(300)]):
+            expected = sorted(L)
+            _testcapi.set_nomemory(0)
+            try:
+                L.sort()
+            finally:
+                _testcapi.remove_mem_hooks()
+            self.assertEqual(L, expected)
+
+
+@threading_helper.requires_working_threading()
+class TestParallelSort(unittest.TestCase):
+    # Parallel sorting only applies to lists of 65,536 keys or more, which
+    # 5 threads split into an odd number of chunks.
+    size = 200_000
+
+    def setUp(self):
+        self.addCleanup(sys._set_sort_threads, sys._get_sort_threads())
+        sys._set_sort_threads(5)
+
+    def check(self, L, **kwargs):
+        sys._set_sort_threads(1)
+        expected = sorted(L, **kwargs)
+        sys._set_sort_threads(5)
+        actual = sorted(L, **kwargs)
+        self.assertEqual(len(actual), len(expected))
+        for a, e in zip(actual, expected):
+            self.assertIs(a, e)
+
+    def test_set_sort_threads(self):
+        self.assertEqual(sys._get_sort_threads(), 5)
+        sys._set_sort_threads(1)
+        self.assertEqual(sys._get_sort_threads(), 1)
+        self.assertRaises(ValueError, sys._set_sort_threads, 0)
+        self.assertRaises(ValueError, sys._set_sort_threads, -1)
+        self.assertRaises(TypeError, sys._set_sort_threads, 1.5)
+        self.assertEqual(sys._get_sort_threads(), 1)
+        sys._set_sort_threads(10**6)
+        self.assertEqual(sys._get_sort_threads(), 64)
+
+    def test_keys(self):
+        rng = random.Random(0)
+        ints = [rng.randrange(-1 << 29, 1 << 29) for _ in range(self.size)]
+        # Many equal floats, which are distinct objects.
+        floats = [rng.randrange(1000) / 8 for _ in range(self.size)]
+        strs = [str(x) for x in ints]
+        for L in ints, floats, strs:
+            for reverse in False, True:
+                with self.subTest(type=type(L[0]), reverse=reverse):
+                    self.check(L, reverse=reverse)
+                    self.check(sorted(L), reverse=reverse)
+                    self.check(sorted(L, reverse=True), reverse=reverse)
+
+    def test_stability(self):
+        rng = random.Random(0)
+        data = [(rng.randrange(100), i) for i in range(self.size)]
+        self.check(data, key=itemgetter(0))
+        self.check(data, key=itemgetter(0), reverse=True)
+        data = [(str(k), i) for k, i in data]
+        self.check(data, key=itemgetter(0))
+
 #==============================================================================
 
 if __name__ == "__main__":
@@ -955,12 +955,47 @@ def test_debugmallocstats(self):
                 self.assertIn(b"free PyDictObjects", err)
             if with_pymalloc:
                 self.assertIn(b'Small block threshold', err)
+                self.assertIn(b'# thread cache hits', err)
+                self.assertIn(b'# pools returned to the OS', err)
             if not with_freelists and not with_pymalloc:
                 self.assertFalse(err)
 
         # The function has no parameter
         self.assertRaises(TypeError, sys._debugmallocstats, True)
 
+    def test_alloc_census(self):
+        class Point:
+            pass
+
+        self.assertRaises(ValueError, sys._start_alloc_census, 0)
+        sys._start_alloc_census(1)
+        try:
+            kept = []
+            for i in range(1000):
+                point = Point()
+                if i % 4 == 0:
+                    kept.append(point)
+            del point
+        finally:
+            sys._stop_alloc_census()
+        census = sys._get_alloc_census()
+        stats = [entry for entry in census if entry[0] is Point]
+        self.assertEqual(len(stats), 1)
+        _, size, allocated, freed, lifetime = stats[0]
+        if support.with_pymalloc():
+            self.assertGreaterEqual(size, Point.__basicsize__)
+        else:
+            self.assertIsNone(size)
+        self.assertEqual(allocated, 1000)
+        self.assertEqual(freed, 750)
+        self.assertGreater(lifetime, 0)
+
+        # The statistics are kept until the next census
+        self.assertEqual(sys._get_alloc_census(), census)
+        sys._start_alloc_census()
+        sys._stop_alloc_census()
+        self.assertNotIn(Point, [entry[0] for entry in sys._get_alloc_census()])
+
     @unittest.skipUnless(hasattr(sys, "getallocatedblocks"),
                          "sys.getallocatedblocks unavailable on this build")
     def test_getallocatedblocks(self):
@@ -1574,8 +1609,8 @@ class newstyleclass(object): pass
         o.a = o.b = o.c = o.d = o.e = o.f = o.g = o.h = 1
         # Separate block for PyDictKeysObject with 16 keys and 10 entries
         check(newstyleclass, s + calcsize(DICT_KEY_STRUCT_FORMAT) + 64 + 42*calcsize("2P"))
-        # dict with shared keys
-        check(newstyleclass().__dict__, size('nQ2P') + self.P)
+        # dict with shared keys, with room for the values of the 8 keys
+        check(newstyleclass().__dict__, size('nQ2P') + 8*self.P)
         # unicode
         # each tuple contains a string and its expected character size
         # don't put any static strings here, as they may contain
@@ -375,6 +375,72 @@ def g():
         self.assertNotIn("test_tracemalloc", traceback[-2].filename)
 
 
+class TestSampling(unittest.TestCase):
+    def setUp(self):
+        if tracemalloc.is_tracing():
+            self.skipTest("tracemalloc must be stopped before the test")
+
+    def tearDown(self):
+        tracemalloc.stop()
+
+    def test_sampling_interval(self):
+        self.assertEqual(tracemalloc.get_sampling_interval(), 0)
+        tracemalloc.start(1, sampling_interval=4096)
+        self.assertEqual(tracemalloc.get_sampling_interval(), 4096)
+        tracemalloc.stop()
+        self.assertEqual(tracemalloc.get_sampling_interval(), 0)
+        tracemalloc.start(1)
+        self.assertEqual(tracemalloc.get_sampling_interval(), 0)
+        tracemalloc.stop()
+        with self.assertRaises(ValueError):
+            tracemalloc.start(1, sampling_interval=-1)
+        self.assertFalse(tracemalloc.is_tracing())
+
+    def test_sample_some_blocks(self):
+        tracemalloc.start(1, sampling_interval=64 * 1024)
+        data = [allocate_bytes(100)[0] for _ in range(10000)]
+        traces = tracemalloc.take_snapshot().traces
+        # About 1 MB in blocks of 100 bytes: around 16 samples, not 10000.
+        self.assertLess(len(traces), 1000)
+
+    def test_estimated_size(self):
+        interval = 8 * 1024
+        size = 200
+        count = 20000
+        tracemalloc.start(1, sampling_interval=interval)
+        data = [allocate_bytes(size)[0] for _ in range(count)]
+        snapshot = tracemalloc.take_snapshot()
+        filename = allocate_bytes.__code__.co_filename
+        estimate = sum(stat.size for stat in snapshot.statistics('filename')
+                       if stat.traceback[0].filename == filename)
+        # About 490 samples: the estimate is within a few percent of
+        # the allocated size with overwhelming probability.
+        expected = size * count
+        self.assertGreater(estimate, expected * 0.75)
+        self.assertLess(estimate, expected * 1.25)
+        # Every sample accounts for at least the size of its block.
+        for trace in snapshot.traces:
+            if trace.traceback[0].filename == filename:
+                self.assertGreaterEqual(trace.size, size)
+
+    def test_large_blocks_always_sampled(self):
+        tracemalloc.start(1, sampling_interval=1024)
+        obj_size = 1024 * 1024
+        # The probability to miss the block is exp(-1024).
+        obj, obj_traceback = allocate_bytes(obj_size)
+        self.assertEqual(tracemalloc.get_object_traceback(obj), obj_traceback)
+
+    def test_free_untraces(self):
+        tracemalloc.start(1, sampling_interval=1024)
+        data = [allocate_bytes(64 * 1024)[0] for _ in range(10)]
+        size, peak = tracemalloc.get_traced_memory()
+        self.assertGreaterEqual(size, 10 * 64 * 1024)
+        del data
+        size2, peak2 = tracemalloc.get_traced_memory()
+        self.assertLess(size2, size - 9 * 64 * 1024)
+        self.assertGreaterEqual(peak2, peak)
+
+
 class TestSnapshot(unittest.TestCase):
     maxDiff = 4000
 
@@ -287,6 +287,41 @@ def test_find(self):
         self.checkequal(-1, 'a' * 100, 'find', 'a\U00100304')
         self.checkequal(-1, '\u0102' * 100, 'find', '\u0102\U00100304')
 
+    # Map the ASCII text of the block tests of string_tests to each kind
+    WIDEN = [{c: c + shift for c in range(128)}
+             for shift in (0x80, 0x100, 0x10000)]
+
+    def test_find_short_needle_blocks(self):
+        string_tests.CommonTest.test_find_short_needle_blocks(self)
+        for table in self.WIDEN:
+            self._check_short_needles(lambda s: s.translate(table))
+
+    def test_find_short_needle_switch(self):
+        string_tests.CommonTest.test_find_short_needle_switch(self)
+        for table in self.WIDEN:
+            self._check_short_needle_switch(lambda s: s.translate(table))
+
+    def test_count_char_blocks(self):
+        string_tests.CommonTest.test_count_char_blocks(self)
+        for table in self.WIDEN:
+            self._check_count_char_blocks(lambda s: s.translate(table))
+
+    def test_split_whitespace_blocks(self):
+        string_tests.CommonTest.test_split_whitespace_blocks(self)
+        # whitespace of the 1-byte kind beyond ASCII, and characters next
+        # to it which are not
+        for n in range(1, 40):
+            word = '\xe9' * n
+            with self.subTest(n=n):
+                for p in range(n):
+                    for space in '\x1f', '\x85', '\xa0':
+                        text = word[:p] + space + word[p + 1:]
+                        self.checkequal([s for s in (word[:p], word[p + 1:])
+                                         if s], text, 'split')
+                    for other in '\x84', '\x86', '\xa1':
+                        text = word[:p] + other + word[p + 1:]
+                        self.checkequal([text], text, 'split')
+
     def test_rfind(self):
         string_tests.CommonTest.test_rfind(self)
         # test implementation details of the memrchr fast path
@@ -0,0 +1,635 @@
+/* Statistical sampling profiler.
+
+   Unlike _lsprof, which gets a callback on every call and return, this
+   profiler looks at the running program only every *interval* seconds, so
+   its overhead does not depend on how many calls the program makes.
+
+   A native timer thread wakes up every interval and asks the interpreter
+   for a sample using the pending call mechanism.  At its next safe point
+   (the same points where signal handlers run), whichever thread of the
+   interpreter holds the GIL runs sample_callback(), which walks the
+   _PyInterpreterFrame chain of every thread state of the interpreter.
+   Frames are only read while the GIL is held, so they are consistent, and
+   threads that are blocked in a call with the GIL released are reported
+   with the stack they had when they released it.
+
+   Taking a sample neither runs Python code nor allocates memory: it appends
+   (code object, instruction offset) entries to a preallocated buffer.  The
+   buffer is aggregated into a dict of stacks when it fills up and when the
+   results are requested.  Only one sampler can run at a time, and only in
+   the main interpreter.
+*/
+
+#ifndef Py_BUILD_CORE_BUILTIN
+#  define Py_BUILD_CORE_MODULE 1
+#endif
+
+#include "Python.h"
+#include "pycore_atomic.h"        // _Py_atomic_int
+#include "pycore_ceval.h"         // _PyEval_AddPendingCall()
+#include "pycore_frame.h"         // _PyInterpreterFrame
+#include "pycore_pystate.h"       // HEAD_LOCK()
+#include "structmember.h"         // PyMemberDef
+
+#ifdef HAVE_UNISTD_H
+#  include <unistd.h>             // getpid()
+#endif
+
+/* Number of entries of the sample buffer.  A sample uses one entry per
+   frame of every thread plus one header entry per thread. */
+#define SAMPLE_BUFFER_SIZE (1 << 16)
+
+#define DEFAULT_MAX_DEPTH 128
+
+typedef struct {
+    /* Strong reference to the code object of the frame, or NULL for the
+       header entry that starts the stack of a thread. */
+    PyCodeObject *code;
+    /* Index of the last instruction of the frame, or the number of frames
+       that follow a header entry. */
+    int value;
+} sample_entry;
+
+typedef struct {
+    PyObject_HEAD
+    _PyTime_t interval;
+    int max_depth;
+    int all_threads;
+
+    sample_entry *buffer;
+    Py_ssize_t buffer_used;
+    /* dict: tuple (code, lineno, code, lineno, ...) of a stack from its
+       root to its leaf -> number of times it was sampled */
+    PyObject *stacks;
+    Py_ssize_t samples;
+    Py_ssize_t dropped;
+
+    int running;
+#ifdef HAVE_FORK
+    pid_t pid;                  // Process that started the timer thread
+#endif
+    PyInterpreterState *interp;
+    PyThread_type_lock stop_lock;  // Held while the timer thread runs
+    PyThread_type_lock done_lock;  // Released by the timer thread on exit
+    _Py_atomic_int sample_pending;
+} SamplerObject;
+
+typedef struct {
+    PyTypeObject *sampler_type;
+} _sampleprof_state;
+
+static inline _sampleprof_state*
+_sampleprof_get_state(PyObject *module)
+{
+    void *state = PyModule_GetState(module);
+    assert(state != NULL);
+    return (_sampleprof_state *)state;
+}
+
+/* The running sampler.  It is only accessed with the GIL held. */
+static SamplerObject *active_sampler = NULL;
+
+
+/*** Taking samples ***/
+
+static void
+record_thread(SamplerObject *self, PyThreadState *tstate)
+{
+    _PyInterpreterFrame *frame = _PyFrame_GetFirstComplete(
+        tstate->cframe->current_frame);
+    if (frame == NULL) {
+        return;
+    }
+    int depth = 0;
+    for (_PyInterpreterFrame *f = frame;
+         f != NULL && depth < self->max_depth;
+         f = _PyFrame_GetFirstComplete(f->previous))
+    {
+        depth++;
+    }
+    if (self->buffer_used + depth + 1 > SAMPLE_BUFFER_SIZE) {
+        self->dropped++;
+        return;
+    }
+    sample_entry *entry = &self->buffer[self->buffer_used];
+    entry->code = NULL;
+    entry->value = depth;
+    entry++;
+    /* Record the innermost frames when the stack is too deep. */
+    for (int i = 0; i < depth; i++) {
+        entry->code = (PyCodeObject *)Py_NewRef(frame->f_code);
+        entry->value = _PyInterpreterFrame_LASTI(frame);
+        entry++;
+        frame = _PyFrame_GetFirstComplete(frame->previous);
+    }
+    self->buffer_used += depth + 1;
+}
+
+/* Aggregate the buffer into self->stacks.  Return -1 with an exception set
+   on error; the samples left in the buffer are dropped then. */
+static int
+flush_buffer(SamplerObject *self)
+{
+    int res = 0;
+    Py_ssize_t i = 0;
+    while (i < self->buffer_used) {
+        assert(self->buffer[i].code == NULL);
+        int depth = self->buffer[i].value;
+        sample_entry *frames = &self->buffer[i + 1];
+        i += depth + 1;
+        if (res < 0) {
+            goto release;
+        }
+        PyObject *key = PyTuple_New(2 * depth);
+        if (key == NULL) {
+            res = -1;
+            goto release;
+        }
+        for (int j = 0; j < depth; j++) {
+            /* The buffer goes from the leaf to the root, keys the other
+               way around. */
+            sample_entry *e = &frames[depth - 1 - j];
+            int line = PyCode_Addr2Line(e->code,
+                                        e->value * sizeof(_Py_CODEUNIT));
+            PyObject *lineno = PyLong_FromLong(line);
+            if (lineno == NULL) {
+                Py_DECREF(key);
+                res = -1;
+                goto release;
+            }
+            PyTuple_SET_ITEM(key, 2 * j, Py_NewRef(e->code));
+            PyTuple_SET_ITEM(key, 2 * j + 1, lineno);
+        }
+        PyObject *count = PyDict_GetItemWithError(self->stacks, key);
+        if (count == NULL && PyErr_Occurred()) {
+            Py_DECREF(key);
+            res = -1;
+            goto release;
+        }
+        Py_ssize_t n = count == NULL ? 0 : PyLong_AsSsize_t(count);
+        count = PyLong_FromSsize_t(n + 1);
+        if (count == NULL ||
+            PyDict_SetItem(self->stacks, key, count) < 0)
+        {
+            res = -1;
+        }
+        Py_XDECREF(count);
+        Py_DECREF(key);
+    release:
+        for (int j = 0; j < depth; j++) {
+            Py_DECREF(frames[j].code);
+        }
+    }
+    self->buffer_used = 0;
+    return res;
+}
+
+static void
+take_sample(SamplerObject *self)
+{
+    PyThreadState *current = _PyThreadState_GET();
+    if (self->all_threads) {
+        _PyRuntimeState *runtime = &_PyRuntime;
+        HEAD_LOCK(runtime);
+        for (PyThreadState *t = current->interp->threads.head;
+             t != NULL; t = t->next)
+        {
+            record_thread(self, t);
+        }
+        HEAD_UNLOCK(runtime);
+    }
+    else {
+        record_thread(self, current);
+    }
+    self->samples++;
+
+    if (self->buffer_used > SAMPLE_BUFFER_SIZE / 4 * 3) {
+        if (flush_buffer(self) < 0) {
+            /* Never propagate an error into the sampled code. */
+            PyErr_Clear();
+            self->dropped++;
+        }
+    }
+}
+
+/* Pending call scheduled by the timer thread. */
+static int
+sample_callback(void *Py_UNUSED(arg))
+{
+    SamplerObject *self = active_sampler;
+    if (self == NULL) {
+        /* Stopped since the sample was requested. */
+        return 0;
+    }
+    _Py_atomic_store_relaxed(&self->sample_pending, 0);
+    take_sample(self);
+    return 0;
+}
+
+static void
+timer_thread(void *arg)
+{
+    SamplerObject *self = (SamplerObject *)arg;
+    PY_TIMEOUT_T timeout = (PY_TIMEOUT_T)_PyTime_AsMicroseconds(
+        self->interval, _PyTime_ROUND_CEILING);
+    /* stop_lock is released by stop(). */
+    while (PyThread_acquire_lock_timed(self->stop_lock, timeout, 0)
+           == PY_LOCK_FAILURE)
+    {
+        if (_Py_atomic_load_relaxed(&self->sample_pending)) {
+            /* The previous sample has not been taken yet. */
+            continue;
+        }
+        _Py_atomic_store_relaxed(&self->sample_pending, 1);
+        if (_PyEval_AddPendingCall(self->interp, sample_callback, NULL, 0) < 0) {
+            /* The queue of pending calls is full. */
+            _Py_atomic_store_relaxed(&self->sample_pending, 0);
+        }
+    }
+    PyThread_release_lock(self->stop_lock);
+    PyThread_release_lock(self->done_lock);
+}
+
+
+/*** Sampler methods ***/
+
+static int
+sampler_stop_thread(SamplerObject *self)
+{
+    if (!self->running) {
+        return 0;
+    }
+    self->running = 0;
+    assert(active_sampler == self);
+    active_sampler = NULL;
+    PyThread_release_lock(self->stop_lock);
+#ifdef HAVE_FORK
+    if (self->pid != getpid()) {
+        /* The timer thread was not copied into this forked child. */
+        PyThread_release_lock(self->done_lock);
+        Py_DECREF(self);
+        return 0;
+    }
+#endif
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(self->done_lock, WAIT_LOCK);
+    Py_END_ALLOW_THREADS
+    PyThread_release_lock(self->done_lock);
+    Py_DECREF(self);
+    return 0;
+}
+
+PyDoc_STRVAR(start_doc, "\
+start()\n\
+\n\
+Start taking samples.\n\
+");
+
+static PyObject *
+sampler_start(SamplerObject *self, PyObject *Py_UNUSED(ignored))
+{
+    if (self->running) {
+        Py_RETURN_NONE;
+    }
+    if (active_sampler != NULL) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "another sampler is already running");
+        return NULL;
+    }
+    self->interp = _PyInterpreterState_GET();
+    _Py_atomic_store_relaxed(&self->sample_pending, 0);
+    PyThread_acquire_lock(self->stop_lock, WAIT_LOCK);
+    PyThread_acquire_lock(self->done_lock, WAIT_LOCK);
+#ifdef HAVE_FORK
+    self->pid = getpid();
+#endif
+    if (PyThread_start_new_thread(timer_thread, self) == PYTHREAD_INVALID_THREAD_ID) {
+        PyThread_release_lock(self->done_lock);
+        PyThread_release_lock(self->stop_lock);
+        PyErr_SetString(PyExc_RuntimeError, "can't start the timer thread");
+        return NULL;
+    }
+    self->running = 1;
+    active_sampler = (SamplerObject *)Py_NewRef(self);
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(stop_doc, "\
+stop()\n\
+\n\
+Stop taking samples.  The samples taken so far are kept.\n\
+");
+
+static PyObject *
+sampler_stop(SamplerObject *self, PyObject *Py_UNUSED(ignored))
+{
+    if (sampler_stop_thread(self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static void
+discard_buffer(SamplerObject *self)
+{
+    for (Py_ssize_t i = 0; i < self->buffer_used; i++) {
+        Py_XDECREF(self->buffer[i].code);
+    }
+    self->buffer_used = 0;
+}
+
+PyDoc_STRVAR(clear_doc, "\
+clear()\n\
+\n\
+Forget all the samples taken so far.\n\
+");
+
+static PyObject *
+sampler_clear(SamplerObject *self, PyObject *Py_UNUSED(ignored))
+{
+    discard_buffer(self);
+    PyDict_Clear(self->stacks);
+    self->samples = 0;
+    self->dropped = 0;
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(get_stacks_doc, "\
+get_stacks() -> dict\n\
+\n\
+Return a dict mapping every sampled stack to the number of times it was\n\
+seen.  A stack is a tuple of (code, lineno) pairs that goes from the\n\
+outermost frame of a thread to the frame that was executing.\n\
+");
+
+static PyObject *
+sampler_get_stacks(SamplerObject *self, PyObject *Py_UNUSED(ignored))
+{
+    if (flush_buffer(self) < 0) {
+        return NULL;
+    }
+    PyObject *result = PyDict_New();
+    if (result == NULL) {
+        return NULL;
+    }
+    Py_ssize_t pos = 0;
+    PyObject *key, *count;
+    while (PyDict_Next(self->stacks, &pos, &key, &count)) {
+        Py_ssize_t depth = PyTuple_GET_SIZE(key) / 2;
+        PyObject *stack = PyTuple_New(depth);
+        if (stack == NULL) {
+            goto error;
+        }
+        for (Py_ssize_t i = 0; i < depth; i++) {
+            PyObject *frame = PyTuple_Pack(2, PyTuple_GET_ITEM(key, 2 * i),
+                                           PyTuple_GET_ITEM(key, 2 * i + 1));
+            if (frame == NULL) {
+                Py_DECREF(stack);
+                goto error;
+            }
+            PyTuple_SET_ITEM(stack, i, frame);
+        }
+        int err = PyDict_SetItem(result, stack, count);
+        Py_DECREF(stack);
+        if (err < 0) {
+            goto error;
+        }
+    }
+    return result;
+
+error:
+    Py_DECREF(result);
+    return NULL;
+}
+
+static PyObject *
+sampler_get_interval(SamplerObject *self, void *Py_UNUSED(closure))
+{
+    return PyFloat_FromDouble(_PyTime_AsSecondsDouble(self->interval));
+}
+
+static PyObject *
+sampler_get_running(SamplerObject *self, void *Py_UNUSED(closure))
+{
+    return PyBool_FromLong(self->running);
+}
+
+static PyMethodDef sampler_methods[] = {
+    {"start",       (PyCFunction)sampler_start,      METH_NOARGS, start_doc},
+    {"stop",        (PyCFunction)sampler_stop,       METH_NOARGS, stop_doc},
+    {"clear",       (PyCFunction)sampler_clear,      METH_NOARGS, clear_doc},
+    {"get_stacks",  (PyCFunction)sampler_get_stacks, METH_NOARGS, get_stacks_doc},
+    {NULL, NULL}
+};
+
+static PyGetSetDef sampler_getset[] = {
+    {"interval", (getter)sampler_get_interval, NULL,
+     PyDoc_STR("Time between two samples, in seconds.")},
+    {"running", (getter)sampler_get_running, NULL,
+     PyDoc_STR("True if the sampler is taking samples.")},
+    {NULL}
+};
+
+static PyMemberDef sampler_members[] = {
+    {"max_depth", T_INT, offsetof(SamplerObject, max_depth), READONLY,
+     PyDoc_STR("Maximum number of frames recorded per stack.")},
+    {"all_threads", T_BOOL, offsetof(SamplerObject, all_threads), READONLY,
+     PyDoc_STR("Whether the stacks of all threads are sampled.")},
+    {"samples", T_PYSSIZET, offsetof(SamplerObject, samples), READONLY,
+     PyDoc_STR("Number of samples taken.")},
+    {"dropped", T_PYSSIZET, offsetof(SamplerObject, dropped), READONLY,
+     PyDoc_STR("Number of stacks that could not be recorded.")},
+    {NULL}
+};
+
+static int
+sampler_init(SamplerObject *self, PyObject *args, PyObject *kw)
+{
+    PyObject *interval = NULL;
+    int max_depth = DEFAULT_MAX_DEPTH;
+    int all_threads = 1;
+    static char *kwlist[] = {"interval", "max_depth", "all_threads", 0};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kw, "|Oip:Sampler", kwlist,
+                                     &interval, &max_depth, &all_threads)) {
+        return -1;
+    }
+    if (self->running) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "cannot reinitialize a running sampler");
+        return -1;
+    }
+    _PyTime_t t = _PyTime_FromNanoseconds(10 * 1000 * 1000);
+    if (interval != NULL &&
+        _PyTime_FromSecondsObject(&t, interval, _PyTime_ROUND_CEILING) < 0)
+    {
+        return -1;
+    }
+    if (t <= 0) {
+        PyErr_SetString(PyExc_ValueError, "interval must be positive");
+        return -1;
+    }
+    if (max_depth < 1 || max_depth >= SAMPLE_BUFFER_SIZE) {
+        PyErr_Format(PyExc_ValueError,
+                     "max_depth must be in range [1, %d)", SAMPLE_BUFFER_SIZE);
+        return -1;
+    }
+    self->interval = t;
+    self->max_depth = max_depth;
+    self->all_threads = all_threads;
+
+    if (self->buffer == NULL) {
+        self->buffer = PyMem_RawMalloc(SAMPLE_BUFFER_SIZE * sizeof(sample_entry));
+        if (self->buffer == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+    }
+    if (self->stacks == NULL) {
+        self->stacks = PyDict_New();
+        if (self->stacks == NULL) {
+            return -1;
+        }
+    }
+    if (self->stop_lock == NULL) {
+        self->stop_lock = PyThread_allocate_lock();
+        self->done_lock = PyThread_allocate_lock();
+        if (self->stop_lock == NULL || self->done_lock == NULL) {
+            PyErr_SetString(PyExc_RuntimeError, "can't allocate lock");
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+sampler_traverse(SamplerObject *self, visitproc visit, void *arg)
+{
+    Py_VISIT(Py_TYPE(self));
+    Py_VISIT(self->stacks);
+    for (Py_ssize_t i = 0; i < self->buffer_used; i++) {
+        Py_VISIT(self->buffer[i].code);
+    }
+    return 0;
+}
+
+static void
+sampler_dealloc(SamplerObject *self)
+{
+    PyObject_GC_UnTrack(self);
+    /* A running sampler is referenced by active_sampler. */
+    assert(!self->running);
+    if (self->buffer != NULL) {
+        discard_buffer(self);
+        PyMem_RawFree(self->buffer);
+    }
+    Py_XDECREF(self->stacks);
+    if (self->stop_lock != NULL) {
+        PyThread_free_lock(self->stop_lock);
+    }
+    if (self->done_lock != NULL) {
+        PyThread_free_lock(self->done_lock);
+    }
+    PyTypeObject *tp = Py_TYPE(self);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+PyDoc_STRVAR(sampler_doc, "\
+Sampler(interval=0.01, max_depth=128, all_threads=True)\n\
+\n\
+    Builds a sampling profiler that records the Python stacks every\n\
+    interval seconds.  Stacks deeper than max_depth frames are cut to\n\
+    their innermost max_depth frames.  If all_threads is false, only\n\
+    the stack of the thread that is running when the sample is taken\n\
+    is recorded.\n\
+");
+
+static PyType_Slot _sampleprof_sampler_type_spec_slots[] = {
+    {Py_tp_doc, (void *)sampler_doc},
+    {Py_tp_methods, sampler_methods},
+    {Py_tp_members, sampler_members},
+    {Py_tp_getset, sampler_getset},
+    {Py_tp_dealloc, sampler_dealloc},
+    {Py_tp_init, sampler_init},
+    {Py_tp_traverse, sampler_traverse},
+    {0, 0}
+};
+
+static PyType_Spec _sampleprof_sampler_type_spec = {
+    .name = "_sampleprof.Sampler",
+    .basicsize = sizeof(SamplerObject),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE |
+              Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_IMMUTABLETYPE),
+    .slots = _sampleprof_sampler_type_spec_slots,
+};
+
+
+/*** Module ***/
+
+static int
+_sampleprof_traverse(PyObject *module, visitproc visit, void *arg)
+{
+    _sampleprof_state *state = _sampleprof_get_state(module);
+    Py_VISIT(state->sampler_type);
+    return 0;
+}
+
+static int
+_sampleprof_clear(PyObject *module)
+{
+    _sampleprof_state *state = _sampleprof_get_state(module);
+    Py_CLEAR(state->sampler_type);
+    return 0;
+}
+
+static void
+_sampleprof_free(void *module)
+{
+    /* Don't leave the timer thread running past the module. */
+    if (active_sampler != NULL) {
+        sampler_stop_thread(active_sampler);
+    }
+    _sampleprof_clear((PyObject *)module);
+}
+
+static int
+_sampleprof_exec(PyObject *module)
+{
+    _sampleprof_state *state = _sampleprof_get_state(module);
+
+    state->sampler_type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        module, &_sampleprof_sampler_type_spec, NULL);
+    if (state->sampler_type == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(module, state->sampler_type) < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static PyModuleDef_Slot _sampleprofslots[] = {
+    {Py_mod_exec, _sampleprof_exec},
+    /* Samples are requested through the pending calls of the interpreter
+       that started the sampler, and only one sampler runs at a time. */
+    {Py_mod_multiple_interpreters, Py_MOD_MULTIPLE_INTERPRETERS_NOT_SUPPORTED},
+    {0, NULL}
+};
+
+static struct PyModuleDef _sampleprofmodule = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "_sampleprof",
+    .m_doc = "Statistical sampling profiler",
+    .m_size = sizeof(_sampleprof_state),
+    .m_slots = _sampleprofslots,
+    .m_traverse = _sampleprof_traverse,
+    .m_clear = _sampleprof_clear,
+    .m_free = _sampleprof_free
+};
+
+PyMODINIT_FUNC
+PyInit__sampleprof(void)
+{
+    return PyModuleDef_Init(&_sampleprofmodule);
+}
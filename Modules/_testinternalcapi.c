@@ -904,6 +904,20 @@ perf_map_state_teardown(PyObject *Py_UNUSED(self), PyObject *Py_UNUSED(ignored))
     Py_RETURN_NONE;
 }
 
+static PyObject *
+perf_trampoline_set_persist_after_fork(PyObject *self, PyObject *args)
+{
+    int enable;
+    if (!PyArg_ParseTuple(args, "i", &enable)) {
+        return NULL;
+    }
+    if (!PyUnstable_PerfTrampoline_SetPersistAfterFork(enable)) {
+        PyErr_SetString(PyExc_ValueError, "Failed to set persist_after_fork");
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
 static PyObject *
 iframe_getcode(PyObject *self, PyObject *frame)
 {
@@ -1077,6 +1091,7 @@ static PyMethodDef module_functions[] = {
     {"clear_extension", clear_extension, METH_VARARGS, NULL},
     {"write_perf_map_entry", write_perf_map_entry, METH_VARARGS},
     {"perf_map_state_teardown", perf_map_state_teardown, METH_NOARGS},
+    {"perf_trampoline_set_persist_after_fork", perf_trampoline_set_persist_after_fork, METH_VARARGS},
     {"iframe_getcode", iframe_getcode, METH_O, NULL},
     {"iframe_getline", iframe_getline, METH_O, NULL},
     {"iframe_getlasti", iframe_getlasti, METH_O, NULL},
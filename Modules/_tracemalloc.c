@@ -84,18 +84,30 @@ _tracemalloc.start
 
     nframe: int = 1
     /
+    *
+    sampling_interval: Py_ssize_t = 0
 
 Start tracing Python memory allocations.
 
 Also set the maximum number of frames stored in the traceback of a
 trace to nframe.
+
+If sampling_interval is non-zero, only trace one memory block every
+sampling_interval bytes allocated on average.  The size of a trace is then
+an estimate of the memory allocated where the traced block was allocated.
 [clinic start generated code]*/
 
 static PyObject *
-_tracemalloc_start_impl(PyObject *module, int nframe)
-/*[clinic end generated code: output=caae05c23c159d3c input=40d849b5b29d1933]*/
+_tracemalloc_start_impl(PyObject *module, int nframe,
+                        Py_ssize_t sampling_interval)
+/*[clinic end generated code: output=f521f11b9fa9943e input=7c9fc0687b8c04cf]*/
 {
-    if (_PyTraceMalloc_Start(nframe) < 0) {
+    if (sampling_interval < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "the sampling interval must be positive or zero");
+        return NULL;
+    }
+    if (_PyTraceMalloc_StartSampling(nframe, (size_t)sampling_interval) < 0) {
         return NULL;
     }
     Py_RETURN_NONE;
@@ -135,6 +147,21 @@ _tracemalloc_get_traceback_limit_impl(PyObject *module)
     return PyLong_FromLong(_PyTraceMalloc_GetTracebackLimit());
 }
 
+/*[clinic input]
+_tracemalloc.get_sampling_interval
+
+Get the mean number of bytes allocated between two traced memory blocks.
+
+Return 0 if all memory blocks are traced or if tracemalloc is not tracing.
+[clinic start generated code]*/
+
+static PyObject *
+_tracemalloc_get_sampling_interval_impl(PyObject *module)
+/*[clinic end generated code: output=5011d3b4ab086319 input=c0c6ccca21bc3d6e]*/
+{
+    return PyLong_FromSize_t(_PyTraceMalloc_GetSamplingInterval());
+}
+
 /*[clinic input]
 _tracemalloc.get_tracemalloc_memory
 
@@ -192,6 +219,7 @@ static PyMethodDef module_methods[] = {
     _TRACEMALLOC_START_METHODDEF
     _TRACEMALLOC_STOP_METHODDEF
     _TRACEMALLOC_GET_TRACEBACK_LIMIT_METHODDEF
+    _TRACEMALLOC_GET_SAMPLING_INTERVAL_METHODDEF
     _TRACEMALLOC_GET_TRACEMALLOC_MEMORY_METHODDEF
     _TRACEMALLOC_GET_TRACED_MEMORY_METHODDEF
     _TRACEMALLOC_RESET_PEAK_METHODDEF
@@ -231,6 +231,95 @@ gc_get_threshold(PyObject *module, PyObject *Py_UNUSED(ignored))
     return gc_get_threshold_impl(module);
 }
 
+PyDoc_STRVAR(gc_set_incremental__doc__,
+"set_incremental($module, budget, /)\n"
+"--\n"
+"\n"
+"Collect the oldest generation incrementally, pausing about budget seconds at a time.\n"
+"\n"
+"A budget of 0 collects the oldest generation all at once.");
+
+#define GC_SET_INCREMENTAL_METHODDEF    \
+    {"set_incremental", (PyCFunction)gc_set_incremental, METH_O, gc_set_incremental__doc__},
+
+PyDoc_STRVAR(gc_get_incremental__doc__,
+"get_incremental($module, /)\n"
+"--\n"
+"\n"
+"Return the pause budget of the incremental collection in seconds.\n"
+"\n"
+"Return 0.0 if the oldest generation is collected all at once.");
+
+#define GC_GET_INCREMENTAL_METHODDEF    \
+    {"get_incremental", (PyCFunction)gc_get_incremental, METH_NOARGS, gc_get_incremental__doc__},
+
+static PyObject *
+gc_get_incremental_impl(PyObject *module);
+
+static PyObject *
+gc_get_incremental(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return gc_get_incremental_impl(module);
+}
+
+PyDoc_STRVAR(gc_set_mark_threads__doc__,
+"set_mark_threads($module, threads, /)\n"
+"--\n"
+"\n"
+"Use threads threads to find the reachable objects in full collections.\n"
+"\n"
+"A value of 0 or 1 finds them with the collecting thread only.");
+
+#define GC_SET_MARK_THREADS_METHODDEF    \
+    {"set_mark_threads", (PyCFunction)gc_set_mark_threads, METH_O, gc_set_mark_threads__doc__},
+
+static PyObject *
+gc_set_mark_threads_impl(PyObject *module, int threads);
+
+static PyObject *
+gc_set_mark_threads(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int threads;
+
+    threads = _PyLong_AsInt(arg);
+    if (threads == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = gc_set_mark_threads_impl(module, threads);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_get_mark_threads__doc__,
+"get_mark_threads($module, /)\n"
+"--\n"
+"\n"
+"Return the number of threads finding the reachable objects in full collections.");
+
+#define GC_GET_MARK_THREADS_METHODDEF    \
+    {"get_mark_threads", (PyCFunction)gc_get_mark_threads, METH_NOARGS, gc_get_mark_threads__doc__},
+
+static int
+gc_get_mark_threads_impl(PyObject *module);
+
+static PyObject *
+gc_get_mark_threads(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    int _return_value;
+
+    _return_value = gc_get_mark_threads_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromLong((long)_return_value);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(gc_get_count__doc__,
 "get_count($module, /)\n"
 "--\n"
@@ -356,25 +445,74 @@ PyDoc_STRVAR(gc_is_finalized__doc__,
     {"is_finalized", (PyCFunction)gc_is_finalized, METH_O, gc_is_finalized__doc__},
 
 PyDoc_STRVAR(gc_freeze__doc__,
-"freeze($module, /)\n"
+"freeze($module, /, *, immortalize=False)\n"
 "--\n"
 "\n"
 "Freeze all current tracked objects and ignore them for future collections.\n"
 "\n"
 "This can be used before a POSIX fork() call to make the gc copy-on-write friendly.\n"
 "Note: collection before a POSIX fork() call may free pages for future allocation\n"
-"which can cause copy-on-write.");
+"which can cause copy-on-write.\n"
+"\n"
+"If immortalize is true, the frozen objects are also made immortal and are no\n"
+"longer tracked, so that neither the collector nor reference counting write\n"
+"to them.  They are never deallocated, and unfreeze() doesn\'t affect them.");
 
 #define GC_FREEZE_METHODDEF    \
-    {"freeze", (PyCFunction)gc_freeze, METH_NOARGS, gc_freeze__doc__},
+    {"freeze", _PyCFunction_CAST(gc_freeze), METH_FASTCALL|METH_KEYWORDS, gc_freeze__doc__},
 
 static PyObject *
-gc_freeze_impl(PyObject *module);
+gc_freeze_impl(PyObject *module, int immortalize);
 
 static PyObject *
-gc_freeze(PyObject *module, PyObject *Py_UNUSED(ignored))
+gc_freeze(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    return gc_freeze_impl(module);
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(immortalize), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"immortalize", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "freeze",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    int immortalize = 0;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 0, 0, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    immortalize = PyObject_IsTrue(args[0]);
+    if (immortalize < 0) {
+        goto exit;
+    }
+skip_optional_kwonly:
+    return_value = gc_freeze_impl(module, immortalize);
+
+exit:
+    return return_value;
 }
 
 PyDoc_STRVAR(gc_unfreeze__doc__,
@@ -401,7 +539,9 @@ PyDoc_STRVAR(gc_get_freeze_count__doc__,
 "get_freeze_count($module, /)\n"
 "--\n"
 "\n"
-"Return the number of objects in the permanent generation.");
+"Return the number of objects in the permanent generation.\n"
+"\n"
+"This includes the objects that freeze() made immortal.");
 
 #define GC_GET_FREEZE_COUNT_METHODDEF    \
     {"get_freeze_count", (PyCFunction)gc_get_freeze_count, METH_NOARGS, gc_get_freeze_count__doc__},
@@ -424,4 +564,4 @@ gc_get_freeze_count(PyObject *module, PyObject *Py_UNUSED(ignored))
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=66432ac0e17fd04f input=a9049054013a1b77]*/
+/*[clinic end generated code: output=d05411720be4142b input=a9049054013a1b77]*/
@@ -24,12 +24,14 @@
 */
 
 #include "Python.h"
+#include "pycore_bitutils.h"     // _Py_bit_length()
 #include "pycore_context.h"
 #include "pycore_initconfig.h"
 #include "pycore_interp.h"      // PyInterpreterState.gc
 #include "pycore_object.h"
 #include "pycore_pyerrors.h"
 #include "pycore_pystate.h"     // _PyThreadState_GET()
+#include "pycore_typeobject.h"  // _PyType_HasBuiltinTraverse()
 #include "pydtrace.h"
 
 typedef struct _gc_runtime_state GCState;
@@ -44,6 +46,17 @@ module gc
 #  define GC_DEBUG
 #endif
 
+/* Hint the CPU that the memory at ptr is going to be read and written soon */
+#if defined(__GNUC__) || defined(__clang__)
+#  define gc_prefetch(ptr) __builtin_prefetch((ptr), 1, 3)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)) \
+      && !defined(_M_ARM64EC)
+#  include <mmintrin.h>
+#  define gc_prefetch(ptr) _mm_prefetch((const char *)(ptr), _MM_HINT_T0)
+#else
+#  define gc_prefetch(ptr) ((void)(ptr))
+#endif
+
 #define GC_NEXT _PyGCHead_NEXT
 #define GC_PREV _PyGCHead_PREV
 
@@ -57,7 +70,7 @@ module gc
 // No objects in interpreter have this flag after GC ends.
 #define PREV_MASK_COLLECTING   _PyGC_PREV_MASK_COLLECTING
 
-// Lowest bit of _gc_next is used for UNREACHABLE flag.
+// Second lowest bit of _gc_next is used for UNREACHABLE flag.
 //
 // This flag represents the object is in unreachable list in move_unreachable()
 //
@@ -66,7 +79,14 @@ module gc
 // move_legacy_finalizers() removes this flag instead.
 // Between them, unreachable list is not normal list and we can not use
 // most gc_list_* functions for it.
-#define NEXT_MASK_UNREACHABLE  (1)
+#define NEXT_MASK_UNREACHABLE  (2)
+
+// Objects in the permanent generation never take part in a collection, so
+// while the oldest generation is collected incrementally they reuse the
+// UNREACHABLE bit to keep the increments from pulling them in.
+#define NEXT_MASK_FROZEN       NEXT_MASK_UNREACHABLE
+
+#define NEXT_MASK_OLD_SPACE_1  _PyGC_NEXT_MASK_OLD_SPACE_1
 
 /* Get an object's GC head */
 #define AS_GC(o) ((PyGC_Head *)(((char *)(o))-sizeof(PyGC_Head)))
@@ -116,6 +136,25 @@ gc_decref(PyGC_Head *g)
     g->_gc_prev -= 1 << _PyGC_PREV_SHIFT;
 }
 
+static inline int
+gc_old_space(PyGC_Head *g)
+{
+    return (int)(g->_gc_next & NEXT_MASK_OLD_SPACE_1);
+}
+
+static inline void
+gc_set_old_space(PyGC_Head *g, int space)
+{
+    assert(space == 0 || space == NEXT_MASK_OLD_SPACE_1);
+    g->_gc_next = (g->_gc_next & ~NEXT_MASK_OLD_SPACE_1) | space;
+}
+
+static inline int
+gc_is_frozen(PyGC_Head *g)
+{
+    return (g->_gc_next & NEXT_MASK_FROZEN) != 0;
+}
+
 /* set for debugging information */
 #define DEBUG_STATS             (1<<0) /* print collection statistics */
 #define DEBUG_COLLECTABLE       (1<<1) /* print collectable objects */
@@ -151,6 +190,8 @@ _PyGC_InitState(GCState *gcstate)
     };
     gcstate->generation0 = GEN_HEAD(gcstate, 0);
     INIT_HEAD(gcstate->permanent_generation);
+    gcstate->mark_pending._gc_next = (uintptr_t)&gcstate->mark_pending;
+    gcstate->mark_pending._gc_prev = (uintptr_t)&gcstate->mark_pending;
 
 #undef INIT_HEAD
 }
@@ -171,6 +212,11 @@ _PyGC_Init(PyInterpreterState *interp)
         return _PyStatus_NO_MEMORY();
     }
 
+    gcstate->adaptive = _PyInterpreterState_GetConfig(interp)->gc_adaptive;
+    for (int i = 0; i < NUM_GENERATIONS; i++) {
+        gcstate->base_thresholds[i] = gcstate->generations[i].threshold;
+    }
+
     return _PyStatus_OK();
 }
 
@@ -210,8 +256,10 @@ _gc_next takes these values:
 
 != 0
     Pointer to the next object in the GC list.
-    Additionally, lowest bit is used temporary for
-    NEXT_MASK_UNREACHABLE flag described below.
+    Additionally, the second lowest bit is used temporary for
+    NEXT_MASK_UNREACHABLE flag described below, and the lowest bit
+    holds the old space of the object (see gc_collect_increment()).
+    Both are preserved by the gc_list_* functions.
 
 NEXT_MASK_UNREACHABLE
     move_unreachable() then moves objects not reachable (whether directly or
@@ -335,6 +383,34 @@ gc_list_clear_collecting(PyGC_Head *collectable)
     }
 }
 
+/* Walk the list and set the old space of all objects, returning their number */
+static Py_ssize_t
+gc_list_set_space(PyGC_Head *list, int space)
+{
+    PyGC_Head *gc;
+    Py_ssize_t n = 0;
+    for (gc = GC_NEXT(list); gc != list; gc = GC_NEXT(gc)) {
+        gc_set_old_space(gc, space);
+        n++;
+    }
+    return n;
+}
+
+/* Walk the list and set or clear the NEXT_MASK_FROZEN flag of all objects */
+static void
+gc_list_set_frozen(PyGC_Head *list, int frozen)
+{
+    PyGC_Head *gc;
+    for (gc = GC_NEXT(list); gc != list; gc = GC_NEXT(gc)) {
+        if (frozen) {
+            gc->_gc_next |= NEXT_MASK_FROZEN;
+        }
+        else {
+            gc->_gc_next &= ~NEXT_MASK_FROZEN;
+        }
+    }
+}
+
 /* Append objects in a GC list to a Python list.
  * Return 0 if all OK, < 0 if error (out of memory for list)
  */
@@ -395,7 +471,7 @@ validate_list(PyGC_Head *head, enum flagstates flags)
     PyGC_Head *gc = GC_NEXT(head);
     while (gc != head) {
         PyGC_Head *trueprev = GC_PREV(gc);
-        PyGC_Head *truenext = (PyGC_Head *)(gc->_gc_next  & ~NEXT_MASK_UNREACHABLE);
+        PyGC_Head *truenext = GC_NEXT(gc);
         assert(truenext != NULL);
         assert(trueprev == prev);
         assert((gc->_gc_prev & PREV_MASK_COLLECTING) == prev_value);
@@ -412,17 +488,63 @@ validate_list(PyGC_Head *head, enum flagstates flags)
 /*** end of list stuff ***/
 
 
+/* Prefetching.
+
+   In a large heap, visiting an object is likely to miss the cache.  The
+   objects referred to by the traversed objects are scattered in memory, so
+   subtract_refs() doesn't visit them as soon as tp_traverse reports them:
+   it prefetches them and queues them in a small ring buffer, and only
+   visits an object when GC_PREFETCH_BUFFER more references have been
+   reported, by which time its memory has hopefully arrived.  The loops
+   following the generation lists similarly prefetch the object
+   GC_PREFETCH_DISTANCE positions ahead of the one they examine.
+*/
+#define GC_PREFETCH_BUFFER 16  /* must be a power of 2 */
+#define GC_PREFETCH_DISTANCE 4
+
+/* Return the object GC_PREFETCH_DISTANCE positions after gc in its list,
+ * or the head of the list if the list ends before, and prefetch it.
+ */
+static inline PyGC_Head *
+gc_prefetch_ahead(PyGC_Head *gc, PyGC_Head *head)
+{
+    for (int i = 0; i < GC_PREFETCH_DISTANCE && gc != head; i++) {
+        gc = GC_NEXT(gc);
+    }
+    gc_prefetch(gc);
+    return gc;
+}
+
+/* Advance ahead, the object GC_PREFETCH_DISTANCE positions ahead of the one
+ * being examined, by one position and prefetch it.  It stops at the head of
+ * the list.
+ */
+static inline PyGC_Head *
+gc_prefetch_next(PyGC_Head *ahead, PyGC_Head *head)
+{
+    if (ahead != head) {
+        ahead = GC_NEXT(ahead);
+        gc_prefetch(ahead);
+    }
+    return ahead;
+}
+
 /* Set all gc_refs = ob_refcnt.  After this, gc_refs is > 0 and
  * PREV_MASK_COLLECTING bit is set for all objects in containers.
+ * Return the number of objects visited.
  */
-static void
+static Py_ssize_t
 update_refs(PyGC_Head *containers)
 {
     PyGC_Head *next;
     PyGC_Head *gc = GC_NEXT(containers);
+    PyGC_Head *ahead = gc_prefetch_ahead(gc, containers);
+    Py_ssize_t visited = 0;
 
     while (gc != containers) {
         next = GC_NEXT(gc);
+        ahead = gc_prefetch_next(ahead, containers);
+        visited++;
         /* Move any object that might have become immortal to the
          * permanent generation as the reference count is not accurately
          * reflecting the actual number of live references to this object
@@ -454,14 +576,12 @@ update_refs(PyGC_Head *containers)
         _PyObject_ASSERT(FROM_GC(gc), gc_get_refs(gc) != 0);
         gc = next;
     }
+    return visited;
 }
 
-/* A traversal callback for subtract_refs. */
-static int
-visit_decref(PyObject *op, void *parent)
+static inline void
+decref_collecting(PyObject *op)
 {
-    _PyObject_ASSERT(_PyObject_CAST(parent), !_PyObject_IsFreed(op));
-
     if (_PyObject_IS_GC(op)) {
         PyGC_Head *gc = AS_GC(op);
         /* We're only interested in gc_refs for objects in the
@@ -472,6 +592,30 @@ visit_decref(PyObject *op, void *parent)
             gc_decref(gc);
         }
     }
+}
+
+struct gc_prefetch_buffer {
+    PyObject *objects[GC_PREFETCH_BUFFER];
+    unsigned int head; /* index of the next object to visit */
+    unsigned int tail; /* index of the next object to queue */
+#ifdef GC_DEBUG
+    PyObject *parent; /* object being traversed */
+#endif
+};
+
+/* A traversal callback for subtract_refs. */
+static int
+visit_decref(PyObject *op, struct gc_prefetch_buffer *buffer)
+{
+#ifdef GC_DEBUG
+    _PyObject_ASSERT(buffer->parent, !_PyObject_IsFreed(op));
+#endif
+    gc_prefetch(op);
+    if (buffer->tail - buffer->head == GC_PREFETCH_BUFFER) {
+        decref_collecting(
+            buffer->objects[buffer->head++ & (GC_PREFETCH_BUFFER - 1)]);
+    }
+    buffer->objects[buffer->tail++ & (GC_PREFETCH_BUFFER - 1)] = op;
     return 0;
 }
 
@@ -479,19 +623,34 @@ visit_decref(PyObject *op, void *parent)
  * for all objects in containers, and is GC_REACHABLE for all tracked gc
  * objects not in containers.  The ones with gc_refs > 0 are directly
  * reachable from outside containers, and so can't be collected.
+ * Return the number of objects visited.
  */
-static void
+static Py_ssize_t
 subtract_refs(PyGC_Head *containers)
 {
     traverseproc traverse;
     PyGC_Head *gc = GC_NEXT(containers);
+    PyGC_Head *ahead = gc_prefetch_ahead(gc, containers);
+    Py_ssize_t visited = 0;
+    struct gc_prefetch_buffer buffer;
+    buffer.head = buffer.tail = 0;
     for (; gc != containers; gc = GC_NEXT(gc)) {
         PyObject *op = FROM_GC(gc);
+        ahead = gc_prefetch_next(ahead, containers);
+#ifdef GC_DEBUG
+        buffer.parent = op;
+#endif
         traverse = Py_TYPE(op)->tp_traverse;
         (void) traverse(op,
                         (visitproc)visit_decref,
-                        op);
+                        &buffer);
+        visited++;
     }
+    while (buffer.head != buffer.tail) {
+        decref_collecting(
+            buffer.objects[buffer.head++ & (GC_PREFETCH_BUFFER - 1)]);
+    }
+    return visited;
 }
 
 /* A traversal callback for move_unreachable. */
@@ -526,13 +685,16 @@ visit_reachable(PyObject *op, PyGC_Head *reachable)
         // Manually unlink gc from unreachable list because the list functions
         // don't work right in the presence of NEXT_MASK_UNREACHABLE flags.
         PyGC_Head *prev = GC_PREV(gc);
-        PyGC_Head *next = (PyGC_Head*)(gc->_gc_next & ~NEXT_MASK_UNREACHABLE);
+        PyGC_Head *next = GC_NEXT(gc);
         _PyObject_ASSERT(FROM_GC(prev),
                          prev->_gc_next & NEXT_MASK_UNREACHABLE);
         _PyObject_ASSERT(FROM_GC(next),
                          next->_gc_next & NEXT_MASK_UNREACHABLE);
-        prev->_gc_next = gc->_gc_next;  // copy NEXT_MASK_UNREACHABLE
+        // copy NEXT_MASK_UNREACHABLE, but keep prev's old space
+        prev->_gc_next = (prev->_gc_next & NEXT_MASK_OLD_SPACE_1)
+            | (gc->_gc_next & ~NEXT_MASK_OLD_SPACE_1);
         _PyGCHead_SET_PREV(next, prev);
+        gc->_gc_next &= ~NEXT_MASK_UNREACHABLE;
 
         gc_list_append(gc, reachable);
         gc_set_refs(gc, 1);
@@ -566,13 +728,18 @@ visit_reachable(PyObject *op, PyGC_Head *reachable)
  * doubly linked list after this function.
  * But _gc_next in unreachable list has NEXT_MASK_UNREACHABLE flag.
  * So we can not gc_list_* functions for unreachable until we remove the flag.
+ *
+ * Return the number of objects visited, counting the objects that are moved
+ * back to young as many times as they are visited.
  */
-static void
+static Py_ssize_t
 move_unreachable(PyGC_Head *young, PyGC_Head *unreachable)
 {
     // previous elem in the young list, used for restore gc_prev.
     PyGC_Head *prev = young;
     PyGC_Head *gc = GC_NEXT(young);
+    PyGC_Head *ahead = gc_prefetch_ahead(gc, young);
+    Py_ssize_t visited = 0;
 
     /* Invariants:  all objects "to the left" of us in young are reachable
      * (directly or indirectly) from outside the young list as it was at entry.
@@ -584,6 +751,7 @@ move_unreachable(PyGC_Head *young, PyGC_Head *unreachable)
      */
 
     while (gc != young) {
+        ahead = gc_prefetch_next(ahead, young);
         if (gc_get_refs(gc)) {
             /* gc is definitely reachable from outside the
              * original 'young'.  Mark it as such, and traverse
@@ -618,7 +786,7 @@ move_unreachable(PyGC_Head *young, PyGC_Head *unreachable)
              */
             // Move gc to unreachable.
             // No need to gc->next->prev = prev because it is single linked.
-            prev->_gc_next = gc->_gc_next;
+            _PyGCHead_SET_NEXT(prev, GC_NEXT(gc));
 
             // We can't use gc_list_append() here because we use
             // NEXT_MASK_UNREACHABLE here.
@@ -628,19 +796,617 @@ move_unreachable(PyGC_Head *young, PyGC_Head *unreachable)
             // But this may pollute the unreachable list head's 'next' pointer
             // too. That's semantically senseless but expedient here - the
             // damage is repaired when this function ends.
-            last->_gc_next = (NEXT_MASK_UNREACHABLE | (uintptr_t)gc);
+            last->_gc_next = (last->_gc_next & NEXT_MASK_OLD_SPACE_1)
+                | NEXT_MASK_UNREACHABLE | (uintptr_t)gc;
             _PyGCHead_SET_PREV(gc, last);
-            gc->_gc_next = (NEXT_MASK_UNREACHABLE | (uintptr_t)unreachable);
+            gc->_gc_next = (gc->_gc_next & NEXT_MASK_OLD_SPACE_1)
+                | NEXT_MASK_UNREACHABLE | (uintptr_t)unreachable;
             unreachable->_gc_prev = (uintptr_t)gc;
         }
-        gc = (PyGC_Head*)prev->_gc_next;
+        gc = GC_NEXT(prev);
+        visited++;
     }
     // young->_gc_prev must be last element remained in the list.
     young->_gc_prev = (uintptr_t)prev;
     // don't let the pollution of the list head's next pointer leak
     unreachable->_gc_next &= ~NEXT_MASK_UNREACHABLE;
+    return visited;
+}
+
+/* Parallel marking.
+
+   When gc.set_mark_threads() allows it, full collections of large heaps
+   find the reachable objects with helper threads instead of
+   move_unreachable().  No Python code runs during that phase, and the
+   helpers don't take the GIL: they only write the gc_refs of the objects
+   being collected, and only call the tp_traverse and tp_is_gc functions of
+   the static builtin types and of the Python subclasses of them (see
+   _PyType_HasBuiltinTraverse()), which only read the objects.  The ones of
+   other types, such as the types of extension modules, may run any code:
+   the helpers defer their objects to the collecting thread, which holds the
+   GIL and traverses them once the helpers are done.
+
+   The generation list is split into one segment per thread, and every
+   thread pushes the objects of its segment that are referred to from
+   outside the generation (gc_refs > 0) on its private stack.  Once all
+   threads are done with that, every thread traverses the objects on its
+   stack, setting the gc_refs of the referents that still have gc_refs == 0
+   to 1 and pushing them in turn.  Two threads may both see an object with
+   gc_refs == 0 and both traverse it, which only wastes a little work.
+
+   A thread with a large stack publishes some of its objects when other
+   threads are idle, and idle threads steal the published objects.  The
+   marking ends when all threads are idle and no object is published.
+   Then the collecting thread traverses the deferred objects and the ones
+   reachable from them that are still unmarked, and move_unmarked() moves
+   the objects still having gc_refs == 0 to the unreachable list, leaving
+   the lists as move_unreachable() would.
+
+   The helper threads are started by the first collection that marks in
+   parallel, and wait for the next one in between.  They exit when
+   gc.set_mark_threads() changes their number, and when the interpreter is
+   finalized.  A child process of a fork() starts its own helpers.
+
+   The stacks are allocated with malloc() rather than PyMem_RawMalloc(),
+   whose hooks may need the GIL (tracemalloc does).
+*/
+
+/* Minimum size of a generation to mark it in parallel */
+#define GC_PARALLEL_MIN_OBJECTS 100000
+/* Number of objects published or stolen at once */
+#define GC_MARK_BATCH 256
+
+struct gc_mark_shared;
+
+struct gc_mark_worker {
+    struct gc_mark_shared *shared;
+    /* a helper thread rather than the collecting thread */
+    int helper;
+    /* segment of the generation list: [start, end) */
+    PyGC_Head *start;
+    PyGC_Head *end;
+    /* private stack of objects to traverse */
+    PyObject **stack;
+    Py_ssize_t size;
+    Py_ssize_t allocated;
+    /* published objects, protected by shared->mutex */
+    PyObject **published;
+    Py_ssize_t published_size;
+    Py_ssize_t published_allocated;
+    /* objects left to the collecting thread */
+    PyObject **deferred;
+    Py_ssize_t deferred_size;
+    Py_ssize_t deferred_allocated;
+    /* number of objects traversed */
+    Py_ssize_t traversed;
+    /* released by gc_mark_wake_all() to wake the worker up */
+    PyThread_type_lock wakeup;
+    int waiting;
+};
+
+struct gc_mark_shared {
+    PyThread_type_lock mutex;
+    int nthreads;  /* # allocated workers */
+    int nworkers;  /* # workers: the collecting thread and the helpers */
+    struct gc_mark_worker *workers;
+#ifdef HAVE_FORK
+    pid_t pid;     /* the process which started the helpers */
+#endif
+    /* the following are protected by mutex */
+    unsigned long epoch;  /* # markings started */
+    int exiting;  /* the helpers must exit */
+    int alive;    /* # helper threads that didn't exit yet */
+    int running;  /* # helper threads that didn't finish the marking yet */
+    int rooted;   /* # threads that pushed their roots */
+    Py_ssize_t published; /* total # published objects */
+    int done;
+    /* # threads waiting for work; also read without the mutex */
+    _Py_atomic_int idle;
+    /* a thread ran out of memory */
+    _Py_atomic_int failed;
+};
+
+#define MUTEX_LOCK(shared) PyThread_acquire_lock((shared)->mutex, WAIT_LOCK)
+#define MUTEX_UNLOCK(shared) PyThread_release_lock((shared)->mutex)
+
+/* Release shared->mutex until gc_mark_wake_all() is called.  Called with
+   shared->mutex held. */
+static void
+gc_mark_wait(struct gc_mark_worker *worker)
+{
+    worker->waiting = 1;
+    MUTEX_UNLOCK(worker->shared);
+    PyThread_acquire_lock(worker->wakeup, WAIT_LOCK);
+    MUTEX_LOCK(worker->shared);
+}
+
+/* Wake up the workers waiting in gc_mark_wait().  Called with
+   shared->mutex held. */
+static void
+gc_mark_wake_all(struct gc_mark_shared *shared)
+{
+    for (int i = 0; i < shared->nworkers; i++) {
+        struct gc_mark_worker *worker = &shared->workers[i];
+        if (worker->waiting) {
+            worker->waiting = 0;
+            PyThread_release_lock(worker->wakeup);
+        }
+    }
+}
+
+static int
+gc_mark_grow(PyObject ***items, Py_ssize_t *allocated, Py_ssize_t needed)
+{
+    if (needed <= *allocated) {
+        return 0;
+    }
+    Py_ssize_t new_allocated = Py_MAX(needed, *allocated * 2);
+    new_allocated = Py_MAX(new_allocated, 1024);
+    if ((size_t)new_allocated > PY_SSIZE_T_MAX / sizeof(PyObject *)) {
+        return -1;
+    }
+    PyObject **new_items = realloc(*items, new_allocated * sizeof(PyObject *));
+    if (new_items == NULL) {
+        return -1;
+    }
+    *items = new_items;
+    *allocated = new_allocated;
+    return 0;
+}
+
+static int
+gc_mark_push(struct gc_mark_worker *worker, PyObject *op)
+{
+    if (worker->size == worker->allocated
+        && gc_mark_grow(&worker->stack, &worker->allocated,
+                        worker->size + 1) < 0)
+    {
+        _Py_atomic_store_relaxed(&worker->shared->failed, 1);
+        return -1;
+    }
+    worker->stack[worker->size++] = op;
+    return 0;
+}
+
+/* Leave an object to the collecting thread, marked or not. */
+static int
+gc_mark_defer(struct gc_mark_worker *worker, PyObject *op)
+{
+    if (worker->deferred_size == worker->deferred_allocated
+        && gc_mark_grow(&worker->deferred, &worker->deferred_allocated,
+                        worker->deferred_size + 1) < 0)
+    {
+        _Py_atomic_store_relaxed(&worker->shared->failed, 1);
+        return -1;
+    }
+    worker->deferred[worker->deferred_size++] = op;
+    return 0;
+}
+
+/* A traversal callback for gc_mark_worker_run(). */
+static int
+visit_mark_parallel(PyObject *op, struct gc_mark_worker *worker)
+{
+    PyTypeObject *type = Py_TYPE(op);
+    if (worker->helper && type->tp_is_gc != NULL
+        && !_PyType_HasBuiltinTraverse(type))
+    {
+        return gc_mark_defer(worker, op);
+    }
+    if (!_PyObject_IS_GC(op)) {
+        return 0;
+    }
+    PyGC_Head *gc = AS_GC(op);
+    if (gc_is_collecting(gc) && gc_get_refs(gc) == 0) {
+        gc_set_refs(gc, 1);
+        return gc_mark_push(worker, op);
+    }
+    return 0;
+}
+
+/* Move a batch of objects from the top of the stack of the worker to its
+   published objects.  Called with shared->mutex held. */
+static void
+gc_mark_publish(struct gc_mark_worker *worker)
+{
+    struct gc_mark_shared *shared = worker->shared;
+    if (gc_mark_grow(&worker->published, &worker->published_allocated,
+                     worker->published_size + GC_MARK_BATCH) < 0)
+    {
+        return;
+    }
+    worker->size -= GC_MARK_BATCH;
+    memcpy(worker->published + worker->published_size,
+           worker->stack + worker->size, GC_MARK_BATCH * sizeof(PyObject *));
+    worker->published_size += GC_MARK_BATCH;
+    shared->published += GC_MARK_BATCH;
+    gc_mark_wake_all(shared);
+}
+
+/* Move published objects to the stack of the worker, preferably its own.
+   Called with shared->mutex held.  Return the number of objects moved. */
+static Py_ssize_t
+gc_mark_steal(struct gc_mark_worker *worker)
+{
+    struct gc_mark_shared *shared = worker->shared;
+    struct gc_mark_worker *victim = worker;
+    if (victim->published_size == 0) {
+        for (int i = 0; i < shared->nworkers; i++) {
+            if (shared->workers[i].published_size > victim->published_size) {
+                victim = &shared->workers[i];
+            }
+        }
+    }
+    Py_ssize_t n = Py_MIN(victim->published_size, GC_MARK_BATCH);
+    if (n == 0) {
+        return 0;
+    }
+    if (gc_mark_grow(&worker->stack, &worker->allocated, worker->size + n) < 0) {
+        _Py_atomic_store_relaxed(&shared->failed, 1);
+        return 0;
+    }
+    victim->published_size -= n;
+    memcpy(worker->stack + worker->size,
+           victim->published + victim->published_size, n * sizeof(PyObject *));
+    worker->size += n;
+    shared->published -= n;
+    return n;
+}
+
+static void
+gc_mark_worker_run(struct gc_mark_worker *worker)
+{
+    struct gc_mark_shared *shared = worker->shared;
+
+    /* The roots of the segment are pushed before any object is marked */
+    for (PyGC_Head *gc = worker->start; gc != worker->end; gc = GC_NEXT(gc)) {
+        if (gc_get_refs(gc) > 0 && gc_mark_push(worker, FROM_GC(gc)) < 0) {
+            break;
+        }
+    }
+    MUTEX_LOCK(shared);
+    shared->rooted++;
+    if (shared->rooted == shared->nworkers) {
+        gc_mark_wake_all(shared);
+    }
+    while (shared->rooted < shared->nworkers) {
+        gc_mark_wait(worker);
+    }
+    MUTEX_UNLOCK(shared);
+
+    for (;;) {
+        while (worker->size > 0) {
+            if (_Py_atomic_load_relaxed(&shared->failed)) {
+                worker->size = 0;
+                break;
+            }
+            PyObject *op = worker->stack[--worker->size];
+            PyTypeObject *type = Py_TYPE(op);
+            if (worker->helper && !_PyType_HasBuiltinTraverse(type)) {
+                (void) gc_mark_defer(worker, op);
+                continue;
+            }
+            (void) type->tp_traverse(op, (visitproc)visit_mark_parallel,
+                                     worker);
+            worker->traversed++;
+            if (worker->size >= 2 * GC_MARK_BATCH
+                && _Py_atomic_load_relaxed(&shared->idle) > 0)
+            {
+                MUTEX_LOCK(shared);
+                gc_mark_publish(worker);
+                MUTEX_UNLOCK(shared);
+            }
+        }
+
+        MUTEX_LOCK(shared);
+        if (gc_mark_steal(worker) > 0) {
+            MUTEX_UNLOCK(shared);
+            continue;
+        }
+        int idle = _Py_atomic_load_relaxed(&shared->idle) + 1;
+        _Py_atomic_store_relaxed(&shared->idle, idle);
+        while (!shared->done) {
+            if (_Py_atomic_load_relaxed(&shared->failed)
+                || (shared->published == 0
+                    && _Py_atomic_load_relaxed(&shared->idle) == shared->nworkers))
+            {
+                shared->done = 1;
+                gc_mark_wake_all(shared);
+                break;
+            }
+            if (shared->published > 0) {
+                break;
+            }
+            gc_mark_wait(worker);
+        }
+        if (shared->done) {
+            MUTEX_UNLOCK(shared);
+            return;
+        }
+        idle = _Py_atomic_load_relaxed(&shared->idle) - 1;
+        _Py_atomic_store_relaxed(&shared->idle, idle);
+        MUTEX_UNLOCK(shared);
+    }
+}
+
+/* Traverse the objects deferred by the helpers, and the objects reachable
+   from them that are still unmarked, once the helpers are done.  Called by
+   the collecting thread. */
+static void
+gc_mark_deferred(struct gc_mark_shared *shared)
+{
+    struct gc_mark_worker *worker = &shared->workers[0];
+    for (int i = 1; i < shared->nworkers; i++) {
+        struct gc_mark_worker *helper = &shared->workers[i];
+        for (Py_ssize_t j = 0; j < helper->deferred_size; j++) {
+            PyObject *op = helper->deferred[j];
+            if (!_PyObject_IS_GC(op) || !gc_is_collecting(AS_GC(op))) {
+                continue;
+            }
+            /* Marked or not, nothing traversed the object yet */
+            if (gc_get_refs(AS_GC(op)) == 0) {
+                gc_set_refs(AS_GC(op), 1);
+            }
+            if (gc_mark_push(worker, op) < 0) {
+                return;
+            }
+        }
+    }
+    while (worker->size > 0 && !_Py_atomic_load_relaxed(&shared->failed)) {
+        PyObject *op = worker->stack[--worker->size];
+        (void) Py_TYPE(op)->tp_traverse(op, (visitproc)visit_mark_parallel,
+                                        worker);
+        worker->traversed++;
+    }
+}
+
+static void
+gc_mark_helper(void *arg)
+{
+    struct gc_mark_worker *worker = (struct gc_mark_worker *)arg;
+    struct gc_mark_shared *shared = worker->shared;
+    unsigned long epoch = 0;
+
+    MUTEX_LOCK(shared);
+    for (;;) {
+        while (!shared->exiting && shared->epoch == epoch) {
+            gc_mark_wait(worker);
+        }
+        if (shared->exiting) {
+            break;
+        }
+        epoch = shared->epoch;
+        MUTEX_UNLOCK(shared);
+
+        gc_mark_worker_run(worker);
+
+        MUTEX_LOCK(shared);
+        shared->running--;
+        gc_mark_wake_all(shared);
+    }
+    shared->alive--;
+    gc_mark_wake_all(shared);
+    /* The collecting thread may free shared as soon as it is unlocked */
+    MUTEX_UNLOCK(shared);
+}
+
+/* Free the stacks of the workers between two markings. */
+static void
+gc_mark_free_stacks(struct gc_mark_shared *shared)
+{
+    for (int i = 0; i < shared->nthreads; i++) {
+        struct gc_mark_worker *worker = &shared->workers[i];
+        free(worker->stack);
+        free(worker->published);
+        free(worker->deferred);
+        worker->stack = worker->published = worker->deferred = NULL;
+        worker->size = worker->published_size = worker->deferred_size = 0;
+        worker->allocated = 0;
+        worker->published_allocated = worker->deferred_allocated = 0;
+    }
+}
+
+/* Free a pool of workers whose helper threads exited, or never started. */
+static void
+gc_mark_pool_free(struct gc_mark_shared *shared)
+{
+    if (shared->workers != NULL) {
+        gc_mark_free_stacks(shared);
+        for (int i = 0; i < shared->nthreads; i++) {
+            struct gc_mark_worker *worker = &shared->workers[i];
+            if (worker->wakeup != NULL) {
+                PyThread_release_lock(worker->wakeup);
+                PyThread_free_lock(worker->wakeup);
+            }
+        }
+    }
+    if (shared->mutex != NULL) {
+        PyThread_free_lock(shared->mutex);
+    }
+    free(shared->workers);
+    free(shared);
+}
+
+/* Allocate the workers of nthreads threads, including the calling one,
+   and start the helper threads.  Return NULL on failure. */
+static struct gc_mark_shared *
+gc_mark_pool_start(int nthreads)
+{
+    struct gc_mark_shared *shared = calloc(1, sizeof(*shared));
+    if (shared == NULL) {
+        return NULL;
+    }
+    shared->nthreads = nthreads;
+    shared->workers = calloc(nthreads, sizeof(struct gc_mark_worker));
+    shared->mutex = PyThread_allocate_lock();
+    if (shared->workers == NULL || shared->mutex == NULL) {
+        gc_mark_pool_free(shared);
+        return NULL;
+    }
+    for (int i = 0; i < nthreads; i++) {
+        struct gc_mark_worker *worker = &shared->workers[i];
+        worker->shared = shared;
+        worker->helper = (i > 0);
+        worker->wakeup = PyThread_allocate_lock();
+        if (worker->wakeup == NULL) {
+            gc_mark_pool_free(shared);
+            return NULL;
+        }
+        PyThread_acquire_lock(worker->wakeup, WAIT_LOCK);
+    }
+#ifdef HAVE_FORK
+    shared->pid = getpid();
+#endif
+
+    MUTEX_LOCK(shared);
+    for (int i = 1; i < nthreads; i++) {
+        if (PyThread_start_new_thread(gc_mark_helper, &shared->workers[i])
+            == PYTHREAD_INVALID_THREAD_ID)
+        {
+            break;
+        }
+        shared->alive++;
+    }
+    shared->nworkers = shared->alive + 1;
+    MUTEX_UNLOCK(shared);
+    return shared;
+}
+
+/* Make the helper threads exit and free the pool. */
+static void
+gc_mark_pool_stop(struct gc_mark_shared *shared)
+{
+#ifdef HAVE_FORK
+    if (shared->pid != getpid()) {
+        /* The helpers were threads of the parent process */
+        gc_mark_pool_free(shared);
+        return;
+    }
+#endif
+    MUTEX_LOCK(shared);
+    shared->exiting = 1;
+    gc_mark_wake_all(shared);
+    while (shared->alive > 0) {
+        gc_mark_wait(&shared->workers[0]);
+    }
+    MUTEX_UNLOCK(shared);
+    gc_mark_pool_free(shared);
+}
+
+/* Move the objects of young with gc_refs == 0 to unreachable, like
+ * move_unreachable() does, once the reachable objects are all marked with
+ * gc_refs > 0.  Return the number of objects visited.
+ */
+static Py_ssize_t
+move_unmarked(PyGC_Head *young, PyGC_Head *unreachable)
+{
+    PyGC_Head *prev = young;
+    PyGC_Head *gc = GC_NEXT(young);
+    PyGC_Head *ahead = gc_prefetch_ahead(gc, young);
+    Py_ssize_t visited = 0;
+
+    while (gc != young) {
+        PyGC_Head *next = GC_NEXT(gc);
+        ahead = gc_prefetch_next(ahead, young);
+        if (gc_get_refs(gc)) {
+            _PyGCHead_SET_PREV(gc, prev);
+            gc_clear_collecting(gc);
+            prev = gc;
+        }
+        else {
+            _PyGCHead_SET_NEXT(prev, next);
+            PyGC_Head *last = GC_PREV(unreachable);
+            last->_gc_next = (last->_gc_next & NEXT_MASK_OLD_SPACE_1)
+                | NEXT_MASK_UNREACHABLE | (uintptr_t)gc;
+            _PyGCHead_SET_PREV(gc, last);
+            gc->_gc_next = (gc->_gc_next & NEXT_MASK_OLD_SPACE_1)
+                | NEXT_MASK_UNREACHABLE | (uintptr_t)unreachable;
+            unreachable->_gc_prev = (uintptr_t)gc;
+        }
+        gc = next;
+        visited++;
+    }
+    young->_gc_prev = (uintptr_t)prev;
+    unreachable->_gc_next &= ~NEXT_MASK_UNREACHABLE;
+    return visited;
+}
+
+/* Mark the objects of young reachable from outside with gc_refs > 0, using
+ * nthreads threads including the calling one.  young holds about n objects.
+ * Return the number of objects traversed, or -1 if the marking couldn't
+ * complete.  In that case, the marked objects are reachable, but some
+ * objects reachable from them may not be marked.
+ */
+static Py_ssize_t
+gc_mark_parallel(PyGC_Head *young, Py_ssize_t n, int nthreads)
+{
+    GCState *gcstate = get_gc_state();
+    struct gc_mark_shared *shared = gcstate->mark_pool;
+#ifdef HAVE_FORK
+    if (shared != NULL && shared->pid != getpid()) {
+        gc_mark_pool_stop(shared);
+        shared = gcstate->mark_pool = NULL;
+    }
+#endif
+    if (shared == NULL) {
+        shared = gc_mark_pool_start(nthreads);
+        if (shared == NULL) {
+            return -1;
+        }
+        gcstate->mark_pool = shared;
+    }
+
+    MUTEX_LOCK(shared);
+    shared->rooted = 0;
+    shared->published = 0;
+    shared->done = 0;
+    _Py_atomic_store_relaxed(&shared->idle, 0);
+    _Py_atomic_store_relaxed(&shared->failed, 0);
+    /* Split the list in segments of about equal length (n is only an
+       estimate, since update_refs() moves immortal objects away) */
+    int nworkers = shared->nworkers;
+    PyGC_Head *gc = GC_NEXT(young);
+    for (int i = 0; i < nworkers; i++) {
+        struct gc_mark_worker *worker = &shared->workers[i];
+        worker->traversed = 0;
+        worker->start = gc;
+        Py_ssize_t length = n / nworkers;
+        for (Py_ssize_t j = 0; j < length && gc != young; j++) {
+            gc = GC_NEXT(gc);
+        }
+        worker->end = (i == nworkers - 1) ? young : gc;
+    }
+    shared->running = nworkers - 1;
+    shared->epoch++;
+    gc_mark_wake_all(shared);
+    MUTEX_UNLOCK(shared);
+
+    struct gc_mark_worker *worker = &shared->workers[0];
+    gc_mark_worker_run(worker);
+
+    MUTEX_LOCK(shared);
+    while (shared->running > 0) {
+        gc_mark_wait(worker);
+    }
+    MUTEX_UNLOCK(shared);
+
+    if (!_Py_atomic_load_relaxed(&shared->failed)) {
+        gc_mark_deferred(shared);
+    }
+    Py_ssize_t traversed = -1;
+    if (!_Py_atomic_load_relaxed(&shared->failed)) {
+        traversed = 0;
+        for (int i = 0; i < nworkers; i++) {
+            traversed += shared->workers[i].traversed;
+        }
+    }
+    gc_mark_free_stacks(shared);
+    return traversed;
 }
 
+#undef MUTEX_LOCK
+#undef MUTEX_UNLOCK
+
 static void
 untrack_tuples(PyGC_Head *head)
 {
@@ -696,7 +1462,7 @@ move_legacy_finalizers(PyGC_Head *unreachable, PyGC_Head *finalizers)
 
         _PyObject_ASSERT(op, gc->_gc_next & NEXT_MASK_UNREACHABLE);
         gc->_gc_next &= ~NEXT_MASK_UNREACHABLE;
-        next = (PyGC_Head*)gc->_gc_next;
+        next = GC_NEXT(gc);
 
         if (has_legacy_finalizer(op)) {
             gc_clear_collecting(gc);
@@ -716,7 +1482,7 @@ clear_unreachable_mask(PyGC_Head *unreachable)
     for (gc = GC_NEXT(unreachable); gc != unreachable; gc = next) {
         _PyObject_ASSERT((PyObject*)FROM_GC(gc), gc->_gc_next & NEXT_MASK_UNREACHABLE);
         gc->_gc_next &= ~NEXT_MASK_UNREACHABLE;
-        next = (PyGC_Head*)gc->_gc_next;
+        next = GC_NEXT(gc);
     }
     validate_list(unreachable, collecting_set_unreachable_clear);
 }
@@ -888,7 +1654,7 @@ handle_weakrefs(PyGC_Head *unreachable, PyGC_Head *old)
         PyObject *temp;
         PyObject *callback;
 
-        gc = (PyGC_Head*)wrcb_to_call._gc_next;
+        gc = GC_NEXT(&wrcb_to_call);
         op = FROM_GC(gc);
         _PyObject_ASSERT(op, PyWeakref_Check(op));
         wr = (PyWeakReference *)op;
@@ -914,8 +1680,9 @@ handle_weakrefs(PyGC_Head *unreachable, PyGC_Head *old)
          * ours).
          */
         Py_DECREF(op);
-        if (wrcb_to_call._gc_next == (uintptr_t)gc) {
+        if (GC_NEXT(&wrcb_to_call) == gc) {
             /* object is still alive -- move it */
+            gc->_gc_next &= ~NEXT_MASK_FROZEN;
             gc_list_move(gc, old);
         }
         else {
@@ -1054,6 +1821,7 @@ clear_freelists(PyInterpreterState *interp)
     _PyFloat_ClearFreeList(interp);
     _PyList_ClearFreeList(interp);
     _PyDict_ClearFreeList(interp);
+    _PyGen_ClearFreeList(interp);
     _PyAsyncGen_ClearFreeLists(interp);
     _PyContext_ClearFreeList(interp);
 }
@@ -1077,6 +1845,15 @@ show_stats_each_generations(GCState *gcstate)
         buf, gc_list_size(&gcstate->permanent_generation.head));
 }
 
+/* Number of objects visited by each step of deduce_unreachable() */
+struct gc_visits {
+    Py_ssize_t update_refs;
+    Py_ssize_t subtract_refs;
+    /* counting the objects moved back to base once per visit, and the
+       objects traversed by the marking threads */
+    Py_ssize_t move_unreachable;
+};
+
 /* Deduce which objects among "base" are unreachable from outside the list
    and move them to 'unreachable'. The process consist in the following steps:
 
@@ -1103,17 +1880,25 @@ IMPORTANT: This function leaves 'unreachable' with the NEXT_MASK_UNREACHABLE
 flag set but it does not clear it to skip unnecessary iteration. Before the
 flag is cleared (for example, by using 'clear_unreachable_mask' function or
 by a call to 'move_legacy_finalizers'), the 'unreachable' list is not a normal
-list and we can not use most gc_list_* functions for it. */
+list and we can not use most gc_list_* functions for it.
+
+If nthreads > 1 and base is large, step 3 is done by nthreads threads (see
+gc_mark_parallel()).
+
+The numbers of objects visited by the three steps are added to visits. */
 static inline void
-deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable) {
+deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable, int nthreads,
+                   struct gc_visits *visits) {
+    Py_ssize_t n;
     validate_list(base, collecting_clear_unreachable_clear);
     /* Using ob_refcnt and gc_refs, calculate which objects in the
      * container set are reachable from outside the set (i.e., have a
      * refcount greater than 0 when all the references within the
      * set are taken into account).
      */
-    update_refs(base);  // gc_prev is used for gc_refs
-    subtract_refs(base);
+    n = update_refs(base);  // gc_prev is used for gc_refs
+    visits->update_refs += n;
+    visits->subtract_refs += subtract_refs(base);
 
     /* Leave everything reachable from outside base in base, and move
      * everything else (in base) to unreachable.
@@ -1151,7 +1936,17 @@ deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable) {
      * worth complicating the code to speed just a little.
      */
     gc_list_init(unreachable);
-    move_unreachable(base, unreachable);  // gc_prev is pointer again
+    Py_ssize_t traversed = -1;
+    if (nthreads > 1 && n >= GC_PARALLEL_MIN_OBJECTS) {
+        traversed = gc_mark_parallel(base, n, nthreads);
+    }
+    if (traversed >= 0) {
+        visits->move_unreachable += traversed + move_unmarked(base, unreachable);
+    }
+    else {
+        // gc_prev is pointer again
+        visits->move_unreachable += move_unreachable(base, unreachable);
+    }
     validate_list(base, collecting_clear_unreachable_clear);
     validate_list(unreachable, collecting_set_unreachable_set);
 }
@@ -1168,10 +1963,12 @@ deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable) {
 
 IMPORTANT: After a call to this function, the 'still_unreachable' set will have the
 PREV_MARK_COLLECTING set, but the objects in this set are going to be removed so
-we can skip the expense of clearing the flag to avoid extra iteration. */
+we can skip the expense of clearing the flag to avoid extra iteration.
+
+The numbers of objects visited by deduce_unreachable() are added to visits. */
 static inline void
 handle_resurrected_objects(PyGC_Head *unreachable, PyGC_Head* still_unreachable,
-                           PyGC_Head *old_generation)
+                           PyGC_Head *old_generation, struct gc_visits *visits)
 {
     // Remove the PREV_MASK_COLLECTING from unreachable
     // to prepare it for a new call to 'deduce_unreachable'
@@ -1181,19 +1978,377 @@ handle_resurrected_objects(PyGC_Head *unreachable, PyGC_Head* still_unreachable,
     // have the PREV_MARK_COLLECTING set, but the objects are going to be
     // removed so we can skip the expense of clearing the flag.
     PyGC_Head* resurrected = unreachable;
-    deduce_unreachable(resurrected, still_unreachable);
+    deduce_unreachable(resurrected, still_unreachable, 1, visits);
     clear_unreachable_mask(still_unreachable);
 
     // Move the resurrected objects to the old generation for future collection.
     gc_list_merge(resurrected, old_generation);
 }
 
+/* The work done by a collection, reported to the callbacks and accumulated
+ * in gc_generation_stats.
+ */
+struct gc_work {
+    _PyTime_t duration;
+    struct gc_visits visited; /* # objects visited by deduce_unreachable() */
+    Py_ssize_t survived; /* # reachable objects */
+    _PyTime_t weakrefs_duration; /* time spent in handle_weakrefs() */
+    _PyTime_t finalize_duration; /* time spent in finalize_garbage() */
+};
+
+/* Return the index of the histogram bucket of value */
+static int
+gc_histogram_bucket(int64_t value)
+{
+    if (value <= 0) {
+        return 0;
+    }
+    if (value >= ((int64_t)1 << (GC_HISTOGRAM_SIZE - 2))) {
+        return GC_HISTOGRAM_SIZE - 1;
+    }
+    return _Py_bit_length((unsigned long)value);
+}
+
+static Py_ssize_t
+gc_visits_total(const struct gc_visits *visits)
+{
+    return visits->update_refs + visits->subtract_refs
+           + visits->move_unreachable;
+}
+
+/* Add the work of a collection to the stats of its generation */
+static void
+gc_record_work(struct gc_generation_stats *stats, const struct gc_work *work)
+{
+    Py_ssize_t visited = gc_visits_total(&work->visited);
+    stats->duration += work->duration;
+    stats->visited += visited;
+    stats->visited_update_refs += work->visited.update_refs;
+    stats->visited_subtract_refs += work->visited.subtract_refs;
+    stats->visited_move_unreachable += work->visited.move_unreachable;
+    stats->survived += work->survived;
+    stats->weakrefs_duration += work->weakrefs_duration;
+    stats->finalize_duration += work->finalize_duration;
+    int64_t us = _PyTime_AsMicroseconds(work->duration, _PyTime_ROUND_FLOOR);
+    stats->duration_histogram[gc_histogram_bucket(us)]++;
+    stats->visited_histogram[gc_histogram_bucket(visited)]++;
+}
+
+/* Adaptive thresholds.
+
+   With PyConfig.gc_adaptive, the thresholds of the young generations follow
+   the survival rate of their collections.  When nearly all the objects a
+   collection examines survive, as while building large acyclic structures,
+   the collection was mostly wasted: the threshold of the generation is
+   doubled, up to GC_ADAPTIVE_MAX_SCALE times the threshold set by
+   gc.set_threshold().  When most of them are garbage, it is halved again,
+   never below the threshold set by gc.set_threshold().  The cost of the
+   collections lowers the survival rate needed to double the threshold:
+   while the collections of a generation take more than 1/GC_ADAPTIVE_COST
+   of the time, it is enough that most of the objects survive.
+
+   The oldest generation isn't adapted: long_lived_pending already keeps
+   the cost of the full collections proportional to the heap.
+*/
+#define GC_ADAPTIVE_MAX_SCALE 64
+#define GC_ADAPTIVE_COST 20
+
+static void
+gc_adapt_threshold(GCState *gcstate, int generation, Py_ssize_t survived,
+                   Py_ssize_t examined, _PyTime_t duration, _PyTime_t end)
+{
+    assert(generation < NUM_GENERATIONS - 1);
+    struct gc_generation *gen = &gcstate->generations[generation];
+    int64_t base = gcstate->base_thresholds[generation];
+    _PyTime_t interval = end - gcstate->last_collection_end[generation];
+    gcstate->last_collection_end[generation] = end;
+    if (base == 0 || examined == 0) {
+        return;
+    }
+    int costly = duration > interval / GC_ADAPTIVE_COST;
+    if (survived > examined - examined / 8
+        || (costly && survived > examined / 2))
+    {
+        if (gen->threshold <= base * (GC_ADAPTIVE_MAX_SCALE / 2)
+            && gen->threshold <= INT_MAX / 2)
+        {
+            gen->threshold *= 2;
+        }
+    }
+    else if (survived < examined / 2) {
+        gen->threshold = (int)Py_MAX(gen->threshold / 2, base);
+    }
+}
+
+/* Dispose of the objects in 'unreachable', which deduce_unreachable() found
+ * unreachable from outside the objects being collected.  Objects that turn
+ * out to be alive after all are moved to 'old'.  The numbers of collected
+ * and uncollectable objects are stored in *n_collected and *n_uncollectable,
+ * and the work done is added to *work.
+ */
+static void
+gc_collect_unreachable(PyThreadState *tstate, GCState *gcstate,
+                       PyGC_Head *unreachable, PyGC_Head *old,
+                       Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
+                       struct gc_work *work)
+{
+    Py_ssize_t m = 0; /* # objects collected */
+    Py_ssize_t n = 0; /* # unreachable objects that couldn't be collected */
+    PyGC_Head finalizers;  /* objects with, & reachable from, __del__ */
+    PyGC_Head *gc;
+
+    /* All objects in unreachable are trash, but objects reachable from
+     * legacy finalizers (e.g. tp_del) can't safely be deleted.
+     */
+    gc_list_init(&finalizers);
+    // NEXT_MASK_UNREACHABLE is cleared here.
+    // After move_legacy_finalizers(), unreachable is normal list.
+    move_legacy_finalizers(unreachable, &finalizers);
+    /* finalizers contains the unreachable objects with a legacy finalizer;
+     * unreachable objects reachable *from* those are also uncollectable,
+     * and we move those into the finalizers list too.
+     */
+    move_legacy_finalizer_reachable(&finalizers);
+
+    validate_list(&finalizers, collecting_clear_unreachable_clear);
+    validate_list(unreachable, collecting_set_unreachable_clear);
+
+    /* Print debugging information. */
+    if (gcstate->debug & DEBUG_COLLECTABLE) {
+        for (gc = GC_NEXT(unreachable); gc != unreachable; gc = GC_NEXT(gc)) {
+            debug_cycle("collectable", FROM_GC(gc));
+        }
+    }
+
+    /* Clear weakrefs and invoke callbacks as necessary. */
+    _PyTime_t t = _PyTime_GetPerfCounter();
+    m += handle_weakrefs(unreachable, old);
+    work->weakrefs_duration += _PyTime_GetPerfCounter() - t;
+
+    validate_list(old, collecting_clear_unreachable_clear);
+    validate_list(unreachable, collecting_set_unreachable_clear);
+
+    /* Call tp_finalize on objects which have one. */
+    t = _PyTime_GetPerfCounter();
+    finalize_garbage(tstate, unreachable);
+    work->finalize_duration += _PyTime_GetPerfCounter() - t;
+
+    /* Handle any objects that may have resurrected after the call
+     * to 'finalize_garbage' and continue the collection with the
+     * objects that are still unreachable */
+    PyGC_Head final_unreachable;
+    handle_resurrected_objects(unreachable, &final_unreachable, old,
+                               &work->visited);
+
+    /* Call tp_clear on objects in the final_unreachable set.  This will cause
+    * the reference cycles to be broken.  It may also cause some objects
+    * in finalizers to be freed.
+    */
+    m += gc_list_size(&final_unreachable);
+    delete_garbage(tstate, gcstate, &final_unreachable, old);
+
+    /* Collect statistics on uncollectable objects found and print
+     * debugging information. */
+    for (gc = GC_NEXT(&finalizers); gc != &finalizers; gc = GC_NEXT(gc)) {
+        n++;
+        if (gcstate->debug & DEBUG_UNCOLLECTABLE)
+            debug_cycle("uncollectable", FROM_GC(gc));
+    }
+
+    /* Append instances in the uncollectable set to a Python
+     * reachable list of garbage.  The programmer has to deal with
+     * this if they insist on creating this type of structure.
+     */
+    handle_legacy_finalizers(tstate, gcstate, &finalizers, old);
+    validate_list(old, collecting_clear_unreachable_clear);
+
+    *n_collected = m;
+    *n_uncollectable = n;
+}
+
+/* Incremental collection of the oldest generation.
+
+   The cost of collecting the oldest generation grows with the number of
+   long-lived objects, and so does the pause of the program.  When
+   gc.set_incremental() gives a pause budget, the oldest generation is
+   instead collected over many increments, interleaved with the program.
+   Every collection triggered by allocations is then an increment, which
+   collects the young generations together with a slice of the oldest one,
+   sized so that the increment takes about the budget.
+
+   Collecting any set of objects is safe, since objects referenced from
+   outside the set are considered reachable.  To find the garbage cycles
+   that straddle slices, a slice is extended with the objects it refers to,
+   transitively, that the incremental collection has not visited yet.  The
+   old space bit of _gc_next tells those objects apart: objects whose bit
+   is gcstate->visited_space were visited already, the others are at the
+   front of the oldest generation list and are taken in order.  Once all
+   objects are visited, flipping visited_space makes them all unvisited
+   for the next incremental collection.
+
+   Extending the slices would soon reach most of the heap through modules
+   and classes, so an incremental collection first marks the objects
+   reachable from the sys and builtins modules as visited, a budget at a
+   time too.  Marking is only a hint: an object that became garbage after
+   it was marked is collected by the next incremental collection.  The
+   marked objects that remain to be traversed wait in the mark_pending
+   list, which holds no references: an object the program drops meanwhile
+   is deallocated and leaves the list as usual.  Code walking the
+   generation lists first puts them back into the oldest generation with
+   gc_stop_marking(), leaving their referents to the slices.
+*/
+
+enum {
+    GC_PHASE_NONE,      /* no incremental collection in progress */
+    GC_PHASE_MARK,      /* marking the objects reachable from the roots */
+    GC_PHASE_COLLECT,   /* collecting slices of the oldest generation */
+};
+
+/* Number of objects an increment examines until the pace of the collector
+   is known */
+#define INCREMENT_INITIAL_WORK 10000
+
+/* Minimum number of old objects an increment examines, so that the
+   incremental collection progresses even if the young generations alone
+   exceed the budget */
+#define INCREMENT_MIN_WORK 100
+
+/* Old space for the objects entering the oldest generation: they are
+   skipped by the incremental collection in progress, if any. */
+static int
+gc_promotion_space(GCState *gcstate)
+{
+    if (gcstate->incremental_phase == GC_PHASE_NONE) {
+        return gcstate->visited_space ^ NEXT_MASK_OLD_SPACE_1;
+    }
+    return gcstate->visited_space;
+}
+
+/* True if the incremental collection visited the whole oldest generation */
+static int
+gc_old_is_visited(GCState *gcstate)
+{
+    PyGC_Head *old = GEN_HEAD(gcstate, NUM_GENERATIONS-1);
+    return (gc_list_is_empty(old)
+            || gc_old_space(GC_NEXT(old)) == gcstate->visited_space);
+}
+
+/* Put the marked objects that remain to be traversed back into the oldest
+   generation, so that all objects are in the generation lists again. */
+static void
+gc_stop_marking(GCState *gcstate)
+{
+    gc_list_merge(&gcstate->mark_pending, GEN_HEAD(gcstate, NUM_GENERATIONS-1));
+}
+
+/* Give up the incremental collection in progress.  The caller has to make
+   all objects of the oldest generation unvisited again. */
+static void
+gc_abort_incremental(GCState *gcstate)
+{
+    gcstate->incremental_phase = GC_PHASE_NONE;
+    gcstate->increment_survivors = 0;
+    gc_stop_marking(gcstate);
+}
+
+/* A traversal callback for mark_reachable. */
+static int
+visit_mark(PyObject *op, GCState *gcstate)
+{
+    if (!_PyObject_IS_GC(op) || !_PyObject_GC_IS_TRACKED(op)
+        || _Py_IsImmortal(op))
+    {
+        return 0;
+    }
+    PyGC_Head *gc = AS_GC(op);
+    if (gc_is_frozen(gc) || gc_old_space(gc) == gcstate->visited_space) {
+        return 0;
+    }
+    gc_set_old_space(gc, gcstate->visited_space);
+    gc_list_move(gc, &gcstate->mark_pending);
+    gcstate->increment_survivors++;
+    return 0;
+}
+
+/* Traverse up to 'work' marked objects, marking the objects they refer to.
+   Return the number of objects traversed. */
+static Py_ssize_t
+mark_reachable(GCState *gcstate, Py_ssize_t work)
+{
+    Py_ssize_t n = 0;
+    while (!gc_list_is_empty(&gcstate->mark_pending) && n < work) {
+        PyGC_Head *gc = GC_NEXT(&gcstate->mark_pending);
+        PyObject *op = FROM_GC(gc);
+        gc_list_move(gc, GEN_HEAD(gcstate, NUM_GENERATIONS-1));
+        traverseproc traverse = Py_TYPE(op)->tp_traverse;
+        (void) traverse(op, (visitproc)visit_mark, gcstate);
+        n++;
+    }
+    return n;
+}
+
+struct gc_increment {
+    PyGC_Head *head;
+    int visited_space;
+    Py_ssize_t size;
+};
+
+/* A traversal callback for add_old_slice. */
+static int
+visit_add_to_increment(PyObject *op, struct gc_increment *increment)
+{
+    if (!_PyObject_IS_GC(op) || !_PyObject_GC_IS_TRACKED(op)
+        || _Py_IsImmortal(op))
+    {
+        return 0;
+    }
+    PyGC_Head *gc = AS_GC(op);
+    if (gc_is_frozen(gc) || gc_old_space(gc) == increment->visited_space) {
+        return 0;
+    }
+    gc_set_old_space(gc, increment->visited_space);
+    gc_list_move(gc, increment->head);
+    increment->size++;
+    return 0;
+}
+
+/* Move unvisited objects from the front of the oldest generation to
+   'increment' until about 'work' objects were moved, along with the
+   unvisited objects they transitively refer to.  Return the number of
+   objects moved. */
+static Py_ssize_t
+add_old_slice(GCState *gcstate, PyGC_Head *increment, Py_ssize_t work)
+{
+    PyGC_Head *old = GEN_HEAD(gcstate, NUM_GENERATIONS-1);
+    struct gc_increment inc = {increment, gcstate->visited_space, 0};
+    /* The objects after 'scanned' still have to be traversed.  Objects are
+       only appended to the increment, so it stays in the list. */
+    PyGC_Head *scanned = GC_PREV(increment);
+
+    while (inc.size < work) {
+        PyGC_Head *gc = GC_NEXT(old);
+        if (gc == old || gc_old_space(gc) == inc.visited_space) {
+            break;
+        }
+        gc_set_old_space(gc, inc.visited_space);
+        gc_list_move(gc, increment);
+        inc.size++;
+        while (GC_NEXT(scanned) != increment) {
+            scanned = GC_NEXT(scanned);
+            PyObject *op = FROM_GC(scanned);
+            traverseproc traverse = Py_TYPE(op)->tp_traverse;
+            (void) traverse(op, (visitproc)visit_add_to_increment, &inc);
+        }
+    }
+    return inc.size;
+}
+
 /* This is the main function.  Read this to understand how the
  * collection process works. */
 static Py_ssize_t
 gc_collect_main(PyThreadState *tstate, int generation,
                 Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
-                int nofail)
+                struct gc_work *p_work, int nofail)
 {
     int i;
     Py_ssize_t m = 0; /* # objects collected */
@@ -1201,9 +2356,7 @@ gc_collect_main(PyThreadState *tstate, int generation,
     PyGC_Head *young; /* the generation we are examining */
     PyGC_Head *old; /* next older generation */
     PyGC_Head unreachable; /* non-problematic unreachable trash */
-    PyGC_Head finalizers;  /* objects with, & reachable from, __del__ */
-    PyGC_Head *gc;
-    _PyTime_t t1 = 0;   /* initialize to prevent a compiler warning */
+    struct gc_work work = {0};
     GCState *gcstate = &tstate->interp->gc;
 
     // gc_collect_main() must not be called before _PyGC_Init
@@ -1211,11 +2364,18 @@ gc_collect_main(PyThreadState *tstate, int generation,
     assert(gcstate->garbage != NULL);
     assert(!_PyErr_Occurred(tstate));
 
+    if (generation == NUM_GENERATIONS-1
+        && gcstate->incremental_phase != GC_PHASE_NONE)
+    {
+        /* A full collection supersedes the incremental one */
+        gc_abort_incremental(gcstate);
+    }
+
     if (gcstate->debug & DEBUG_STATS) {
         PySys_WriteStderr("gc: collecting generation %d...\n", generation);
         show_stats_each_generations(gcstate);
-        t1 = _PyTime_GetPerfCounter();
     }
+    _PyTime_t t1 = _PyTime_GetPerfCounter();
 
     if (PyDTrace_GC_START_ENABLED())
         PyDTrace_GC_START(generation);
@@ -1239,93 +2399,57 @@ gc_collect_main(PyThreadState *tstate, int generation,
         old = young;
     validate_list(old, collecting_clear_unreachable_clear);
 
-    deduce_unreachable(young, &unreachable);
+    if (gcstate->incremental_budget && generation == NUM_GENERATIONS-2) {
+        /* The survivors are appended to the oldest generation */
+        gc_list_set_space(young, gc_promotion_space(gcstate));
+    }
+
+    deduce_unreachable(
+        young, &unreachable,
+        generation == NUM_GENERATIONS-1 ? gcstate->mark_threads : 1,
+        &work.visited);
 
     untrack_tuples(young);
+    if (young == old) {
+        /* We only un-track dicts in full collections, to avoid quadratic
+           dict build-up. See issue #14775. */
+        untrack_dicts(young);
+    }
+    work.survived = gc_list_size(young);
     /* Move reachable objects to next generation. */
     if (young != old) {
         if (generation == NUM_GENERATIONS - 2) {
-            gcstate->long_lived_pending += gc_list_size(young);
+            gcstate->long_lived_pending += work.survived;
         }
         gc_list_merge(young, old);
     }
     else {
-        /* We only un-track dicts in full collections, to avoid quadratic
-           dict build-up. See issue #14775. */
-        untrack_dicts(young);
         gcstate->long_lived_pending = 0;
-        gcstate->long_lived_total = gc_list_size(young);
-    }
-
-    /* All objects in unreachable are trash, but objects reachable from
-     * legacy finalizers (e.g. tp_del) can't safely be deleted.
-     */
-    gc_list_init(&finalizers);
-    // NEXT_MASK_UNREACHABLE is cleared here.
-    // After move_legacy_finalizers(), unreachable is normal list.
-    move_legacy_finalizers(&unreachable, &finalizers);
-    /* finalizers contains the unreachable objects with a legacy finalizer;
-     * unreachable objects reachable *from* those are also uncollectable,
-     * and we move those into the finalizers list too.
-     */
-    move_legacy_finalizer_reachable(&finalizers);
-
-    validate_list(&finalizers, collecting_clear_unreachable_clear);
-    validate_list(&unreachable, collecting_set_unreachable_clear);
-
-    /* Print debugging information. */
-    if (gcstate->debug & DEBUG_COLLECTABLE) {
-        for (gc = GC_NEXT(&unreachable); gc != &unreachable; gc = GC_NEXT(gc)) {
-            debug_cycle("collectable", FROM_GC(gc));
-        }
+        gcstate->long_lived_total = work.survived;
     }
 
-    /* Clear weakrefs and invoke callbacks as necessary. */
-    m += handle_weakrefs(&unreachable, old);
-
-    validate_list(old, collecting_clear_unreachable_clear);
-    validate_list(&unreachable, collecting_set_unreachable_clear);
-
-    /* Call tp_finalize on objects which have one. */
-    finalize_garbage(tstate, &unreachable);
-
-    /* Handle any objects that may have resurrected after the call
-     * to 'finalize_garbage' and continue the collection with the
-     * objects that are still unreachable */
-    PyGC_Head final_unreachable;
-    handle_resurrected_objects(&unreachable, &final_unreachable, old);
+    gc_collect_unreachable(tstate, gcstate, &unreachable, old, &m, &n, &work);
 
-    /* Call tp_clear on objects in the final_unreachable set.  This will cause
-    * the reference cycles to be broken.  It may also cause some objects
-    * in finalizers to be freed.
-    */
-    m += gc_list_size(&final_unreachable);
-    delete_garbage(tstate, gcstate, &final_unreachable, old);
-
-    /* Collect statistics on uncollectable objects found and print
-     * debugging information. */
-    for (gc = GC_NEXT(&finalizers); gc != &finalizers; gc = GC_NEXT(gc)) {
-        n++;
-        if (gcstate->debug & DEBUG_UNCOLLECTABLE)
-            debug_cycle("uncollectable", FROM_GC(gc));
+    work.duration = _PyTime_GetPerfCounter() - t1;
+    if (gcstate->adaptive && generation < NUM_GENERATIONS-1) {
+        gc_adapt_threshold(gcstate, generation, work.survived,
+                           work.survived + m + n, work.duration,
+                           t1 + work.duration);
     }
     if (gcstate->debug & DEBUG_STATS) {
-        double d = _PyTime_AsSecondsDouble(_PyTime_GetPerfCounter() - t1);
+        double d = _PyTime_AsSecondsDouble(work.duration);
         PySys_WriteStderr(
             "gc: done, %zd unreachable, %zd uncollectable, %.4fs elapsed\n",
             n+m, n, d);
     }
 
-    /* Append instances in the uncollectable set to a Python
-     * reachable list of garbage.  The programmer has to deal with
-     * this if they insist on creating this type of structure.
-     */
-    handle_legacy_finalizers(tstate, gcstate, &finalizers, old);
-    validate_list(old, collecting_clear_unreachable_clear);
-
     /* Clear free list only during the collection of the highest
      * generation */
     if (generation == NUM_GENERATIONS-1) {
+        if (gcstate->incremental_budget) {
+            /* Nothing is visited yet by the next incremental collection */
+            gc_list_set_space(old, gcstate->visited_space ^ NEXT_MASK_OLD_SPACE_1);
+        }
         clear_freelists(tstate->interp);
     }
 
@@ -1345,11 +2469,150 @@ gc_collect_main(PyThreadState *tstate, int generation,
     if (n_uncollectable) {
         *n_uncollectable = n;
     }
+    if (p_work) {
+        *p_work = work;
+    }
 
     struct gc_generation_stats *stats = &gcstate->generation_stats[generation];
     stats->collections++;
     stats->collected += m;
     stats->uncollectable += n;
+    gc_record_work(stats, &work);
+
+    if (PyDTrace_GC_DONE_ENABLED()) {
+        PyDTrace_GC_DONE(n + m);
+    }
+
+    assert(!_PyErr_Occurred(tstate));
+    return n + m;
+}
+
+/* Perform an increment of the incremental collection of the oldest
+ * generation, starting a new incremental collection if none is in progress.
+ */
+static Py_ssize_t
+gc_collect_increment(PyThreadState *tstate,
+                     Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
+                     struct gc_work *p_work)
+{
+    Py_ssize_t m = 0; /* # objects collected */
+    Py_ssize_t n = 0; /* # unreachable objects that couldn't be collected */
+    Py_ssize_t work = 0; /* # objects examined */
+    PyGC_Head increment; /* the objects we are examining */
+    PyGC_Head unreachable; /* non-problematic unreachable trash */
+    struct gc_work work_done = {0};
+    GCState *gcstate = &tstate->interp->gc;
+    PyInterpreterState *interp = tstate->interp;
+
+    assert(gcstate->garbage != NULL);
+    assert(gcstate->incremental_budget > 0);
+    assert(!_PyErr_Occurred(tstate));
+
+    _PyTime_t t1 = _PyTime_GetPerfCounter();
+    if (gcstate->debug & DEBUG_STATS) {
+        PySys_WriteStderr("gc: collecting increment of generation %d...\n",
+                          NUM_GENERATIONS-1);
+        show_stats_each_generations(gcstate);
+    }
+
+    if (PyDTrace_GC_START_ENABLED())
+        PyDTrace_GC_START(NUM_GENERATIONS-1);
+
+    if (gcstate->increment_work == 0) {
+        gcstate->increment_work = INCREMENT_INITIAL_WORK;
+    }
+    if (gcstate->incremental_phase == GC_PHASE_NONE) {
+        assert(gc_list_is_empty(&gcstate->mark_pending));
+        gcstate->incremental_phase = GC_PHASE_MARK;
+        gcstate->increment_survivors = 0;
+        gcstate->generations[NUM_GENERATIONS-1].count = 0;
+        if (interp->sysdict != NULL) {
+            visit_mark(interp->sysdict, gcstate);
+        }
+        if (interp->builtins != NULL) {
+            visit_mark(interp->builtins, gcstate);
+        }
+    }
+    if (gcstate->incremental_phase == GC_PHASE_MARK) {
+        work += mark_reachable(gcstate, gcstate->increment_work);
+        if (gc_list_is_empty(&gcstate->mark_pending)) {
+            gcstate->incremental_phase = GC_PHASE_COLLECT;
+        }
+    }
+
+    /* The young generations are collected as a whole */
+    gc_list_init(&increment);
+    for (int i = 0; i < NUM_GENERATIONS-1; i++) {
+        gc_list_merge(GEN_HEAD(gcstate, i), &increment);
+        gcstate->generations[i].count = 0;
+    }
+    work += gc_list_set_space(&increment, gcstate->visited_space);
+    if (gcstate->incremental_phase == GC_PHASE_COLLECT) {
+        work += add_old_slice(gcstate, &increment,
+                              Py_MAX(gcstate->increment_work - work,
+                                     INCREMENT_MIN_WORK));
+    }
+
+    deduce_unreachable(&increment, &unreachable, 1, &work_done.visited);
+    untrack_tuples(&increment);
+    /* Every object is examined once per incremental collection, so this
+       doesn't cause the quadratic build-up of issue #14775. */
+    untrack_dicts(&increment);
+    gc_collect_unreachable(tstate, gcstate, &unreachable, &increment,
+                           &m, &n, &work_done);
+    gcstate->increment_survivors += gc_list_size(&increment);
+    gc_list_merge(&increment, GEN_HEAD(gcstate, NUM_GENERATIONS-1));
+
+    if (gcstate->incremental_phase == GC_PHASE_COLLECT
+        && gc_old_is_visited(gcstate))
+    {
+        /* The whole oldest generation was collected */
+        gcstate->visited_space ^= NEXT_MASK_OLD_SPACE_1;
+        gcstate->incremental_phase = GC_PHASE_NONE;
+        gcstate->long_lived_pending = 0;
+        gcstate->long_lived_total = gcstate->increment_survivors;
+        gcstate->generation_stats[NUM_GENERATIONS-1].collections++;
+        clear_freelists(interp);
+    }
+
+    if (_PyErr_Occurred(tstate)) {
+        _PyErr_WriteUnraisableMsg("in garbage collection", NULL);
+    }
+
+    _PyTime_t pause = _PyTime_GetPerfCounter() - t1;
+    work_done.duration = pause;
+
+    *n_collected = m;
+    *n_uncollectable = n;
+    *p_work = work_done;
+
+    struct gc_generation_stats *stats =
+        &gcstate->generation_stats[NUM_GENERATIONS-1];
+    stats->collected += m;
+    stats->uncollectable += n;
+    gc_record_work(stats, &work_done);
+
+    struct gc_increment_stats *istats = &gcstate->increment_stats;
+    istats->pauses[istats->increments % GC_INCREMENT_HISTORY] = pause;
+    istats->increments++;
+    if (pause > istats->max_pause) {
+        istats->max_pause = pause;
+    }
+    /* Size the next increment after the pace of this one */
+    if (pause > 0) {
+        double target = (double)work * gcstate->incremental_budget / pause;
+        target = Py_MIN(target, (double)(PY_SSIZE_T_MAX / 2));
+        gcstate->increment_work = Py_MAX(
+            (gcstate->increment_work + (Py_ssize_t)target) / 2,
+            INCREMENT_MIN_WORK);
+    }
+
+    if (gcstate->debug & DEBUG_STATS) {
+        PySys_WriteStderr(
+            "gc: done, %zd objects examined, %zd unreachable, "
+            "%zd uncollectable, %.4fs elapsed\n",
+            work, n+m, n, _PyTime_AsSecondsDouble(pause));
+    }
 
     if (PyDTrace_GC_DONE_ENABLED()) {
         PyDTrace_GC_DONE(n + m);
@@ -1365,7 +2628,7 @@ gc_collect_main(PyThreadState *tstate, int generation,
 static void
 invoke_gc_callback(PyThreadState *tstate, const char *phase,
                    int generation, Py_ssize_t collected,
-                   Py_ssize_t uncollectable)
+                   Py_ssize_t uncollectable, const struct gc_work *work)
 {
     assert(!_PyErr_Occurred(tstate));
 
@@ -1379,10 +2642,17 @@ invoke_gc_callback(PyThreadState *tstate, const char *phase,
     assert(PyList_CheckExact(gcstate->callbacks));
     PyObject *info = NULL;
     if (PyList_GET_SIZE(gcstate->callbacks) != 0) {
-        info = Py_BuildValue("{sisnsn}",
+        info = Py_BuildValue("{sisnsnsdsnsnsnsnsdsd}",
             "generation", generation,
             "collected", collected,
-            "uncollectable", uncollectable);
+            "uncollectable", uncollectable,
+            "duration", _PyTime_AsSecondsDouble(work->duration),
+            "visited", gc_visits_total(&work->visited),
+            "visited_update_refs", work->visited.update_refs,
+            "visited_subtract_refs", work->visited.subtract_refs,
+            "visited_move_unreachable", work->visited.move_unreachable,
+            "weakrefs_duration", _PyTime_AsSecondsDouble(work->weakrefs_duration),
+            "finalize_duration", _PyTime_AsSecondsDouble(work->finalize_duration));
         if (info == NULL) {
             PyErr_WriteUnraisable(NULL);
             return;
@@ -1422,9 +2692,29 @@ gc_collect_with_callback(PyThreadState *tstate, int generation)
 {
     assert(!_PyErr_Occurred(tstate));
     Py_ssize_t result, collected, uncollectable;
-    invoke_gc_callback(tstate, "start", generation, 0, 0);
-    result = gc_collect_main(tstate, generation, &collected, &uncollectable, 0);
-    invoke_gc_callback(tstate, "stop", generation, collected, uncollectable);
+    struct gc_work work = {0};
+    invoke_gc_callback(tstate, "start", generation, 0, 0, &work);
+    result = gc_collect_main(tstate, generation, &collected, &uncollectable,
+                             &work, 0);
+    invoke_gc_callback(tstate, "stop", generation, collected, uncollectable,
+                       &work);
+    assert(!_PyErr_Occurred(tstate));
+    return result;
+}
+
+/* Perform an increment of the incremental collection and invoke
+ * progress callbacks.
+ */
+static Py_ssize_t
+gc_collect_increment_with_callback(PyThreadState *tstate)
+{
+    assert(!_PyErr_Occurred(tstate));
+    Py_ssize_t result, collected, uncollectable;
+    struct gc_work work = {0};
+    invoke_gc_callback(tstate, "start", NUM_GENERATIONS - 1, 0, 0, &work);
+    result = gc_collect_increment(tstate, &collected, &uncollectable, &work);
+    invoke_gc_callback(tstate, "stop", NUM_GENERATIONS - 1,
+                       collected, uncollectable, &work);
     assert(!_PyErr_Occurred(tstate));
     return result;
 }
@@ -1478,6 +2768,15 @@ gc_collect_generations(PyThreadState *tstate)
             if (i == NUM_GENERATIONS - 1
                 && gcstate->long_lived_pending < gcstate->long_lived_total / 4)
                 continue;
+            /* Once an incremental collection of the oldest generation has
+               started, every collection carries it a step further. */
+            if (gcstate->incremental_budget
+                && (i == NUM_GENERATIONS - 1
+                    || gcstate->incremental_phase != GC_PHASE_NONE))
+            {
+                n = gc_collect_increment_with_callback(tstate);
+                break;
+            }
             n = gc_collect_with_callback(tstate, i);
             break;
         }
@@ -1618,14 +2917,17 @@ static PyObject *
 gc_set_threshold(PyObject *self, PyObject *args)
 {
     GCState *gcstate = get_gc_state();
+    int *thresholds = gcstate->base_thresholds;
     if (!PyArg_ParseTuple(args, "i|ii:set_threshold",
-                          &gcstate->generations[0].threshold,
-                          &gcstate->generations[1].threshold,
-                          &gcstate->generations[2].threshold))
+                          &thresholds[0], &thresholds[1], &thresholds[2]))
         return NULL;
     for (int i = 3; i < NUM_GENERATIONS; i++) {
         /* generations higher than 2 get the same threshold */
-        gcstate->generations[i].threshold = gcstate->generations[2].threshold;
+        thresholds[i] = thresholds[2];
+    }
+    /* Adapted thresholds start again from the new ones */
+    for (int i = 0; i < NUM_GENERATIONS; i++) {
+        gcstate->generations[i].threshold = thresholds[i];
     }
     Py_RETURN_NONE;
 }
@@ -1642,9 +2944,116 @@ gc_get_threshold_impl(PyObject *module)
 {
     GCState *gcstate = get_gc_state();
     return Py_BuildValue("(iii)",
-                         gcstate->generations[0].threshold,
-                         gcstate->generations[1].threshold,
-                         gcstate->generations[2].threshold);
+                         gcstate->base_thresholds[0],
+                         gcstate->base_thresholds[1],
+                         gcstate->base_thresholds[2]);
+}
+
+/*[clinic input]
+gc.set_incremental
+
+    budget: object
+    /
+
+Collect the oldest generation incrementally, pausing about budget seconds at a time.
+
+A budget of 0 collects the oldest generation all at once.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_incremental(PyObject *module, PyObject *budget)
+/*[clinic end generated code: output=6a3c4a1498708ace input=d3496b79dcf640ab]*/
+
+{
+    _PyTime_t t;
+    if (_PyTime_FromSecondsObject(&t, budget, _PyTime_ROUND_CEILING) < 0) {
+        return NULL;
+    }
+    if (t < 0) {
+        PyErr_SetString(PyExc_ValueError, "budget must be non-negative");
+        return NULL;
+    }
+
+    GCState *gcstate = get_gc_state();
+    if (t > 0 && gcstate->incremental_budget == 0) {
+        /* Nothing is visited yet by the first incremental collection */
+        gc_list_set_space(GEN_HEAD(gcstate, NUM_GENERATIONS-1),
+                          gcstate->visited_space ^ NEXT_MASK_OLD_SPACE_1);
+        gc_list_set_frozen(&gcstate->permanent_generation.head, 1);
+        gcstate->increment_work = 0;
+        gcstate->incremental_budget = t;
+    }
+    else if (t == 0 && gcstate->incremental_budget > 0) {
+        gcstate->incremental_budget = 0;
+        gc_list_set_frozen(&gcstate->permanent_generation.head, 0);
+        gc_abort_incremental(gcstate);
+    }
+    else {
+        gcstate->incremental_budget = t;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_incremental
+
+Return the pause budget of the incremental collection in seconds.
+
+Return 0.0 if the oldest generation is collected all at once.
+[clinic start generated code]*/
+
+static PyObject *
+gc_get_incremental_impl(PyObject *module)
+/*[clinic end generated code: output=7dd3078b18c0e4ba input=1b0596f82890f8a7]*/
+
+{
+    GCState *gcstate = get_gc_state();
+    return PyFloat_FromDouble(
+        _PyTime_AsSecondsDouble(gcstate->incremental_budget));
+}
+
+/*[clinic input]
+gc.set_mark_threads
+
+    threads: int
+    /
+
+Use threads threads to find the reachable objects in full collections.
+
+A value of 0 or 1 finds them with the collecting thread only.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_mark_threads_impl(PyObject *module, int threads)
+/*[clinic end generated code: output=1ef7fe9de3b51ba5 input=66c7491c32f920fe]*/
+
+{
+    if (threads < 0) {
+        PyErr_SetString(PyExc_ValueError, "threads must be non-negative");
+        return NULL;
+    }
+    GCState *gcstate = get_gc_state();
+    if (gcstate->mark_pool != NULL && threads != gcstate->mark_threads) {
+        gc_mark_pool_stop(gcstate->mark_pool);
+        gcstate->mark_pool = NULL;
+    }
+    gcstate->mark_threads = threads;
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_mark_threads -> int
+
+Return the number of threads finding the reachable objects in full collections.
+[clinic start generated code]*/
+
+static int
+gc_get_mark_threads_impl(PyObject *module)
+/*[clinic end generated code: output=69def07a8661eb7c input=53bec6b74e4794da]*/
+
+{
+    GCState *gcstate = get_gc_state();
+    return Py_MAX(gcstate->mark_threads, 1);
 }
 
 /*[clinic input]
@@ -1710,6 +3119,7 @@ gc_get_referrers(PyObject *self, PyObject *args)
     }
 
     GCState *gcstate = get_gc_state();
+    gc_stop_marking(gcstate);
     for (int i = 0; i < NUM_GENERATIONS; i++) {
         if (!(gc_referrers_for(args, GEN_HEAD(gcstate, i), result))) {
             Py_DECREF(result);
@@ -1787,6 +3197,7 @@ gc_get_objects_impl(PyObject *module, Py_ssize_t generation)
     if (result == NULL) {
         return NULL;
     }
+    gc_stop_marking(gcstate);
 
     /* If generation is passed, we extract only that generation */
     if (generation != -1) {
@@ -1824,6 +3235,47 @@ gc_get_objects_impl(PyObject *module, Py_ssize_t generation)
     return NULL;
 }
 
+/* Return the pauses of the last increments, oldest first */
+static PyObject *
+increment_pauses(struct gc_increment_stats *st)
+{
+    Py_ssize_t count = Py_MIN(st->increments, GC_INCREMENT_HISTORY);
+    PyObject *pauses = PyList_New(count);
+    if (pauses == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < count; i++) {
+        Py_ssize_t index = (st->increments - count + i) % GC_INCREMENT_HISTORY;
+        PyObject *pause = PyFloat_FromDouble(
+            _PyTime_AsSecondsDouble(st->pauses[index]));
+        if (pause == NULL) {
+            Py_DECREF(pauses);
+            return NULL;
+        }
+        PyList_SET_ITEM(pauses, i, pause);
+    }
+    return pauses;
+}
+
+/* Return the counts of a histogram of gc_generation_stats */
+static PyObject *
+histogram_list(const Py_ssize_t *histogram)
+{
+    PyObject *list = PyList_New(GC_HISTOGRAM_SIZE);
+    if (list == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < GC_HISTOGRAM_SIZE; i++) {
+        PyObject *count = PyLong_FromSsize_t(histogram[i]);
+        if (count == NULL) {
+            Py_DECREF(list);
+            return NULL;
+        }
+        PyList_SET_ITEM(list, i, count);
+    }
+    return list;
+}
+
 /*[clinic input]
 gc.get_stats
 
@@ -1836,13 +3288,17 @@ gc_get_stats_impl(PyObject *module)
 {
     int i;
     struct gc_generation_stats stats[NUM_GENERATIONS], *st;
+    int thresholds[NUM_GENERATIONS];
+    struct gc_increment_stats istats;
 
     /* To get consistent values despite allocations while constructing
        the result list, we use a snapshot of the running stats. */
     GCState *gcstate = get_gc_state();
     for (i = 0; i < NUM_GENERATIONS; i++) {
         stats[i] = gcstate->generation_stats[i];
+        thresholds[i] = gcstate->generations[i].threshold;
     }
+    istats = gcstate->increment_stats;
 
     PyObject *result = PyList_New(0);
     if (result == NULL)
@@ -1851,13 +3307,56 @@ gc_get_stats_impl(PyObject *module)
     for (i = 0; i < NUM_GENERATIONS; i++) {
         PyObject *dict;
         st = &stats[i];
-        dict = Py_BuildValue("{snsnsn}",
+        PyObject *duration_histogram = histogram_list(st->duration_histogram);
+        if (duration_histogram == NULL)
+            goto error;
+        PyObject *visited_histogram = histogram_list(st->visited_histogram);
+        if (visited_histogram == NULL) {
+            Py_DECREF(duration_histogram);
+            goto error;
+        }
+        dict = Py_BuildValue("{snsnsnsdsnsnsnsnsnsisdsdsNsN}",
                              "collections", st->collections,
                              "collected", st->collected,
-                             "uncollectable", st->uncollectable
+                             "uncollectable", st->uncollectable,
+                             "duration",
+                             _PyTime_AsSecondsDouble(st->duration),
+                             "visited", st->visited,
+                             "visited_update_refs", st->visited_update_refs,
+                             "visited_subtract_refs",
+                             st->visited_subtract_refs,
+                             "visited_move_unreachable",
+                             st->visited_move_unreachable,
+                             "survived", st->survived,
+                             "threshold", thresholds[i],
+                             "weakrefs_duration",
+                             _PyTime_AsSecondsDouble(st->weakrefs_duration),
+                             "finalize_duration",
+                             _PyTime_AsSecondsDouble(st->finalize_duration),
+                             "duration_histogram", duration_histogram,
+                             "visited_histogram", visited_histogram
                             );
         if (dict == NULL)
             goto error;
+        if (i == NUM_GENERATIONS - 1) {
+            PyObject *pauses = increment_pauses(&istats);
+            if (pauses == NULL) {
+                Py_DECREF(dict);
+                goto error;
+            }
+            PyObject *value = Py_BuildValue("{snsdsN}",
+                                 "increments", istats.increments,
+                                 "max_increment_pause",
+                                 _PyTime_AsSecondsDouble(istats.max_pause),
+                                 "increment_pauses", pauses
+                                );
+            if (value == NULL || PyDict_Update(dict, value) < 0) {
+                Py_XDECREF(value);
+                Py_DECREF(dict);
+                goto error;
+            }
+            Py_DECREF(value);
+        }
         if (PyList_Append(result, dict)) {
             Py_DECREF(dict);
             goto error;
@@ -1915,25 +3414,119 @@ gc_is_finalized(PyObject *module, PyObject *obj)
     Py_RETURN_FALSE;
 }
 
+/* Untracked and non-container objects are never on the collector's lists,
+   but their reference counts are written whenever they are used, and they
+   share pages with the containers.  The constants of code objects and the
+   items of untracked tuples are the most common of them, so those are made
+   immortal too, up to a small depth of nesting. */
+#define IMMORTALIZE_MAX_DEPTH 4
+
+static void
+gc_set_immortal(PyObject *op)
+{
+    if (_Py_IsImmortal(op)) {
+        return;
+    }
+#ifdef Py_REF_DEBUG
+    /* The references held now will never be released from the total, as
+       the reference counts of immortal objects are no longer changed */
+    _Py_AddRefTotal(_PyInterpreterState_GET(), -Py_REFCNT(op));
+#endif
+    _Py_SetImmortal(op);
+}
+
+static void
+immortalize_untracked(PyObject *op, int depth)
+{
+    if (_Py_IsImmortal(op)) {
+        return;
+    }
+    gc_set_immortal(op);
+    if (depth >= IMMORTALIZE_MAX_DEPTH) {
+        return;
+    }
+    if (PyCode_Check(op)) {
+        PyObject *consts = ((PyCodeObject *)op)->co_consts;
+        if (!_PyObject_GC_IS_TRACKED(consts)) {
+            immortalize_untracked(consts, depth + 1);
+        }
+    }
+    else if (PyTuple_CheckExact(op)) {
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(op); i++) {
+            PyObject *item = PyTuple_GET_ITEM(op, i);
+            if (!_PyObject_IS_GC(item) || !_PyObject_GC_IS_TRACKED(item)) {
+                immortalize_untracked(item, depth + 1);
+            }
+        }
+    }
+}
+
+/* A traversal callback for gc_immortalize */
+static int
+visit_immortalize(PyObject *op, void *Py_UNUSED(arg))
+{
+    if (!_PyObject_IS_GC(op) || !_PyObject_GC_IS_TRACKED(op)) {
+        immortalize_untracked(op, 0);
+    }
+    return 0;
+}
+
+/* Make every object of the list immortal, with the untracked objects it
+   refers to, and untrack it.  The collector never reads or writes the
+   GC header or the reference count of the objects again, so the pages
+   holding them stay shared with the parent after a fork(). */
+static Py_ssize_t
+gc_immortalize(PyGC_Head *list)
+{
+    Py_ssize_t n = 0;
+    while (!gc_list_is_empty(list)) {
+        PyGC_Head *gc = GC_NEXT(list);
+        PyObject *op = FROM_GC(gc);
+        traverseproc traverse = Py_TYPE(op)->tp_traverse;
+        (void) traverse(op, visit_immortalize, NULL);
+        gc_set_immortal(op);
+        _PyObject_GC_UNTRACK(op);
+        n++;
+    }
+    return n;
+}
+
 /*[clinic input]
 gc.freeze
 
+    *
+    immortalize: bool = False
+
 Freeze all current tracked objects and ignore them for future collections.
 
 This can be used before a POSIX fork() call to make the gc copy-on-write friendly.
 Note: collection before a POSIX fork() call may free pages for future allocation
 which can cause copy-on-write.
+
+If immortalize is true, the frozen objects are also made immortal and are no
+longer tracked, so that neither the collector nor reference counting write
+to them.  They are never deallocated, and unfreeze() doesn't affect them.
 [clinic start generated code]*/
 
 static PyObject *
-gc_freeze_impl(PyObject *module)
-/*[clinic end generated code: output=502159d9cdc4c139 input=b602b16ac5febbe5]*/
+gc_freeze_impl(PyObject *module, int immortalize)
+/*[clinic end generated code: output=db32b5465626796f input=627ea9e77221ad8d]*/
 {
     GCState *gcstate = get_gc_state();
+    if (gcstate->incremental_phase != GC_PHASE_NONE) {
+        gc_abort_incremental(gcstate);
+    }
     for (int i = 0; i < NUM_GENERATIONS; ++i) {
+        if (gcstate->incremental_budget) {
+            gc_list_set_frozen(GEN_HEAD(gcstate, i), 1);
+        }
         gc_list_merge(GEN_HEAD(gcstate, i), &gcstate->permanent_generation.head);
         gcstate->generations[i].count = 0;
     }
+    if (immortalize) {
+        gcstate->immortalized +=
+            gc_immortalize(&gcstate->permanent_generation.head);
+    }
     Py_RETURN_NONE;
 }
 
@@ -1950,6 +3543,11 @@ gc_unfreeze_impl(PyObject *module)
 /*[clinic end generated code: output=1c15f2043b25e169 input=2dd52b170f4cef6c]*/
 {
     GCState *gcstate = get_gc_state();
+    if (gcstate->incremental_budget) {
+        gc_list_set_frozen(&gcstate->permanent_generation.head, 0);
+        gc_list_set_space(&gcstate->permanent_generation.head,
+                          gc_promotion_space(gcstate));
+    }
     gc_list_merge(&gcstate->permanent_generation.head,
                   GEN_HEAD(gcstate, NUM_GENERATIONS-1));
     Py_RETURN_NONE;
@@ -1959,14 +3557,17 @@ gc_unfreeze_impl(PyObject *module)
 gc.get_freeze_count -> Py_ssize_t
 
 Return the number of objects in the permanent generation.
+
+This includes the objects that freeze() made immortal.
 [clinic start generated code]*/
 
 static Py_ssize_t
 gc_get_freeze_count_impl(PyObject *module)
-/*[clinic end generated code: output=61cbd9f43aa032e1 input=45ffbc65cfe2a6ed]*/
+/*[clinic end generated code: output=61cbd9f43aa032e1 input=3533f75f587866bd]*/
 {
     GCState *gcstate = get_gc_state();
-    return gc_list_size(&gcstate->permanent_generation.head);
+    return gc_list_size(&gcstate->permanent_generation.head) +
+           gcstate->immortalized;
 }
 
 
@@ -1983,6 +3584,10 @@ PyDoc_STRVAR(gc__doc__,
 "get_debug() -- Get debugging flags.\n"
 "set_threshold() -- Set the collection thresholds.\n"
 "get_threshold() -- Return the current the collection thresholds.\n"
+"set_incremental() -- Collect the oldest generation incrementally.\n"
+"get_incremental() -- Return the pause budget of the incremental collection.\n"
+"set_mark_threads() -- Find reachable objects in parallel in full collections.\n"
+"get_mark_threads() -- Return the number of threads finding reachable objects.\n"
 "get_objects() -- Return a list of all objects tracked by the collector.\n"
 "is_tracked() -- Returns true if a given object is tracked.\n"
 "is_finalized() -- Returns true if a given object has been already finalized.\n"
@@ -2001,6 +3606,10 @@ static PyMethodDef GcMethods[] = {
     GC_GET_COUNT_METHODDEF
     {"set_threshold",  gc_set_threshold, METH_VARARGS, gc_set_thresh__doc__},
     GC_GET_THRESHOLD_METHODDEF
+    GC_SET_INCREMENTAL_METHODDEF
+    GC_GET_INCREMENTAL_METHODDEF
+    GC_SET_MARK_THREADS_METHODDEF
+    GC_GET_MARK_THREADS_METHODDEF
     GC_COLLECT_METHODDEF
     GC_GET_OBJECTS_METHODDEF
     GC_GET_STATS_METHODDEF
@@ -2132,7 +3741,7 @@ _PyGC_CollectNoFail(PyThreadState *tstate)
 
     Py_ssize_t n;
     gcstate->collecting = 1;
-    n = gc_collect_main(tstate, NUM_GENERATIONS - 1, NULL, NULL, 1);
+    n = gc_collect_main(tstate, NUM_GENERATIONS - 1, NULL, NULL, NULL, 1);
     gcstate->collecting = 0;
     return n;
 }
@@ -2179,6 +3788,11 @@ void
 _PyGC_Fini(PyInterpreterState *interp)
 {
     GCState *gcstate = &interp->gc;
+    gc_abort_incremental(gcstate);
+    if (gcstate->mark_pool != NULL) {
+        gc_mark_pool_stop(gcstate->mark_pool);
+        gcstate->mark_pool = NULL;
+    }
     Py_CLEAR(gcstate->garbage);
     Py_CLEAR(gcstate->callbacks);
 
@@ -2422,6 +4036,7 @@ PyUnstable_GC_VisitObjects(gcvisitobjects_t callback, void *arg)
     GCState *gcstate = get_gc_state();
     int origenstate = gcstate->enabled;
     gcstate->enabled = 0;
+    gc_stop_marking(gcstate);
     for (i = 0; i < NUM_GENERATIONS; i++) {
         PyGC_Head *gc_list, *gc;
         gc_list = GEN_HEAD(gcstate, i);
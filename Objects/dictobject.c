@@ -113,6 +113,7 @@ As a consequence of this, split keys have a maximum size of 16.
 #define PyDict_MINSIZE 8
 
 #include "Python.h"
+#include "pycore_abstract.h"      // _PyZip_LengthHint()
 #include "pycore_bitutils.h"      // _Py_bit_length
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_code.h"          // stats
@@ -409,6 +410,154 @@ dictkeys_set_index(PyDictKeysObject *keys, Py_ssize_t i, Py_ssize_t ix)
  */
 #define USABLE_FRACTION(n) (((n) << 1)/3)
 
+/* Tagged tables.
+ *
+ * The unicode tables of at least 2**DK_TAGS_LOG_MINSIZE slots also keep a
+ * tag byte per slot, stored after the entries: the 7 top bits of the hash of
+ * the key whose index is in the slot, or DK_TAG_EMPTY or DK_TAG_DUMMY.  The
+ * slots of such a table are probed by aligned groups of DK_GROUP_SIZE rather
+ * than one at a time: the tags of a whole group are compared with the tag of
+ * the hash at once (with SSE2 or NEON when available), and only the indices
+ * and entries of the slots whose tag matches are loaded.  The lookup stops at
+ * the first group with an empty slot.  The groups are visited in triangular
+ * order, which visits all of them since their number is a power of 2.
+ *
+ * In a large table most of the time of a lookup goes into the cache misses
+ * of the probe chain; the tags of a group fit in a cache line and rule out
+ * almost all the slots holding other keys.
+ */
+#define DK_TAGS_LOG_MINSIZE 16
+#define DK_GROUP_SIZE 16
+#define DK_TAG_EMPTY ((uint8_t)0x80)
+#define DK_TAG_DUMMY ((uint8_t)0xfe)
+#define DK_TAG(hash) ((uint8_t)((size_t)(hash) >> (8 * SIZEOF_SIZE_T - 7)))
+
+#define DK_HAS_TAGS(dk) \
+    ((dk)->dk_kind == DICT_KEYS_UNICODE \
+     && DK_LOG_SIZE(dk) >= DK_TAGS_LOG_MINSIZE)
+
+static inline size_t
+dictkeys_tags_size(uint8_t log2_size, bool unicode)
+{
+    return (unicode && log2_size >= DK_TAGS_LOG_MINSIZE)
+           ? (size_t)1 << log2_size : 0;
+}
+
+static inline uint8_t *
+dictkeys_tags(PyDictKeysObject *keys)
+{
+    assert(DK_HAS_TAGS(keys));
+    return (uint8_t *)(DK_UNICODE_ENTRIES(keys)
+                       + USABLE_FRACTION((size_t)DK_SIZE(keys)));
+}
+
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>          // _mm_movemask_epi8()
+#  define DK_GROUP_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#  include <arm_neon.h>           // vceqq_u8()
+#  define DK_GROUP_NEON
+#endif
+
+#ifndef DK_GROUP_SSE2
+/* Gather the top bit of each byte of x: bit i of the result is the top bit
+   of byte i. */
+static inline unsigned int
+dk_bytes_mask(uint64_t x)
+{
+    x &= UINT64_C(0x8080808080808080);
+    return (unsigned int)((x * UINT64_C(0x0002040810204081)) >> 56);
+}
+
+#ifndef DK_GROUP_NEON
+/* Load 8 tags, the tag of the first slot in the low byte. */
+static inline uint64_t
+dk_load_tags(const uint8_t *tags)
+{
+    uint64_t x;
+    memcpy(&x, tags, sizeof(x));
+#if PY_BIG_ENDIAN
+    x = _Py_bswap64(x);
+#endif
+    return x;
+}
+
+/* Set the top bit of the bytes of x which are zero, exactly. */
+static inline uint64_t
+dk_zero_bytes(uint64_t x)
+{
+    const uint64_t low7 = UINT64_C(0x7f7f7f7f7f7f7f7f);
+    return ~(((x & low7) + low7) | x | low7);
+}
+#endif
+#endif
+
+/* Return the mask of the slots of the group whose tag is tag: bit i is set
+   when the tag of slot i is. */
+static inline unsigned int
+dk_group_match(const uint8_t *group, uint8_t tag)
+{
+#if defined(DK_GROUP_SSE2)
+    __m128i tags = _mm_loadu_si128((const __m128i *)group);
+    __m128i eq = _mm_cmpeq_epi8(tags, _mm_set1_epi8((char)tag));
+    return (unsigned int)_mm_movemask_epi8(eq);
+#elif defined(DK_GROUP_NEON)
+    uint64x2_t eq = vreinterpretq_u64_u8(
+        vceqq_u8(vld1q_u8(group), vdupq_n_u8(tag)));
+    return dk_bytes_mask(vgetq_lane_u64(eq, 0))
+           | (dk_bytes_mask(vgetq_lane_u64(eq, 1)) << 8);
+#else
+    uint64_t pattern = UINT64_C(0x0101010101010101) * tag;
+    return dk_bytes_mask(dk_zero_bytes(dk_load_tags(group) ^ pattern))
+           | (dk_bytes_mask(dk_zero_bytes(dk_load_tags(group + 8) ^ pattern))
+              << 8);
+#endif
+}
+
+/* Return the mask of the slots of the group which are empty or dummy. */
+static inline unsigned int
+dk_group_match_free(const uint8_t *group)
+{
+#if defined(DK_GROUP_SSE2)
+    return (unsigned int)_mm_movemask_epi8(
+        _mm_loadu_si128((const __m128i *)group));
+#elif defined(DK_GROUP_NEON)
+    uint64x2_t tags = vreinterpretq_u64_u8(vld1q_u8(group));
+    return dk_bytes_mask(vgetq_lane_u64(tags, 0))
+           | (dk_bytes_mask(vgetq_lane_u64(tags, 1)) << 8);
+#else
+    return dk_bytes_mask(dk_load_tags(group))
+           | (dk_bytes_mask(dk_load_tags(group + 8)) << 8);
+#endif
+}
+
+/* Index of the lowest slot set in a non-zero mask. */
+static inline int
+dk_group_first(unsigned int match)
+{
+    assert(match != 0);
+    return _Py_bit_length(match & (0u - match)) - 1;
+}
+
+/* Write the tag of slot i of a tagged table. */
+static inline void
+dictkeys_set_tag(PyDictKeysObject *keys, Py_ssize_t i, uint8_t tag)
+{
+    assert(keys->dk_version == 0);
+    dictkeys_tags(keys)[i] = tag;
+}
+
+/* Mark slot i, which holds the index of a deleted entry, as dummy. */
+static inline void
+dictkeys_set_dummy(PyDictKeysObject *keys, Py_ssize_t i)
+{
+    dictkeys_set_index(keys, i, DKIX_DUMMY);
+    if (DK_HAS_TAGS(keys)) {
+        dictkeys_set_tag(keys, i, DK_TAG_DUMMY);
+    }
+}
+
 /* Find the smallest dk_size >= minsize. */
 static inline uint8_t
 calculate_log2_keysize(Py_ssize_t minsize)
@@ -487,7 +636,7 @@ get_index_from_order(PyDictObject *mp, Py_ssize_t i)
 {
     assert(mp->ma_used <= SHARED_KEYS_MAX_SIZE);
     assert(i < (((char *)mp->ma_values)[-2]));
-    return ((char *)mp->ma_values)[-3-i];
+    return ((char *)mp->ma_values)[-4-i];
 }
 
 #ifdef DEBUG_PYDICT
@@ -540,6 +689,18 @@ _PyDict_CheckConsistency(PyObject *op, int check_content)
         for (Py_ssize_t i=0; i < DK_SIZE(keys); i++) {
             Py_ssize_t ix = dictkeys_get_index(keys, i);
             CHECK(DKIX_DUMMY <= ix && ix <= usable);
+            if (DK_HAS_TAGS(keys)) {
+                uint8_t tag = dictkeys_tags(keys)[i];
+                if (ix >= 0) {
+                    PyObject *key = DK_UNICODE_ENTRIES(keys)[ix].me_key;
+                    CHECK(key != NULL
+                          && tag == DK_TAG(unicode_get_hash(key)));
+                }
+                else {
+                    CHECK(tag == (ix == DKIX_EMPTY ? DK_TAG_EMPTY
+                                                   : DK_TAG_DUMMY));
+                }
+            }
         }
 
         if (keys->dk_kind == DICT_KEYS_GENERAL) {
@@ -640,7 +801,8 @@ new_keys_object(PyInterpreterState *interp, uint8_t log2_size, bool unicode)
     {
         dk = PyObject_Malloc(sizeof(PyDictKeysObject)
                              + ((size_t)1 << log2_bytes)
-                             + entry_size * usable);
+                             + entry_size * usable
+                             + dictkeys_tags_size(log2_size, unicode));
         if (dk == NULL) {
             PyErr_NoMemory();
             return NULL;
@@ -658,6 +820,9 @@ new_keys_object(PyInterpreterState *interp, uint8_t log2_size, bool unicode)
     dk->dk_version = 0;
     memset(&dk->dk_indices[0], 0xff, ((size_t)1 << log2_bytes));
     memset(&dk->dk_indices[(size_t)1 << log2_bytes], 0, entry_size * usable);
+    if (DK_HAS_TAGS(dk)) {
+        memset(dictkeys_tags(dk), DK_TAG_EMPTY, (size_t)1 << log2_size);
+    }
     return dk;
 }
 
@@ -702,7 +867,8 @@ static inline PyDictValues*
 new_values(size_t size)
 {
     assert(size >= 1);
-    size_t prefix_size = _Py_SIZE_ROUND_UP(size+2, sizeof(PyObject *));
+    assert(size <= SHARED_KEYS_MAX_SIZE);
+    size_t prefix_size = _Py_SIZE_ROUND_UP(size+3, sizeof(PyObject *));
     assert(prefix_size < 256);
     size_t n = prefix_size + size * sizeof(PyObject *);
     uint8_t *mem = PyMem_Malloc(n);
@@ -711,6 +877,7 @@ new_values(size_t size)
     }
     assert(prefix_size % sizeof(PyObject *) == 0);
     mem[prefix_size-1] = (uint8_t)prefix_size;
+    mem[prefix_size-3] = (uint8_t)size;
     return (PyDictValues*)(mem + prefix_size);
 }
 
@@ -721,6 +888,39 @@ free_values(PyDictValues *values)
     PyMem_Free(((char *)values)-prefix_size);
 }
 
+/* Return a copy of values with room for size values, and free values.
+   Return NULL, with values left alone, if the memory is exhausted. */
+static PyDictValues *
+grow_values(PyDictValues *values, size_t size)
+{
+    size_t capacity = _PyDictValues_Capacity(values);
+    assert(size > capacity);
+    PyDictValues *newvalues = new_values(size);
+    if (newvalues == NULL) {
+        return NULL;
+    }
+    /* The insertion order and the used size */
+    uint8_t used = ((uint8_t *)values)[-2];
+    ((uint8_t *)newvalues)[-2] = used;
+    memcpy(((uint8_t *)newvalues) - 3 - used, ((uint8_t *)values) - 3 - used,
+           used);
+    memcpy(newvalues->values, values->values, capacity * sizeof(PyObject *));
+    for (size_t i = capacity; i < size; i++) {
+        newvalues->values[i] = NULL;
+    }
+    free_values(values);
+    return newvalues;
+}
+
+/* Number of the values which may be set: the keys may have grown since
+   the values were allocated, the values past their capacity are unset. */
+static inline Py_ssize_t
+shared_values_size(PyDictKeysObject *keys, PyDictValues *values)
+{
+    return Py_MIN(keys->dk_nentries,
+                  (Py_ssize_t)_PyDictValues_Capacity(values));
+}
+
 /* Consumes a reference to the keys object */
 static PyObject *
 new_dict(PyInterpreterState *interp,
@@ -768,11 +968,31 @@ shared_keys_usable_size(PyDictKeysObject *keys)
     return (size_t)keys->dk_nentries + (size_t)keys->dk_usable;
 }
 
+/* Make room for the value at index ix of the split dict mp.
+   Return -1 with an exception set on error. */
+static int
+reserve_split_value(PyDictObject *mp, Py_ssize_t ix)
+{
+    size_t capacity = _PyDictValues_Capacity(mp->ma_values);
+    if ((size_t)ix < capacity) {
+        return 0;
+    }
+    size_t size = Py_MIN(Py_MAX((size_t)ix + 1, capacity * 2),
+                         shared_keys_usable_size(mp->ma_keys));
+    PyDictValues *values = grow_values(mp->ma_values, size);
+    if (values == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    mp->ma_values = values;
+    return 0;
+}
+
 /* Consumes a reference to the keys object */
 static PyObject *
 new_dict_with_shared_keys(PyInterpreterState *interp, PyDictKeysObject *keys)
 {
-    size_t size = shared_keys_usable_size(keys);
+    size_t size = Py_MAX((size_t)keys->dk_nentries, 1);
     PyDictValues *values = new_values(size);
     if (values == NULL) {
         dictkeys_decref(interp, keys);
@@ -851,10 +1071,37 @@ PyDict_New(void)
     return new_dict(interp, Py_EMPTY_KEYS, NULL, 0, 0);
 }
 
+static Py_ssize_t
+lookdict_index_tagged(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
+{
+    const uint8_t *tags = dictkeys_tags(k);
+    size_t mask = DK_MASK(k);
+    uint8_t tag = DK_TAG(hash);
+    size_t g = (size_t)hash & mask & ~(size_t)(DK_GROUP_SIZE - 1);
+
+    for (size_t step = DK_GROUP_SIZE;; step += DK_GROUP_SIZE) {
+        for (unsigned int match = dk_group_match(tags + g, tag);
+                match != 0; match &= match - 1) {
+            size_t i = g + dk_group_first(match);
+            if (dictkeys_get_index(k, i) == index) {
+                return i;
+            }
+        }
+        if (dk_group_match(tags + g, DK_TAG_EMPTY)) {
+            return DKIX_EMPTY;
+        }
+        g = (g + step) & mask;
+    }
+    Py_UNREACHABLE();
+}
+
 /* Search index of hash table from offset of entry table */
 static Py_ssize_t
 lookdict_index(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
 {
+    if (DK_HAS_TAGS(k)) {
+        return lookdict_index_tagged(k, hash, index);
+    }
     size_t mask = DK_MASK(k);
     size_t perturb = (size_t)hash;
     size_t i = (size_t)hash & mask;
@@ -873,10 +1120,60 @@ lookdict_index(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
     Py_UNREACHABLE();
 }
 
+// Search non-Unicode key from tagged Unicode table
+static Py_ssize_t
+unicodekeys_lookup_generic_tagged(PyDictObject *mp, PyDictKeysObject* dk, PyObject *key, Py_hash_t hash)
+{
+    PyDictUnicodeEntry *ep0 = DK_UNICODE_ENTRIES(dk);
+    const uint8_t *tags = dictkeys_tags(dk);
+    size_t mask = DK_MASK(dk);
+    uint8_t tag = DK_TAG(hash);
+    size_t g = (size_t)hash & mask & ~(size_t)(DK_GROUP_SIZE - 1);
+    for (size_t step = DK_GROUP_SIZE;; step += DK_GROUP_SIZE) {
+        for (unsigned int match = dk_group_match(tags + g, tag);
+                match != 0; match &= match - 1) {
+            Py_ssize_t ix = dictkeys_get_index(dk, g + dk_group_first(match));
+            assert(ix >= 0);
+            PyDictUnicodeEntry *ep = &ep0[ix];
+            assert(ep->me_key != NULL);
+            assert(PyUnicode_CheckExact(ep->me_key));
+            if (ep->me_key == key) {
+                return ix;
+            }
+            if (unicode_get_hash(ep->me_key) == hash) {
+                PyObject *startkey = ep->me_key;
+                Py_INCREF(startkey);
+                int cmp = PyObject_RichCompareBool(startkey, key, Py_EQ);
+                Py_DECREF(startkey);
+                if (cmp < 0) {
+                    return DKIX_ERROR;
+                }
+                if (dk == mp->ma_keys && ep->me_key == startkey) {
+                    if (cmp > 0) {
+                        return ix;
+                    }
+                }
+                else {
+                    /* The dict was mutated, restart */
+                    return DKIX_KEY_CHANGED;
+                }
+            }
+        }
+        if (dk_group_match(tags + g, DK_TAG_EMPTY)) {
+            return DKIX_EMPTY;
+        }
+        g = (g + step) & mask;
+    }
+    Py_UNREACHABLE();
+}
+
 // Search non-Unicode key from Unicode table
 static Py_ssize_t
 unicodekeys_lookup_generic(PyDictObject *mp, PyDictKeysObject* dk, PyObject *key, Py_hash_t hash)
 {
+    if (DK_HAS_TAGS(dk)) {
+        return unicodekeys_lookup_generic_tagged(mp, dk, key, hash);
+    }
     PyDictUnicodeEntry *ep0 = DK_UNICODE_ENTRIES(dk);
     size_t mask = DK_MASK(dk);
     size_t perturb = hash;
@@ -919,10 +1216,43 @@ unicodekeys_lookup_generic(PyDictObject *mp, PyDictKeysObject* dk, PyObject *key
     Py_UNREACHABLE();
 }
 
+// Search Unicode key from tagged Unicode table.
+static Py_ssize_t
+unicodekeys_lookup_unicode_tagged(PyDictKeysObject* dk, PyObject *key, Py_hash_t hash)
+{
+    PyDictUnicodeEntry *ep0 = DK_UNICODE_ENTRIES(dk);
+    const uint8_t *tags = dictkeys_tags(dk);
+    size_t mask = DK_MASK(dk);
+    uint8_t tag = DK_TAG(hash);
+    size_t g = (size_t)hash & mask & ~(size_t)(DK_GROUP_SIZE - 1);
+    for (size_t step = DK_GROUP_SIZE;; step += DK_GROUP_SIZE) {
+        for (unsigned int match = dk_group_match(tags + g, tag);
+                match != 0; match &= match - 1) {
+            Py_ssize_t ix = dictkeys_get_index(dk, g + dk_group_first(match));
+            assert(ix >= 0);
+            PyDictUnicodeEntry *ep = &ep0[ix];
+            assert(ep->me_key != NULL);
+            assert(PyUnicode_CheckExact(ep->me_key));
+            if (ep->me_key == key ||
+                    (unicode_get_hash(ep->me_key) == hash && unicode_eq(ep->me_key, key))) {
+                return ix;
+            }
+        }
+        if (dk_group_match(tags + g, DK_TAG_EMPTY)) {
+            return DKIX_EMPTY;
+        }
+        g = (g + step) & mask;
+    }
+    Py_UNREACHABLE();
+}
+
 // Search Unicode key from Unicode table.
 static Py_ssize_t _Py_HOT_FUNCTION
 unicodekeys_lookup_unicode(PyDictKeysObject* dk, PyObject *key, Py_hash_t hash)
 {
+    if (DK_HAS_TAGS(dk)) {
+        return unicodekeys_lookup_unicode_tagged(dk, key, hash);
+    }
     PyDictUnicodeEntry *ep0 = DK_UNICODE_ENTRIES(dk);
     size_t mask = DK_MASK(dk);
     size_t perturb = hash;
@@ -1072,7 +1402,8 @@ _Py_dict_lookup(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject **valu
 
         if (ix >= 0) {
             if (kind == DICT_KEYS_SPLIT) {
-                *value_addr = mp->ma_values->values[ix];
+                *value_addr = (size_t)ix < _PyDictValues_Capacity(mp->ma_values)
+                              ? mp->ma_values->values[ix] : NULL;
             }
             else {
                 *value_addr = _PyDictEntry_Value(DK_UNICODE_ENTRIES(dk) + ix);
@@ -1136,6 +1467,7 @@ _PyDict_MaybeUntrack(PyObject *op)
     mp = (PyDictObject *) op;
     numentries = mp->ma_keys->dk_nentries;
     if (_PyDict_HasSplitTable(mp)) {
+        numentries = shared_values_size(mp->ma_keys, mp->ma_values);
         for (i = 0; i < numentries; i++) {
             if ((value = mp->ma_values->values[i]) == NULL)
                 continue;
@@ -1168,8 +1500,29 @@ _PyDict_MaybeUntrack(PyObject *op)
     _PyObject_GC_UNTRACK(op);
 }
 
+/* Find the first free slot of the probe sequence of hash in a tagged table,
+   and set its tag. */
+static Py_ssize_t
+find_empty_slot_tagged(PyDictKeysObject *keys, Py_hash_t hash)
+{
+    const uint8_t *tags = dictkeys_tags(keys);
+    const size_t mask = DK_MASK(keys);
+    size_t g = (size_t)hash & mask & ~(size_t)(DK_GROUP_SIZE - 1);
+    unsigned int free;
+    for (size_t step = DK_GROUP_SIZE;
+            (free = dk_group_match_free(tags + g)) == 0;
+            step += DK_GROUP_SIZE) {
+        g = (g + step) & mask;
+    }
+    size_t i = g + dk_group_first(free);
+    dictkeys_set_tag(keys, i, DK_TAG(hash));
+    return i;
+}
+
 /* Internal function to find slot for an item from its hash
    when it is known that the key is not present in the dict.
+   In a tagged table, the tag of the slot is set too: the caller
+   is expected to store the index of the new entry in it.
 
    The dict must be combined. */
 static Py_ssize_t
@@ -1177,6 +1530,10 @@ find_empty_slot(PyDictKeysObject *keys, Py_hash_t hash)
 {
     assert(keys != NULL);
 
+    if (DK_HAS_TAGS(keys)) {
+        return find_empty_slot_tagged(keys, hash);
+    }
+
     const size_t mask = DK_MASK(keys);
     size_t i = hash & mask;
     Py_ssize_t ix = dictkeys_get_index(keys, i);
@@ -1266,6 +1623,10 @@ insertdict(PyInterpreterState *interp, PyDictObject *mp,
             if (insertion_resize(interp, mp, 1) < 0)
                 goto Fail;
         }
+        if (mp->ma_values &&
+            reserve_split_value(mp, mp->ma_keys->dk_nentries) < 0) {
+            goto Fail;
+        }
 
         Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
         dictkeys_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
@@ -1317,6 +1678,9 @@ insertdict(PyInterpreterState *interp, PyDictObject *mp,
             }
         }
 
+        if (_PyDict_HasSplitTable(mp) && reserve_split_value(mp, ix) < 0) {
+            goto Fail;
+        }
         uint64_t new_version = _PyDict_NotifyEvent(
                 interp, PyDict_EVENT_MODIFIED, mp, key, value);
         if (_PyDict_HasSplitTable(mp)) {
@@ -1421,6 +1785,14 @@ build_indices_generic(PyDictKeysObject *keys, PyDictKeyEntry *ep, Py_ssize_t n)
 static void
 build_indices_unicode(PyDictKeysObject *keys, PyDictUnicodeEntry *ep, Py_ssize_t n)
 {
+    if (DK_HAS_TAGS(keys)) {
+        for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
+            Py_hash_t hash = unicode_get_hash(ep->me_key);
+            assert(hash != -1);
+            dictkeys_set_index(keys, find_empty_slot_tagged(keys, hash), ix);
+        }
+        return;
+    }
     size_t mask = DK_MASK(keys);
     for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
         Py_hash_t hash = unicode_get_hash(ep->me_key);
@@ -1644,6 +2016,90 @@ dict_new_presized(PyInterpreterState *interp, Py_ssize_t minused, bool unicode)
     return new_dict(interp, new_keys, NULL, 0, 0);
 }
 
+/* Grow the table of mp ahead of the insertion of n more items, the first of
+   which has the key key, so that they do not resize it one after the other.
+   The kind of the new table is chosen after that key.  Split tables, whose
+   keys are shared, and immutable dicts are left alone.
+   n usually comes from a length hint, which may be wrong: if the table
+   can't be allocated, the dict is left as it is and grows as usual. */
+static void
+dict_presize(PyInterpreterState *interp, PyDictObject *mp, Py_ssize_t n,
+             PyObject *key)
+{
+    if (n <= mp->ma_keys->dk_usable || mp->ma_values != NULL
+            || !Py_CHECKWRITE(mp)) {
+        return;
+    }
+    /* A table takes less than 3 indices and 3 entries per item: ignore the
+       hints for which its size would overflow. */
+    if (n > PY_SSIZE_T_MAX / (3 * (Py_ssize_t)sizeof(PyDictKeyEntry) + 8)
+            - mp->ma_used) {
+        return;
+    }
+    int unicode = DK_IS_UNICODE(mp->ma_keys) && PyUnicode_CheckExact(key);
+    if (dictresize(interp, mp, estimate_log2_keysize(mp->ma_used + n),
+                   unicode) < 0) {
+        PyErr_Clear();
+    }
+}
+
+/* Length hint of an iterable of items to insert in a dict: zip objects,
+   which have none of their own, are asked for the hints of their iterators. */
+static Py_ssize_t
+dict_length_hint(PyObject *iterable)
+{
+    if (Py_IS_TYPE(iterable, &PyZip_Type)) {
+        return _PyZip_LengthHint(iterable);
+    }
+    return PyObject_LengthHint(iterable, 0);
+}
+
+/* Bound the length hint of an iterable of items to insert in a dict as
+   dict_new_presized() does: the hint counts the items, not the distinct keys,
+   and a dict never shrinks.  The views of a dict have distinct keys. */
+static Py_ssize_t
+dict_bound_hint(PyObject *iterable, Py_ssize_t hint)
+{
+    const Py_ssize_t max_presize = USABLE_FRACTION((Py_ssize_t)1 << 17);
+
+    if (PyDictKeys_Check(iterable) || PyDictItems_Check(iterable)) {
+        return hint;
+    }
+    return Py_MIN(hint, max_presize);
+}
+
+/* Presize the dict of a comprehension, when its first item key is about to be
+   added, from the length hint of iter, the iterator of its outermost loop.
+   Only the iterators of the builtin containers are asked, which run no code
+   of the user in the middle of the comprehension, and the hint is bounded as
+   in dict_new_presized() since the comprehension may filter the items.
+   This is only an optimization: errors are ignored. */
+void
+_PyDict_PresizeFromIterator(PyDictObject *mp, PyObject *iter, PyObject *key)
+{
+    const Py_ssize_t max_presize = USABLE_FRACTION((Py_ssize_t)1 << 17);
+    PyTypeObject *tp = Py_TYPE(iter);
+
+    assert(mp->ma_used == 0);
+    if (tp != &PyListIter_Type && tp != &PyTupleIter_Type
+            && tp != &PyRangeIter_Type && tp != &PyLongRangeIter_Type
+            && tp != &PyDictIterKey_Type && tp != &PyDictIterValue_Type
+            && tp != &PyDictIterItem_Type && tp != &PySetIter_Type) {
+        return;
+    }
+    Py_ssize_t n = PyObject_LengthHint(iter, 0);
+    if (n < 0) {
+        PyErr_Clear();
+        return;
+    }
+    /* The first item is not counted by the hint of the iterator any more. */
+    n = Py_MIN(n + 1, max_presize);
+    if (n > USABLE_FRACTION(PyDict_MINSIZE)) {
+        PyInterpreterState *interp = _PyInterpreterState_GET();
+        dict_presize(interp, mp, n, key);
+    }
+}
+
 PyObject *
 _PyDict_NewPresized(Py_ssize_t minused)
 {
@@ -1984,14 +2440,15 @@ static void
 delete_index_from_values(PyDictValues *values, Py_ssize_t ix)
 {
     uint8_t *size_ptr = ((uint8_t *)values)-2;
+    uint8_t *order = size_ptr-1;
     int size = *size_ptr;
     int i;
-    for (i = 1; size_ptr[-i] != ix; i++) {
+    for (i = 1; order[-i] != ix; i++) {
         assert(i <= size);
     }
     assert(i <= size);
     for (; i < size; i++) {
-        size_ptr[-i] = size_ptr[-i-1];
+        order[-i] = order[-i-1];
     }
     *size_ptr = size -1;
 }
@@ -2017,7 +2474,7 @@ delitem_common(PyDictObject *mp, Py_hash_t hash, Py_ssize_t ix,
     }
     else {
         mp->ma_keys->dk_version = 0;
-        dictkeys_set_index(mp->ma_keys, hashpos, DKIX_DUMMY);
+        dictkeys_set_dummy(mp->ma_keys, hashpos);
         if (DK_IS_UNICODE(mp->ma_keys)) {
             PyDictUnicodeEntry *ep = &DK_UNICODE_ENTRIES(mp->ma_keys)[ix];
             if(_PyDictEntry_IsImmutable(ep)){
@@ -2177,7 +2634,7 @@ PyDict_Clear(PyObject *op)
     mp->ma_version_tag = new_version;
     /* ...then clear the keys and values */
     if (oldvalues != NULL) {
-        n = oldkeys->dk_nentries;
+        n = shared_values_size(oldkeys, oldvalues);
         for (i = 0; i < n; i++)
             Py_CLEAR(oldvalues->values[i]);
         free_values(oldvalues);
@@ -2408,7 +2865,16 @@ _PyDict_FromKeys(PyObject *cls, PyObject *iterable, PyObject *value)
     }
 
     if (PyDict_CheckExact(d)) {
+        Py_ssize_t hint = PyObject_LengthHint(iterable, 0);
+        if (hint < 0) {
+            goto Fail;
+        }
+        hint = dict_bound_hint(iterable, hint);
         while ((key = PyIter_Next(it)) != NULL) {
+            if (hint > 0) {
+                dict_presize(interp, (PyDictObject *)d, hint, key);
+                hint = 0;
+            }
             status = PyDict_SetItem(d, key, value);
             Py_DECREF(key);
             if (status < 0)
@@ -2456,7 +2922,7 @@ dict_dealloc(PyDictObject *mp)
     PyObject_GC_UnTrack(mp);
     Py_TRASHCAN_BEGIN(mp, dict_dealloc)
     if (values != NULL) {
-        for (i = 0, n = mp->ma_keys->dk_nentries; i < n; i++) {
+        for (i = 0, n = shared_values_size(keys, values); i < n; i++) {
             Py_XDECREF(values->values[i]);
         }
         free_values(values);
@@ -2822,11 +3288,17 @@ PyDict_MergeFromSeq2(PyObject *d, PyObject *seq2, int override)
     Py_ssize_t i;       /* index into seq2 of current element */
     PyObject *item;     /* seq2[i] */
     PyObject *fast;     /* item as a 2-tuple or 2-list */
+    Py_ssize_t hint;    /* number of items expected in seq2 */
 
     assert(d != NULL);
     assert(PyDict_Check(d));
     assert(seq2 != NULL);
 
+    hint = dict_length_hint(seq2);
+    if (hint < 0)
+        return -1;
+    hint = dict_bound_hint(seq2, hint);
+
     it = PyObject_GetIter(seq2);
     if (it == NULL)
         return -1;
@@ -2865,6 +3337,10 @@ PyDict_MergeFromSeq2(PyObject *d, PyObject *seq2, int override)
         /* Update/merge with this (key, value) pair. */
         key = PySequence_Fast_GET_ITEM(fast, 0);
         value = PySequence_Fast_GET_ITEM(fast, 1);
+        if (i == 0 && hint > 0) {
+            PyInterpreterState *interp = _PyInterpreterState_GET();
+            dict_presize(interp, (PyDictObject *)d, hint, key);
+        }
         Py_INCREF(key);
         Py_INCREF(value);
         if (override) {
@@ -3122,7 +3598,7 @@ PyDict_Copy(PyObject *o)
 
     if (_PyDict_HasSplitTable(mp)) {
         PyDictObject *split_copy;
-        size_t size = shared_keys_usable_size(mp->ma_keys);
+        size_t size = _PyDictValues_Capacity(mp->ma_values);
         PyDictValues *newvalues = new_values(size);
         if (newvalues == NULL)
             return PyErr_NoMemory();
@@ -3259,7 +3735,8 @@ dict_equal(PyDictObject *a, PyDictObject *b)
             }
             hash = unicode_get_hash(key);
             if (a->ma_values)
-                aval = a->ma_values->values[i];
+                aval = i < shared_values_size(a->ma_keys, a->ma_values)
+                       ? a->ma_values->values[i] : NULL;
             else
                 aval = _PyDictEntry_Value(ep);
         }
@@ -3434,6 +3911,10 @@ PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *defaultobj)
                 return NULL;
             }
         }
+        if (mp->ma_values &&
+            reserve_split_value(mp, mp->ma_keys->dk_nentries) < 0) {
+            return NULL;
+        }
         Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
         dictkeys_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
         if (DK_IS_UNICODE(mp->ma_keys)) {
@@ -3465,10 +3946,13 @@ PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *defaultobj)
         assert(mp->ma_keys->dk_usable >= 0);
     }
     else if (value == NULL) {
+        assert(_PyDict_HasSplitTable(mp));
+        if (reserve_split_value(mp, ix) < 0) {
+            return NULL;
+        }
         uint64_t new_version = _PyDict_NotifyEvent(
                 interp, PyDict_EVENT_ADDED, mp, key, defaultobj);
         value = defaultobj;
-        assert(_PyDict_HasSplitTable(mp));
         assert(mp->ma_values->values[ix] == NULL);
         MAINTAIN_TRACKING(mp, key, value);
         mp->ma_values->values[ix] = Py_NewRef(value);
@@ -3635,7 +4119,7 @@ dict_popitem_impl(PyDictObject *self)
     j = lookdict_index(self->ma_keys, hash, i);
     assert(j >= 0);
     assert(dictkeys_get_index(self->ma_keys, j) == i);
-    dictkeys_set_index(self->ma_keys, j, DKIX_DUMMY);
+    dictkeys_set_dummy(self->ma_keys, j);
 
     PyTuple_SET_ITEM(res, 0, key);
     PyTuple_SET_ITEM(res, 1, value);
@@ -3656,6 +4140,7 @@ dict_traverse(PyObject *op, visitproc visit, void *arg)
 
     if (DK_IS_UNICODE(keys)) {
         if (mp->ma_values != NULL) {
+            n = shared_values_size(keys, mp->ma_values);
             for (i = 0; i < n; i++) {
                 Py_VISIT(mp->ma_values->values[i]);
             }
@@ -3693,7 +4178,7 @@ _PyDict_SizeOf(PyDictObject *mp)
 {
     size_t res = _PyObject_SIZE(Py_TYPE(mp));
     if (mp->ma_values) {
-        res += shared_keys_usable_size(mp->ma_keys) * sizeof(PyObject*);
+        res += _PyDictValues_Capacity(mp->ma_values) * sizeof(PyObject*);
     }
     /* If the dictionary is split, the keys portion is accounted-for
        in the type object. */
@@ -3712,6 +4197,8 @@ _PyDict_KeysSize(PyDictKeysObject *keys)
     size_t size = sizeof(PyDictKeysObject);
     size += (size_t)1 << keys->dk_log2_index_bytes;
     size += USABLE_FRACTION((size_t)DK_SIZE(keys)) * es;
+    size += dictkeys_tags_size(keys->dk_log2_size,
+                               keys->dk_kind == DICT_KEYS_UNICODE);
     return size;
 }
 
@@ -5446,7 +5933,6 @@ _PyDict_NewKeysForClass(void)
     }
     else {
         assert(keys->dk_nentries == 0);
-        /* Set to max size+1 as it will shrink by one before each new object */
         keys->dk_usable = SHARED_KEYS_MAX_SIZE;
         keys->dk_kind = DICT_KEYS_SPLIT;
     }
@@ -5463,16 +5949,15 @@ init_inline_values(PyObject *obj, PyTypeObject *tp)
     assert(tp->tp_flags & Py_TPFLAGS_MANAGED_DICT);
     PyDictKeysObject *keys = CACHED_KEYS(tp);
     assert(keys != NULL);
-    if (keys->dk_usable > 1) {
-        keys->dk_usable--;
-    }
-    size_t size = shared_keys_usable_size(keys);
+    /* Only make room for the attributes that the instances of the type have
+       set so far: the values are grown if this one sets others. */
+    size_t size = Py_MAX((size_t)keys->dk_nentries, 1);
     PyDictValues *values = new_values(size);
     if (values == NULL) {
         PyErr_NoMemory();
         return -1;
     }
-    assert(((uint8_t *)values)[-1] >= (size + 2));
+    assert(((uint8_t *)values)[-1] >= (size + 3));
     ((uint8_t *)values)[-2] = 0;
     for (size_t i = 0; i < size; i++) {
         values->values[i] = NULL;
@@ -5509,6 +5994,22 @@ _PyObject_InitializeDict(PyObject *obj)
     return 0;
 }
 
+/* Grow the values of obj to have room for size values.
+   Return NULL with an exception set on error. */
+static PyDictValues *
+grow_instance_values(PyObject *obj, PyDictValues *values, size_t size)
+{
+    PyDictOrValues *dorv_ptr = _PyObject_DictOrValuesPointer(obj);
+    assert(_PyDictOrValues_GetValues(*dorv_ptr) == values);
+    values = grow_values(values, size);
+    if (values == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    _PyDictOrValues_SetValues(dorv_ptr, values);
+    return values;
+}
+
 static PyObject *
 make_dict_from_instance_attributes(PyInterpreterState *interp,
                                    PyDictKeysObject *keys, PyDictValues *values)
@@ -5516,8 +6017,8 @@ make_dict_from_instance_attributes(PyInterpreterState *interp,
     dictkeys_incref(keys);
     Py_ssize_t used = 0;
     Py_ssize_t track = 0;
-    size_t size = shared_keys_usable_size(keys);
-    for (size_t i = 0; i < size; i++) {
+    Py_ssize_t size = shared_values_size(keys, values);
+    for (Py_ssize_t i = 0; i < size; i++) {
         PyObject *val = values->values[i];
         if (val != NULL) {
             used += 1;
@@ -5562,7 +6063,7 @@ _PyObject_StoreInstanceAttribute(PyObject *obj, PyDictValues *values,
     if (ix == DKIX_EMPTY) {
 #ifdef Py_STATS
         if (PyUnicode_CheckExact(name)) {
-            if (shared_keys_usable_size(keys) == SHARED_KEYS_MAX_SIZE) {
+            if (keys->dk_usable <= 0) {
                 OBJECT_STAT_INC(dict_materialized_too_big);
             }
             else {
@@ -5586,6 +6087,23 @@ _PyObject_StoreInstanceAttribute(PyObject *obj, PyDictValues *values,
             return PyDict_SetItem(dict, name, value);
         }
     }
+    size_t capacity = _PyDictValues_Capacity(values);
+    if ((size_t)ix >= capacity) {
+        if (value == NULL) {
+            PyErr_Format(PyExc_AttributeError,
+                         "'%.100s' object has no attribute '%U'",
+                         Py_TYPE(obj)->tp_name, name);
+            return -1;
+        }
+        /* An attribute that the instances of the type did not have when
+           obj was created: make room for it, and for the next ones. */
+        size_t size = Py_MIN(Py_MAX((size_t)ix + 1, capacity * 2),
+                             shared_keys_usable_size(keys));
+        values = grow_instance_values(obj, values, size);
+        if (values == NULL) {
+            return -1;
+        }
+    }
     PyObject *old_value = values->values[ix];
     values->values[ix] = Py_XNewRef(value);
     if (old_value == NULL) {
@@ -5620,8 +6138,8 @@ _PyObject_ManagedDictValidityCheck(PyObject *obj)
         PyDictValues *values = _PyDictOrValues_GetValues(*dorv_ptr);
         int size = ((uint8_t *)values)[-2];
         int count = 0;
-        PyDictKeysObject *keys = CACHED_KEYS(tp);
-        for (Py_ssize_t i = 0; i < keys->dk_nentries; i++) {
+        Py_ssize_t n = shared_values_size(CACHED_KEYS(tp), values);
+        for (Py_ssize_t i = 0; i < n; i++) {
             if (values->values[i] != NULL) {
                 count++;
             }
@@ -5645,7 +6163,7 @@ _PyObject_GetInstanceAttribute(PyObject *obj, PyDictValues *values,
     PyDictKeysObject *keys = CACHED_KEYS(Py_TYPE(obj));
     assert(keys != NULL);
     Py_ssize_t ix = _PyDictKeys_StringLookup(keys, name);
-    if (ix == DKIX_EMPTY) {
+    if (ix == DKIX_EMPTY || (size_t)ix >= _PyDictValues_Capacity(values)) {
         return NULL;
     }
     PyObject *value = values->values[ix];
@@ -5663,13 +6181,7 @@ _PyObject_IsInstanceDictEmpty(PyObject *obj)
     if (tp->tp_flags & Py_TPFLAGS_MANAGED_DICT) {
         PyDictOrValues dorv = *_PyObject_DictOrValuesPointer(obj);
         if (_PyDictOrValues_IsValues(dorv)) {
-            PyDictKeysObject *keys = CACHED_KEYS(tp);
-            for (Py_ssize_t i = 0; i < keys->dk_nentries; i++) {
-                if (_PyDictOrValues_GetValues(dorv)->values[i] != NULL) {
-                    return 0;
-                }
-            }
-            return 1;
+            return ((uint8_t *)_PyDictOrValues_GetValues(dorv))[-2] == 0;
         }
         dict = _PyDictOrValues_GetDict(dorv);
     }
@@ -5693,8 +6205,8 @@ _PyObject_FreeInstanceAttributes(PyObject *self)
         return;
     }
     PyDictValues *values = _PyDictOrValues_GetValues(dorv);
-    PyDictKeysObject *keys = CACHED_KEYS(tp);
-    for (Py_ssize_t i = 0; i < keys->dk_nentries; i++) {
+    Py_ssize_t size = shared_values_size(CACHED_KEYS(tp), values);
+    for (Py_ssize_t i = 0; i < size; i++) {
         Py_XDECREF(values->values[i]);
     }
     free_values(values);
@@ -5711,8 +6223,8 @@ _PyObject_VisitManagedDict(PyObject *obj, visitproc visit, void *arg)
     PyDictOrValues dorv = *_PyObject_DictOrValuesPointer(obj);
     if (_PyDictOrValues_IsValues(dorv)) {
         PyDictValues *values = _PyDictOrValues_GetValues(dorv);
-        PyDictKeysObject *keys = CACHED_KEYS(tp);
-        for (Py_ssize_t i = 0; i < keys->dk_nentries; i++) {
+        Py_ssize_t size = shared_values_size(CACHED_KEYS(tp), values);
+        for (Py_ssize_t i = 0; i < size; i++) {
             Py_VISIT(values->values[i]);
         }
     }
@@ -5733,8 +6245,8 @@ _PyObject_ClearManagedDict(PyObject *obj)
     PyDictOrValues *dorv_ptr = _PyObject_DictOrValuesPointer(obj);
     if (_PyDictOrValues_IsValues(*dorv_ptr)) {
         PyDictValues *values = _PyDictOrValues_GetValues(*dorv_ptr);
-        PyDictKeysObject *keys = CACHED_KEYS(tp);
-        for (Py_ssize_t i = 0; i < keys->dk_nentries; i++) {
+        Py_ssize_t size = shared_values_size(CACHED_KEYS(tp), values);
+        for (Py_ssize_t i = 0; i < size; i++) {
             Py_CLEAR(values->values[i]);
         }
         dorv_ptr->dict = NULL;
@@ -6,7 +6,7 @@
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"         // _PyEval_EvalFrame()
 #include "pycore_frame.h"         // _PyInterpreterFrame
-#include "pycore_genobject.h"     // struct _Py_async_gen_state
+#include "pycore_genobject.h"     // struct _Py_gen_state
 #include "pycore_object.h"        // _PyObject_GC_UNTRACK()
 #include "pycore_pyerrors.h"      // _PyErr_ClearExcState()
 #include "pycore_pystate.h"       // _PyThreadState_GET()
@@ -122,6 +122,135 @@ _PyGen_Finalize(PyObject *self)
     PyErr_SetRaisedException(exc);
 }
 
+#if _PyGen_MAXFREELIST > 0
+static struct _Py_gen_state *
+get_gen_state(void)
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    return &interp->gen;
+}
+
+/* Return the freelist size class for a frame of 'slots' slots, or -1 if
+   the frame is too large to be kept on a freelist. */
+static inline int
+gen_freelist_sizeclass(int slots)
+{
+    int sizeclass = (slots + _PyGen_FREELIST_QUANTUM - 1) /
+                    _PyGen_FREELIST_QUANTUM;
+    return sizeclass < _PyGen_FREELIST_NCLASSES ? sizeclass : -1;
+}
+#endif
+
+/* Allocate an untracked generator-like object of the given type with room
+   for the frame of 'code'.  The frame itself is left uninitialized. */
+static PyGenObject *
+gen_alloc(PyTypeObject *type, PyCodeObject *code)
+{
+    assert(type == &PyGen_Type || type == &PyCoro_Type ||
+           type == &PyAsyncGen_Type);
+    int slots = _PyFrame_NumSlotsForCodeObject(code);
+#if _PyGen_MAXFREELIST > 0
+    int sizeclass = gen_freelist_sizeclass(slots);
+    if (sizeclass >= 0) {
+        struct _Py_gen_state *state = get_gen_state();
+#ifdef Py_DEBUG
+        // gen_alloc() must not be called after _PyGen_Fini()
+        assert(state->numfree[sizeclass] != -1);
+#endif
+        PyGenObject *gen = state->free_list[sizeclass];
+        if (gen != NULL) {
+            state->free_list[sizeclass] = (PyGenObject *)Py_TYPE(gen);
+            state->numfree[sizeclass]--;
+            Py_SET_TYPE(gen, type);
+            /* Forget that the previous occupant has been finalized, so
+               that tp_finalize runs for the new object. */
+            _Py_AS_GC((PyObject *)gen)->_gc_prev = 0;
+            _Py_NewReference((PyObject *)gen);
+            OBJECT_STAT_INC(from_freelist);
+            return gen;
+        }
+        /* Allocate the whole size class so that the object can be
+           reused for any frame of the same class. */
+        slots = sizeclass * _PyGen_FREELIST_QUANTUM;
+    }
+#endif
+    return PyObject_GC_NewVar(PyGenObject, type, slots);
+}
+
+/* Free an untracked generator-like object whose frame had 'slots' slots. */
+static void
+gen_free(PyGenObject *gen, int slots)
+{
+#if _PyGen_MAXFREELIST > 0
+    int sizeclass = gen_freelist_sizeclass(slots);
+    if (sizeclass >= 0) {
+        struct _Py_gen_state *state = get_gen_state();
+#ifdef Py_DEBUG
+        // gen_dealloc() must not be called after _PyGen_Fini()
+        assert(state->numfree[sizeclass] != -1);
+#endif
+        if (state->numfree[sizeclass] < _PyGen_MAXFREELIST) {
+            state->numfree[sizeclass]++;
+            Py_SET_TYPE(gen, (PyTypeObject *)state->free_list[sizeclass]);
+            state->free_list[sizeclass] = gen;
+            OBJECT_STAT_INC(to_freelist);
+            return;
+        }
+    }
+#endif
+    PyObject_GC_Del(gen);
+}
+
+void
+_PyGen_ClearFreeList(PyInterpreterState *interp)
+{
+#if _PyGen_MAXFREELIST > 0
+    struct _Py_gen_state *state = &interp->gen;
+    for (int i = 0; i < _PyGen_FREELIST_NCLASSES; i++) {
+        PyGenObject *gen = state->free_list[i];
+        while (gen != NULL) {
+            PyGenObject *next = (PyGenObject *)Py_TYPE(gen);
+            /* PyObject_GC_Del() needs a valid type to find the
+               start of the allocation. */
+            Py_SET_TYPE(gen, &PyGen_Type);
+            PyObject_GC_Del(gen);
+            gen = next;
+        }
+        state->free_list[i] = NULL;
+        state->numfree[i] = 0;
+    }
+#endif
+}
+
+void
+_PyGen_Fini(PyInterpreterState *interp)
+{
+    _PyGen_ClearFreeList(interp);
+#if defined(Py_DEBUG) && _PyGen_MAXFREELIST > 0
+    struct _Py_gen_state *state = &interp->gen;
+    for (int i = 0; i < _PyGen_FREELIST_NCLASSES; i++) {
+        state->numfree[i] = -1;
+    }
+#endif
+}
+
+/* Print summary info about the state of the optimized allocator */
+void
+_PyGen_DebugMallocStats(FILE *out)
+{
+#if _PyGen_MAXFREELIST > 0
+    struct _Py_gen_state *state = get_gen_state();
+    for (int i = 0; i < _PyGen_FREELIST_NCLASSES; i++) {
+        char buf[128];
+        PyOS_snprintf(buf, sizeof(buf),
+                      "free %d-slot PyGenObject", i * _PyGen_FREELIST_QUANTUM);
+        _PyDebugAllocatorStats(out, buf, state->numfree[i],
+                               PyGen_Type.tp_basicsize +
+                               i * _PyGen_FREELIST_QUANTUM * sizeof(PyObject *));
+    }
+#endif
+}
+
 static void
 gen_dealloc(PyGenObject *gen)
 {
@@ -150,14 +279,16 @@ gen_dealloc(PyGenObject *gen)
         frame->previous = NULL;
         _PyFrame_ClearExceptCode(frame);
     }
-    if (_PyGen_GetCode(gen)->co_flags & CO_COROUTINE) {
+    PyCodeObject *code = _PyGen_GetCode(gen);
+    int slots = _PyFrame_NumSlotsForCodeObject(code);
+    if (code->co_flags & CO_COROUTINE) {
         Py_CLEAR(((PyCoroObject *)gen)->cr_origin_or_finalizer);
     }
-    Py_DECREF(_PyGen_GetCode(gen));
+    Py_DECREF(code);
     Py_CLEAR(gen->gi_name);
     Py_CLEAR(gen->gi_qualname);
     _PyErr_ClearExcState(&gen->gi_exc_state);
-    PyObject_GC_Del(gen);
+    gen_free(gen, slots);
 }
 
 static PySendResult
@@ -882,8 +1013,7 @@ static PyObject *
 make_gen(PyTypeObject *type, PyFunctionObject *func)
 {
     PyCodeObject *code = (PyCodeObject *)func->func_code;
-    int slots = _PyFrame_NumSlotsForCodeObject(code);
-    PyGenObject *gen = PyObject_GC_NewVar(PyGenObject, type, slots);
+    PyGenObject *gen = gen_alloc(type, code);
     if (gen == NULL) {
         return NULL;
     }
@@ -953,8 +1083,7 @@ gen_new_with_qualname(PyTypeObject *type, PyFrameObject *f,
                       PyObject *name, PyObject *qualname)
 {
     PyCodeObject *code = f->f_frame->f_code;
-    int size = code->co_nlocalsplus + code->co_stacksize;
-    PyGenObject *gen = PyObject_GC_NewVar(PyGenObject, type, size);
+    PyGenObject *gen = gen_alloc(type, code);
     if (gen == NULL) {
         Py_DECREF(f);
         return NULL;
@@ -1264,6 +1264,11 @@ struct s_MergeState {
      * of tuples. It may be set to safe_object_compare, but the idea is that hopefully
      * we can assume more, and use one of the special-case compares. */
     int (*tuple_elem_compare)(PyObject *, PyObject *, MergeState *);
+
+    /* True in the worker threads of a parallel sort, which run without the
+     * GIL: they take their temp memory from malloc() and leave reporting
+     * errors to the thread that started them. */
+    int nogil;
 };
 
 /* binarysort is the best method for sorting small arrays: it does
@@ -1600,6 +1605,7 @@ merge_init(MergeState *ms, Py_ssize_t list_size, int has_keyfunc,
     ms->min_gallop = MIN_GALLOP;
     ms->listlen = list_size;
     ms->basekeys = lo->keys;
+    ms->nogil = 0;
 }
 
 /* Free all the temp memory owned by the MergeState.  This must be called
@@ -1611,7 +1617,10 @@ merge_freemem(MergeState *ms)
 {
     assert(ms != NULL);
     if (ms->a.keys != ms->temparray) {
-        PyMem_Free(ms->a.keys);
+        if (ms->nogil)
+            free(ms->a.keys);
+        else
+            PyMem_Free(ms->a.keys);
         ms->a.keys = NULL;
     }
 }
@@ -1635,18 +1644,23 @@ merge_getmem(MergeState *ms, Py_ssize_t need)
      */
     merge_freemem(ms);
     if ((size_t)need > PY_SSIZE_T_MAX / sizeof(PyObject *) / multiplier) {
-        PyErr_NoMemory();
-        return -1;
+        goto nomemory;
     }
-    ms->a.keys = (PyObject **)PyMem_Malloc(multiplier * need
-                                          * sizeof(PyObject *));
+    if (ms->nogil)
+        ms->a.keys = (PyObject **)malloc(multiplier * need
+                                         * sizeof(PyObject *));
+    else
+        ms->a.keys = (PyObject **)PyMem_Malloc(multiplier * need
+                                              * sizeof(PyObject *));
     if (ms->a.keys != NULL) {
         ms->alloced = need;
         if (ms->a.values != NULL)
             ms->a.values = &ms->a.keys[need];
         return 0;
     }
-    PyErr_NoMemory();
+  nomemory:
+    if (!ms->nogil)
+        PyErr_NoMemory();
     return -1;
 }
 #define MERGE_GETMEM(MS, NEED) ((NEED) <= (MS)->alloced ? 0 :   \
@@ -2108,6 +2122,58 @@ reverse_sortslice(sortslice *s, Py_ssize_t n)
         reverse_slice(s->values, &s->values[n]);
 }
 
+/* Sort the nremaining >= 2 elements of lo, for which ms was initialized by
+ * merge_init().  March over the array once, left to right, finding natural
+ * runs, and extending short natural runs to minrun elements.
+ *
+ * Returns 0 on success, -1 on error.
+ */
+static int
+merge_sort_slice(MergeState *ms, sortslice lo, Py_ssize_t nremaining)
+{
+    Py_ssize_t minrun;
+
+    assert(nremaining >= 2);
+    minrun = merge_compute_minrun(nremaining);
+    do {
+        int descending;
+        Py_ssize_t n;
+
+        /* Identify next run. */
+        n = count_run(ms, lo.keys, lo.keys + nremaining, &descending);
+        if (n < 0)
+            return -1;
+        if (descending)
+            reverse_sortslice(&lo, n);
+        /* If short, extend to min(minrun, nremaining). */
+        if (n < minrun) {
+            const Py_ssize_t force = nremaining <= minrun ?
+                              nremaining : minrun;
+            if (binarysort(ms, lo, lo.keys + force, lo.keys + n) < 0)
+                return -1;
+            n = force;
+        }
+        /* Maybe merge pending runs. */
+        assert(ms->n == 0 || ms->pending[ms->n -1].base.keys +
+                             ms->pending[ms->n-1].len == lo.keys);
+        if (found_new_run(ms, n) < 0)
+            return -1;
+        /* Push new run on stack. */
+        assert(ms->n < MAX_MERGE_PENDING);
+        ms->pending[ms->n].base = lo;
+        ms->pending[ms->n].len = n;
+        ++ms->n;
+        /* Advance to find next run. */
+        sortslice_advance(&lo, n);
+        nremaining -= n;
+    } while (nremaining);
+
+    if (merge_force_collapse(ms) < 0)
+        return -1;
+    assert(ms->n == 1);
+    return 0;
+}
+
 /* Here we define custom comparison functions to optimize for the cases one commonly
  * encounters in practice: homogeneous lists, often of one of the basic types. */
 
@@ -2184,7 +2250,7 @@ unsafe_latin_compare(PyObject *v, PyObject *w, MergeState *ms)
            res < 0 :
            PyUnicode_GET_LENGTH(v) < PyUnicode_GET_LENGTH(w));
 
-    assert(res == PyObject_RichCompareBool(v, w, Py_LT));;
+    assert(ms->nogil || res == PyObject_RichCompareBool(v, w, Py_LT));
     return res;
 }
 
@@ -2209,7 +2275,7 @@ unsafe_long_compare(PyObject *v, PyObject *w, MergeState *ms)
     w0 = _PyLong_CompactValue(wl);
 
     res = v0 < w0;
-    assert(res == PyObject_RichCompareBool(v, w, Py_LT));
+    assert(ms->nogil || res == PyObject_RichCompareBool(v, w, Py_LT));
     return res;
 }
 
@@ -2224,7 +2290,7 @@ unsafe_float_compare(PyObject *v, PyObject *w, MergeState *ms)
     assert(Py_IS_TYPE(w, &PyFloat_Type));
 
     res = PyFloat_AS_DOUBLE(v) < PyFloat_AS_DOUBLE(w);
-    assert(res == PyObject_RichCompareBool(v, w, Py_LT));
+    assert(ms->nogil || res == PyObject_RichCompareBool(v, w, Py_LT));
     return res;
 }
 
@@ -2270,6 +2336,540 @@ unsafe_tuple_compare(PyObject *v, PyObject *w, MergeState *ms)
         return PyObject_RichCompareBool(vt->ob_item[i], wt->ob_item[i], Py_LT);
 }
 
+/* Parallel sorting.
+
+   When sys._set_sort_threads() allows it, lists of at least
+   2 * PARALLEL_SORT_MIN_CHUNK keys that compare with unsafe_long_compare(),
+   unsafe_float_compare() or unsafe_latin_compare() are sorted by several
+   threads.  Those keys are exact ints, floats and strs, which never change,
+   and comparing and moving them runs no Python code and touches no
+   reference count, so the threads don't need the GIL: the sorting thread
+   releases it while they work.  Other threads can't reach the keys through
+   the list, which is empty meanwhile.
+
+   The keys are split into one chunk per thread, which merge_sort_slice()
+   sorts.  Then the sorted chunks are merged pairwise by merge_at(), halving
+   their number in every round, until a single run is left.  Each merge
+   takes two adjacent runs, so the sort stays stable.  The sorting thread
+   does the first task of every round itself and starts a native thread for
+   each of the others.
+*/
+
+/* Minimum number of keys sorted by each thread */
+#define PARALLEL_SORT_MIN_CHUNK (1 << 15)
+
+typedef struct {
+    MergeState ms;
+    sortslice lo;
+    Py_ssize_t na;      /* number of keys at lo to sort, or of the first run */
+    Py_ssize_t nb;      /* 0 to sort, else length of the run following it */
+    int status;         /* 0 on success, -1 if out of memory */
+    PyThread_type_lock done;    /* held until a worker thread is done */
+} sort_task;
+
+static void
+sort_task_init(sort_task *task, MergeState *ms, sortslice lo,
+               Py_ssize_t start, Py_ssize_t na, Py_ssize_t nb)
+{
+    sortslice_advance(&lo, start);
+    merge_init(&task->ms, na + nb, lo.values != NULL, &lo);
+    task->ms.key_compare = ms->key_compare;
+    task->ms.nogil = 1;
+    task->lo = lo;
+    task->na = na;
+    task->nb = nb;
+    task->status = 0;
+    task->done = NULL;
+}
+
+static void
+sort_task_run(sort_task *task)
+{
+    MergeState *ms = &task->ms;
+
+    if (task->nb == 0) {
+        task->status = merge_sort_slice(ms, task->lo, task->na);
+    }
+    else {
+        ms->pending[0].base = task->lo;
+        ms->pending[0].len = task->na;
+        ms->pending[1].base = task->lo;
+        sortslice_advance(&ms->pending[1].base, task->na);
+        ms->pending[1].len = task->nb;
+        ms->n = 2;
+        task->status = merge_at(ms, 0) < 0 ? -1 : 0;
+    }
+    merge_freemem(ms);
+}
+
+static void
+sort_worker(void *arg)
+{
+    sort_task *task = (sort_task *)arg;
+
+    sort_task_run(task);
+    PyThread_release_lock(task->done);
+}
+
+/* Run the ntasks tasks, the first one in this thread and the others in new
+ * threads, and wait for all of them.  Called with the GIL held, which is
+ * released meanwhile.  A task whose thread can't be started runs in this
+ * thread too.  Returns 0 on success, -1 if a task failed.
+ */
+static int
+sort_run_tasks(sort_task *tasks, Py_ssize_t ntasks)
+{
+    Py_ssize_t i;
+    int status = 0;
+
+    for (i = 1; i < ntasks; i++) {
+        PyThread_type_lock done = PyThread_allocate_lock();
+        if (done == NULL)
+            continue;
+        PyThread_acquire_lock(done, WAIT_LOCK);
+        tasks[i].done = done;
+        if (PyThread_start_new_thread(sort_worker, &tasks[i]) ==
+                PYTHREAD_INVALID_THREAD_ID) {
+            tasks[i].done = NULL;
+            PyThread_release_lock(done);
+            PyThread_free_lock(done);
+        }
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    for (i = 0; i < ntasks; i++) {
+        if (tasks[i].done == NULL)
+            sort_task_run(&tasks[i]);
+    }
+    for (i = 1; i < ntasks; i++) {
+        if (tasks[i].done != NULL) {
+            PyThread_acquire_lock(tasks[i].done, WAIT_LOCK);
+            PyThread_release_lock(tasks[i].done);
+            PyThread_free_lock(tasks[i].done);
+            tasks[i].done = NULL;
+        }
+    }
+    Py_END_ALLOW_THREADS
+
+    for (i = 0; i < ntasks; i++) {
+        if (tasks[i].status < 0)
+            status = -1;
+    }
+    return status;
+}
+
+/* Sort the n keys of lo, for which ms has picked one of the compares that
+ * run without the GIL, with up to nthreads threads.  There must be at least
+ * two chunks of PARALLEL_SORT_MIN_CHUNK keys.
+ * Returns 0 on success, -1 with an exception set on error.
+ */
+static int
+parallel_sort(MergeState *ms, sortslice lo, Py_ssize_t n, int nthreads)
+{
+    Py_ssize_t nruns = Py_MIN(nthreads, n / PARALLEL_SORT_MIN_CHUNK);
+    Py_ssize_t ntasks, i;
+    Py_ssize_t *bounds;     /* starts of the runs, then n */
+    sort_task *tasks;
+    int status = -1;
+
+    assert(nruns >= 2);
+    bounds = PyMem_New(Py_ssize_t, nruns + 1);
+    tasks = PyMem_New(sort_task, nruns);
+    if (bounds == NULL || tasks == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    for (i = 0; i < nruns; i++)
+        bounds[i] = i * (n / nruns) + Py_MIN(i, n % nruns);
+    bounds[nruns] = n;
+    for (i = 0; i < nruns; i++)
+        sort_task_init(&tasks[i], ms, lo, bounds[i],
+                       bounds[i + 1] - bounds[i], 0);
+    ntasks = nruns;
+
+    for (;;) {
+        if (sort_run_tasks(tasks, ntasks) < 0) {
+            PyErr_NoMemory();
+            goto done;
+        }
+        if (nruns == 1)
+            break;
+        /* Merge pairs of adjacent runs; an odd last run is left as is. */
+        ntasks = nruns / 2;
+        for (i = 0; i < ntasks; i++)
+            sort_task_init(&tasks[i], ms, lo, bounds[2 * i],
+                           bounds[2 * i + 1] - bounds[2 * i],
+                           bounds[2 * i + 2] - bounds[2 * i + 1]);
+        nruns = (nruns + 1) / 2;
+        for (i = 0; i < nruns; i++)
+            bounds[i] = bounds[2 * i];
+        bounds[nruns] = n;
+    }
+    status = 0;
+
+  done:
+    PyMem_Free(bounds);
+    PyMem_Free(tasks);
+    return status;
+}
+
+/* Radix sorting.
+
+   Large lists whose keys compare with unsafe_long_compare(),
+   unsafe_float_compare() or unsafe_latin_compare() are sorted by
+   distributing the keys on their bytes rather than by comparing them,
+   unless a sample of them looks mostly sorted, which the mergesort handles
+   in about linear time.  Distributing is stable, like the mergesort.
+
+   Ints and floats are mapped to unsigned 64-bit integers that sort in the
+   same order: ints minus the smallest of them, and the bits of floats with
+   the sign bit flipped, or all bits flipped for negative floats.  -0.0 is
+   mapped like 0.0, since they compare equal; a NaN makes the list go to the
+   mergesort, because keys that don't have a total order have no "right"
+   result for the radix sort to match.  The (mapped key, index) pairs are
+   then sorted least significant byte first, skipping the bytes that are the
+   same in all keys, and the keys and values are finally permuted to follow.
+
+   Latin-1 strs are sorted most significant byte first: the keys are
+   distributed on their first byte, with the strs ending before it first,
+   and every group of more than RADIX_SMALL_BUCKET keys is distributed on
+   its next byte in turn.  Strs ending before the byte are all equal, and
+   smaller groups are sorted by binarysort().  The bytes that are the same
+   in a whole group are skipped, and past RADIX_MAX_DEPTH nested groups,
+   the mergesort finishes the group.
+
+   The radix sorts need temp memory for two (mapped key, index) pairs per
+   int or float, or for up to two pointers and a digit per str, where the
+   mergesort needs up to half a pointer per key.  Longer lists are sorted by
+   radix in chunks of at most RADIX_SORT_MAX keys, which the mergesort then
+   merges as its runs, so that the sort never needs much more memory than
+   the mergesort does.
+*/
+
+/* Minimum number of keys to sort them by radix */
+#define RADIX_SORT_MIN 256
+/* Maximum number of keys sorted by radix at once: the temp memory of a
+   chunk of ints or floats takes 8 MiB on 64-bit platforms */
+#define RADIX_SORT_MAX (1 << 18)
+/* Number of pairs of adjacent keys looked at to choose the radix sort */
+#define RADIX_SAMPLE 256
+/* Maximum number of keys sorted by binarysort() in the radix sort of strs */
+#define RADIX_SMALL_BUCKET 32
+/* Maximum number of nested groups in the radix sort of strs */
+#define RADIX_MAX_DEPTH 24
+
+typedef struct {
+    uint64_t key;
+    Py_ssize_t index;
+} radix_item;
+
+/* Move the keys and values of lo to the positions given by the indices of
+ * the n sorted items, using scratch as temp storage for n pointers.
+ */
+static void
+radix_permute(sortslice lo, radix_item *items, Py_ssize_t n,
+              PyObject **scratch)
+{
+    Py_ssize_t i;
+
+    for (i = 0; i < n; i++)
+        scratch[i] = lo.keys[items[i].index];
+    memcpy(lo.keys, scratch, n * sizeof(PyObject *));
+    if (lo.values != NULL) {
+        for (i = 0; i < n; i++)
+            scratch[i] = lo.values[items[i].index];
+        memcpy(lo.values, scratch, n * sizeof(PyObject *));
+    }
+}
+
+/* Return true if the n keys are worth sorting by radix: if there are
+ * enough descents among RADIX_SAMPLE pairs of adjacent keys spread over
+ * them.  A few descents mean a few long runs, which the mergesort merges
+ * faster.
+ */
+static int
+radix_sort_worthwhile(MergeState *ms, PyObject **keys, Py_ssize_t n)
+{
+    Py_ssize_t i, step = Py_MAX((n - 1) / RADIX_SAMPLE, 1);
+    int pairs = 0, descents = 0;
+
+    for (i = 1; i < n; i += step) {
+        descents += ms->key_compare(keys[i], keys[i - 1], ms);
+        pairs++;
+    }
+    return descents > pairs / 16;
+}
+
+/* Sort the n keys of lo, which are all ints for unsafe_long_compare() or
+ * all floats other than NaNs.  Returns 1 if they are sorted, 0 if the mergesort should sort
+ * them instead, which includes running out of memory.  The keys are then
+ * left as they were.
+ */
+static int
+radix_sort_numbers(MergeState *ms, sortslice lo, Py_ssize_t n)
+{
+    radix_item *items, *src, *dst;
+    Py_ssize_t (*counts)[256];
+    Py_ssize_t i;
+    uint64_t max;
+    int nbytes, b;
+
+    items = PyMem_New(radix_item, 2 * (size_t)n);
+    if (items == NULL)
+        return 0;
+    src = items;
+    dst = items + n;
+
+    if (ms->key_compare == unsafe_long_compare) {
+        int64_t smin = INT64_MAX, smax = INT64_MIN;
+        for (i = 0; i < n; i++) {
+            int64_t v = _PyLong_CompactValue((PyLongObject *)lo.keys[i]);
+            smin = Py_MIN(smin, v);
+            smax = Py_MAX(smax, v);
+            src[i].key = (uint64_t)v;
+            src[i].index = i;
+        }
+        /* Compact ints are much smaller than 2**63, so the difference of
+           two of them can't overflow. */
+        for (i = 0; i < n; i++)
+            src[i].key -= (uint64_t)smin;
+        max = (uint64_t)(smax - smin);
+    }
+    else {
+        assert(ms->key_compare == unsafe_float_compare);
+        max = UINT64_MAX;
+        for (i = 0; i < n; i++) {
+            double d = PyFloat_AS_DOUBLE(lo.keys[i]);
+            uint64_t u;
+            assert(!Py_IS_NAN(d));
+            if (d == 0.0)
+                d = 0.0;
+            memcpy(&u, &d, sizeof(u));
+            u ^= (uint64_t)((int64_t)u >> 63) | ((uint64_t)1 << 63);
+            src[i].key = u;
+            src[i].index = i;
+        }
+    }
+
+    counts = PyMem_Calloc(8, sizeof(*counts));
+    if (counts == NULL) {
+        PyMem_Free(items);
+        return 0;
+    }
+    for (nbytes = 0; nbytes < 8 && (max >> (8 * nbytes)) != 0; nbytes++)
+        ;
+    for (i = 0; i < n; i++) {
+        uint64_t k = src[i].key;
+        for (b = 0; b < nbytes; b++)
+            counts[b][(k >> (8 * b)) & 0xff]++;
+    }
+
+    for (b = 0; b < nbytes; b++) {
+        Py_ssize_t *count = counts[b];
+        int shift = 8 * b;
+        Py_ssize_t sum = 0;
+
+        /* Skip the bytes that are the same in all keys. */
+        if (count[(src[0].key >> shift) & 0xff] == n)
+            continue;
+        for (int d = 0; d < 256; d++) {
+            Py_ssize_t c = count[d];
+            count[d] = sum;
+            sum += c;
+        }
+        for (i = 0; i < n; i++)
+            dst[count[(src[i].key >> shift) & 0xff]++] = src[i];
+        radix_item *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    PyMem_Free(counts);
+
+    radix_permute(lo, src, n, (PyObject **)dst);
+    PyMem_Free(items);
+    return 1;
+}
+
+/* Sort the n keys of lo with the mergesort, using a MergeState of its own.
+ * Returns 0 on success, -1 with an exception set on error.
+ */
+static int
+radix_sort_fallback(MergeState *ms, sortslice lo, Py_ssize_t n)
+{
+    MergeState sub;
+    int status;
+
+    merge_init(&sub, n, lo.values != NULL, &lo);
+    sub.key_compare = ms->key_compare;
+    status = merge_sort_slice(&sub, lo, n);
+    merge_freemem(&sub);
+    return status;
+}
+
+/* Sort the n latin-1 strs of lo, which are equal in their first depth
+ * bytes, by their next bytes.  tmp has room to distribute n keys and
+ * values, and digits for n digits.  counts has room for 257 counts per
+ * level of recursion, level being the current one.
+ * Returns 0 on success, -1 with an exception set on error.
+ */
+static int
+radix_sort_latin_from(MergeState *ms, sortslice lo, Py_ssize_t n,
+                      Py_ssize_t depth, sortslice tmp, unsigned short *digits,
+                      Py_ssize_t *counts, int level)
+{
+    Py_ssize_t *count = counts + 257 * level;
+    Py_ssize_t i, start, m;
+    int d;
+
+    /* The digit of a str is 0 if it ends before depth, else 1 plus its byte
+       at depth.  Skip the bytes that are the same in all strs. */
+    for (;;) {
+        memset(count, 0, 257 * sizeof(Py_ssize_t));
+        for (i = 0; i < n; i++) {
+            PyObject *key = lo.keys[i];
+            d = 0;
+            if (depth < PyUnicode_GET_LENGTH(key))
+                d = 1 + PyUnicode_1BYTE_DATA(key)[depth];
+            digits[i] = (unsigned short)d;
+            count[d]++;
+        }
+        if (count[digits[0]] != n)
+            break;
+        /* Strs that all end before depth are equal. */
+        if (digits[0] == 0)
+            return 0;
+        depth++;
+    }
+
+    /* Distribute the keys, turning the counts into the ends of the groups. */
+    start = 0;
+    for (d = 0; d < 257; d++) {
+        Py_ssize_t c = count[d];
+        count[d] = start;
+        start += c;
+    }
+    for (i = 0; i < n; i++) {
+        Py_ssize_t j = count[digits[i]]++;
+        tmp.keys[j] = lo.keys[i];
+        if (lo.values != NULL)
+            tmp.values[j] = lo.values[i];
+    }
+    memcpy(lo.keys, tmp.keys, n * sizeof(PyObject *));
+    if (lo.values != NULL)
+        memcpy(lo.values, tmp.values, n * sizeof(PyObject *));
+
+    /* Sort the groups of strs that don't end before depth. */
+    for (d = 1, start = count[0]; d < 257; start = count[d++]) {
+        sortslice group = lo, group_tmp = tmp;
+        m = count[d] - start;
+        if (m < 2)
+            continue;
+        sortslice_advance(&group, start);
+        if (m <= RADIX_SMALL_BUCKET) {
+            if (binarysort(ms, group, group.keys + m, group.keys) < 0)
+                return -1;
+        }
+        else if (level + 1 == RADIX_MAX_DEPTH) {
+            if (radix_sort_fallback(ms, group, m) < 0)
+                return -1;
+        }
+        else {
+            sortslice_advance(&group_tmp, start);
+            if (radix_sort_latin_from(ms, group, m, depth + 1, group_tmp,
+                                      digits + start, counts, level + 1) < 0)
+                return -1;
+        }
+    }
+    return 0;
+}
+
+/* Sort the n keys of lo, which are all latin-1 strs.  Returns 1 if they are
+ * sorted, 0 if the mergesort should sort them instead, which includes
+ * running out of memory.
+ */
+static int
+radix_sort_latin(MergeState *ms, sortslice lo, Py_ssize_t n)
+{
+    PyObject **buffer;
+    unsigned short *digits;
+    Py_ssize_t *counts;
+    sortslice tmp;
+    int multiplier = lo.values != NULL ? 2 : 1;
+    int status = 0;
+
+    buffer = PyMem_New(PyObject *, multiplier * (size_t)n);
+    digits = PyMem_New(unsigned short, n);
+    counts = PyMem_New(Py_ssize_t, 257 * RADIX_MAX_DEPTH);
+    if (buffer == NULL || digits == NULL || counts == NULL)
+        goto done;
+    tmp.keys = buffer;
+    tmp.values = lo.values != NULL ? buffer + n : NULL;
+    if (radix_sort_latin_from(ms, lo, n, 0, tmp, digits, counts, 0) == 0)
+        status = 1;
+    else {
+        /* Latin-1 strs compare without error, so only the mergesort of a
+           deep group can fail, for lack of memory.  The keys are still a
+           permutation of the list, which the mergesort can retry. */
+        PyErr_Clear();
+    }
+
+  done:
+    PyMem_Free(buffer);
+    PyMem_Free(digits);
+    PyMem_Free(counts);
+    return status;
+}
+
+/* Sort the n keys of lo, for which ms was initialized by merge_init() and
+ * whose key_compare is one of the radix sorts', in chunks of RADIX_SORT_MAX
+ * keys at most, merged by the mergesort.  Returns 1 if they are sorted, 0 if
+ * the mergesort should sort them instead, -1 with an exception set on error.
+ * The keys are a permutation of the list in all cases.
+ */
+static int
+radix_sort(MergeState *ms, sortslice lo, Py_ssize_t n)
+{
+    Py_ssize_t nchunks = (n + RADIX_SORT_MAX - 1) / RADIX_SORT_MAX;
+    Py_ssize_t chunk = (n + nchunks - 1) / nchunks;
+
+    if (!radix_sort_worthwhile(ms, lo.keys, n))
+        return 0;
+    if (ms->key_compare == unsafe_float_compare) {
+        /* Where NaNs end up depends on the order of the keys: the
+           mergesort must sort the list before any chunk is sorted. */
+        for (Py_ssize_t i = 0; i < n; i++) {
+            if (Py_IS_NAN(PyFloat_AS_DOUBLE(lo.keys[i])))
+                return 0;
+        }
+    }
+    while (n > 0) {
+        Py_ssize_t m = Py_MIN(n, chunk);
+        int sorted;
+        if (ms->key_compare == unsafe_latin_compare)
+            sorted = radix_sort_latin(ms, lo, m);
+        else
+            sorted = radix_sort_numbers(ms, lo, m);
+        if (!sorted) {
+            /* The chunks sorted so far are runs for the mergesort */
+            ms->n = 0;
+            return 0;
+        }
+        if (found_new_run(ms, m) < 0)
+            return -1;
+        assert(ms->n < MAX_MERGE_PENDING);
+        ms->pending[ms->n].base = lo;
+        ms->pending[ms->n].len = m;
+        ++ms->n;
+        sortslice_advance(&lo, m);
+        n -= m;
+    }
+    if (merge_force_collapse(ms) < 0)
+        return -1;
+    assert(ms->n == 1);
+    return 1;
+}
+
 /* An adaptive, stable, natural mergesort.  See listsort.txt.
  * Returns Py_None on success, NULL on error.  Even in case of error, the
  * list will be some permutation of its input state (nothing is lost or
@@ -2299,7 +2899,7 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
 {
     MergeState ms;
     Py_ssize_t nremaining;
-    Py_ssize_t minrun;
+    int nthreads;
     sortslice lo;
     Py_ssize_t saved_ob_size, saved_allocated;
     PyObject **saved_ob_item;
@@ -2473,51 +3073,32 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
         reverse_slice(&saved_ob_item[0], &saved_ob_item[saved_ob_size]);
     }
 
-    /* March over the array once, left to right, finding natural runs,
-     * and extending short natural runs to minrun elements.
-     */
-    minrun = merge_compute_minrun(nremaining);
-    do {
-        int descending;
-        Py_ssize_t n;
-
-        /* Identify next run. */
-        n = count_run(&ms, lo.keys, lo.keys + nremaining, &descending);
-        if (n < 0)
+    nthreads = _PyInterpreterState_GET()->list.sort_threads;
+    if (nthreads <= 1 && nremaining >= RADIX_SORT_MIN &&
+        (ms.key_compare == unsafe_long_compare ||
+         ms.key_compare == unsafe_float_compare ||
+         ms.key_compare == unsafe_latin_compare)) {
+        int sorted = radix_sort(&ms, lo, nremaining);
+        if (sorted < 0)
             goto fail;
-        if (descending)
-            reverse_sortslice(&lo, n);
-        /* If short, extend to min(minrun, nremaining). */
-        if (n < minrun) {
-            const Py_ssize_t force = nremaining <= minrun ?
-                              nremaining : minrun;
-            if (binarysort(&ms, lo, lo.keys + force, lo.keys + n) < 0)
-                goto fail;
-            n = force;
-        }
-        /* Maybe merge pending runs. */
-        assert(ms.n == 0 || ms.pending[ms.n -1].base.keys +
-                            ms.pending[ms.n-1].len == lo.keys);
-        if (found_new_run(&ms, n) < 0)
+        if (sorted)
+            goto succeed;
+    }
+    if (nthreads > 1 && nremaining >= 2 * PARALLEL_SORT_MIN_CHUNK &&
+        (ms.key_compare == unsafe_long_compare ||
+         ms.key_compare == unsafe_float_compare ||
+         ms.key_compare == unsafe_latin_compare)) {
+        if (parallel_sort(&ms, lo, nremaining, nthreads) < 0)
             goto fail;
-        /* Push new run on stack. */
-        assert(ms.n < MAX_MERGE_PENDING);
-        ms.pending[ms.n].base = lo;
-        ms.pending[ms.n].len = n;
-        ++ms.n;
-        /* Advance to find next run. */
-        sortslice_advance(&lo, n);
-        nremaining -= n;
-    } while (nremaining);
+        goto succeed;
+    }
 
-    if (merge_force_collapse(&ms) < 0)
+    if (merge_sort_slice(&ms, lo, nremaining) < 0)
         goto fail;
-    assert(ms.n == 1);
     assert(keys == NULL
            ? ms.pending[0].base.keys == saved_ob_item
            : ms.pending[0].base.keys == &keys[0]);
     assert(ms.pending[0].len == saved_ob_size);
-    lo = ms.pending[0].base;
 
 succeed:
     result = Py_None;
@@ -74,6 +74,11 @@ maybe_small_long(PyLongObject *v)
 #define KARATSUBA_CUTOFF 70
 #define KARATSUBA_SQUARE_CUTOFF (2 * KARATSUBA_CUTOFF)
 
+/* Above TOOM3_CUTOFF digits, Karatsuba gives way to the Toom-Cook 3-way
+ * algorithm, which splits the operands in three pieces instead of two.
+ */
+#define TOOM3_CUTOFF 300
+
 /* For exponentiation, use the binary left-to-right algorithm unless the
  ^ exponent contains more than HUGE_EXP_CUTOFF bits.  In that case, do
  * (no more than) EXP_WINDOW_SIZE bits at a time.  The potential drawback is
@@ -3651,6 +3656,7 @@ kmul_split(PyLongObject *n,
 }
 
 static PyLongObject *k_lopsided_mul(PyLongObject *a, PyLongObject *b);
+static PyLongObject *toom3_mul(PyLongObject *a, PyLongObject *b);
 
 /* Karatsuba multiplication.  Ignores the input signs, and returns the
  * absolute value of the product (or NULL if error).
@@ -3709,6 +3715,12 @@ k_mul(PyLongObject *a, PyLongObject *b)
     if (2 * asize <= bsize)
         return k_lopsided_mul(a, b);
 
+    /* Large inputs of balanced sizes are better split in three: that is,
+     * if a has more digits than the two low pieces of b.
+     */
+    if (asize > TOOM3_CUTOFF && asize > 2 * ((bsize + 2) / 3))
+        return toom3_mul(a, b);
+
     /* Split a & b into hi & lo pieces. */
     shift = bsize >> 1;
     if (kmul_split(a, shift, &ah, &al) < 0) goto fail;
@@ -3929,6 +3941,228 @@ k_lopsided_mul(PyLongObject *a, PyLongObject *b)
     return NULL;
 }
 
+/* A helper for Toom-Cook multiplication (toom3_mul).
+   Returns the digits of abs(n) from start to start+size as a new int,
+   viewing n as padded with zero digits.  The sign bit is ignored, and the
+   return value is >= 0.  Returns NULL on failure.
+*/
+static PyLongObject *
+toom3_piece(PyLongObject *n, Py_ssize_t start, Py_ssize_t size)
+{
+    const Py_ssize_t size_n = _PyLong_DigitCount(n);
+    PyLongObject *piece;
+
+    start = Py_MIN(start, size_n);
+    size = Py_MIN(size, size_n - start);
+    if ((piece = _PyLong_New(size)) == NULL)
+        return NULL;
+    memcpy(piece->long_value.ob_digit, n->long_value.ob_digit + start,
+           size * sizeof(digit));
+    return long_normalize(piece);
+}
+
+/* A helper for Toom-Cook multiplication (toom3_mul).
+   Evaluates the polynomial x2*t**2 + x1*t + x0 at t = 1, -1 and -2.
+   Returns 0 on success, -1 on failure.
+*/
+static int
+toom3_eval(PyLongObject *x0, PyLongObject *x1, PyLongObject *x2,
+           PyLongObject **p1, PyLongObject **pm1, PyLongObject **pm2)
+{
+    PyLongObject *t, *u;
+
+    *p1 = *pm1 = *pm2 = NULL;
+    if ((t = (PyLongObject *)_PyLong_Add(x0, x2)) == NULL)
+        return -1;
+    *p1 = (PyLongObject *)_PyLong_Add(t, x1);
+    *pm1 = (PyLongObject *)_PyLong_Subtract(t, x1);
+    Py_DECREF(t);
+    if (*p1 == NULL || *pm1 == NULL)
+        goto fail;
+    /* p(-2) = 2*(p(-1) + x2) - x0 */
+    if ((t = (PyLongObject *)_PyLong_Add(*pm1, x2)) == NULL)
+        goto fail;
+    u = (PyLongObject *)_PyLong_Add(t, t);
+    Py_DECREF(t);
+    if (u == NULL)
+        goto fail;
+    *pm2 = (PyLongObject *)_PyLong_Subtract(u, x0);
+    Py_DECREF(u);
+    if (*pm2 == NULL)
+        goto fail;
+    return 0;
+
+  fail:
+    Py_CLEAR(*p1);
+    Py_CLEAR(*pm1);
+    return -1;
+}
+
+/* A helper for Toom-Cook multiplication (toom3_mul).
+   Returns (x - y) / n, where the division is known to be exact.
+*/
+static PyLongObject *
+toom3_sub_divexact(PyLongObject *x, PyLongObject *y, digit n)
+{
+    PyLongObject *t, *q;
+    digit rem;
+
+    if ((t = (PyLongObject *)_PyLong_Subtract(x, y)) == NULL)
+        return NULL;
+    q = divrem1(t, n, &rem);
+    assert(rem == 0);
+    if (q != NULL && _PyLong_IsNegative(t))
+        _PyLong_Negate(&q);
+    Py_DECREF(t);
+    return q;
+}
+
+/* Toom-Cook 3-way multiplication.  Ignores the input signs, and returns the
+ * absolute value of the product (or NULL if error).
+ *
+ * a and b are split in three pieces of shift digits, seen as the
+ * coefficients of polynomials A(t) and B(t) of degree 2, so that
+ * abs(a)*abs(b) is C(X) = A(X)*B(X) for X = BASE**shift.  C has degree 4:
+ * it is interpolated from its values at 0, 1, -1, -2 and infinity, each the
+ * product of the values of A and B there.  That's 5 multiplications of
+ * numbers a third of the size, against 9 for schoolbook and, recursively,
+ * 3**log2(3) ~= 5.7 for Karatsuba.  The interpolation sequence is Marco
+ * Bodrato's, which only needs additions, shifts, and exact divisions by 2
+ * and 3.  See "Towards Optimal Toom-Cook Multiplication for Univariate and
+ * Multivariate Polynomials in Characteristic 2 and 0" (WAIFI 2007).
+ */
+static PyLongObject *
+toom3_mul(PyLongObject *a, PyLongObject *b)
+{
+    const Py_ssize_t asize = _PyLong_DigitCount(a);
+    const Py_ssize_t bsize = _PyLong_DigitCount(b);
+    const Py_ssize_t shift = (bsize + 2) / 3;
+    PyLongObject *a0 = NULL, *a1 = NULL, *a2 = NULL;
+    PyLongObject *b0 = NULL, *b1 = NULL, *b2 = NULL;
+    PyLongObject *pa1 = NULL, *pam1 = NULL, *pam2 = NULL;
+    PyLongObject *pb1 = NULL, *pbm1 = NULL, *pbm2 = NULL;
+    PyLongObject *r0 = NULL, *r1 = NULL, *r2 = NULL, *r3 = NULL, *r4 = NULL;
+    PyLongObject *rm1 = NULL, *rm2 = NULL, *t = NULL;
+    PyLongObject *ret = NULL;
+    Py_ssize_t i;
+
+    assert(asize <= bsize);
+    assert(asize > 2 * shift);      /* the split isn't degenerate */
+
+    /* Split a & b into three pieces, and evaluate them at 1, -1 and -2. */
+    if ((a0 = toom3_piece(a, 0, shift)) == NULL ||
+        (a1 = toom3_piece(a, shift, shift)) == NULL ||
+        (a2 = toom3_piece(a, 2 * shift, asize)) == NULL)
+        goto done;
+    if (toom3_eval(a0, a1, a2, &pa1, &pam1, &pam2) < 0)
+        goto done;
+    if (a == b) {
+        b0 = (PyLongObject*)Py_NewRef(a0);
+        b1 = (PyLongObject*)Py_NewRef(a1);
+        b2 = (PyLongObject*)Py_NewRef(a2);
+        pb1 = (PyLongObject*)Py_NewRef(pa1);
+        pbm1 = (PyLongObject*)Py_NewRef(pam1);
+        pbm2 = (PyLongObject*)Py_NewRef(pam2);
+    }
+    else {
+        if ((b0 = toom3_piece(b, 0, shift)) == NULL ||
+            (b1 = toom3_piece(b, shift, shift)) == NULL ||
+            (b2 = toom3_piece(b, 2 * shift, bsize)) == NULL)
+            goto done;
+        if (toom3_eval(b0, b1, b2, &pb1, &pbm1, &pbm2) < 0)
+            goto done;
+    }
+
+    /* The values of C at 0, 1, -1, -2 and infinity.  _PyLong_Multiply()
+     * takes care of the signs, and recurses into k_mul().
+     */
+    if ((r0 = (PyLongObject *)_PyLong_Multiply(a0, b0)) == NULL ||
+        (r1 = (PyLongObject *)_PyLong_Multiply(pa1, pb1)) == NULL ||
+        (rm1 = (PyLongObject *)_PyLong_Multiply(pam1, pbm1)) == NULL ||
+        (rm2 = (PyLongObject *)_PyLong_Multiply(pam2, pbm2)) == NULL ||
+        (r4 = (PyLongObject *)_PyLong_Multiply(a2, b2)) == NULL)
+        goto done;
+
+    /* Interpolate the coefficients r0 to r4 of C:
+     *     r3 = (C(-2) - C(1)) / 3
+     *     r1 = (C(1) - C(-1)) / 2
+     *     r2 = C(-1) - C(0)
+     *     r3 = (r2 - r3) / 2 + 2*C(inf)
+     *     r2 = r2 + r1 - C(inf)
+     *     r1 = r1 - r3
+     */
+    if ((r3 = toom3_sub_divexact(rm2, r1, 3)) == NULL)
+        goto done;
+    Py_SETREF(r1, toom3_sub_divexact(r1, rm1, 2));
+    if (r1 == NULL)
+        goto done;
+    if ((r2 = (PyLongObject *)_PyLong_Subtract(rm1, r0)) == NULL)
+        goto done;
+    Py_SETREF(r3, toom3_sub_divexact(r2, r3, 2));
+    if (r3 == NULL)
+        goto done;
+    if ((t = (PyLongObject *)_PyLong_Add(r4, r4)) == NULL)
+        goto done;
+    Py_SETREF(r3, (PyLongObject *)_PyLong_Add(r3, t));
+    Py_CLEAR(t);
+    if (r3 == NULL)
+        goto done;
+    Py_SETREF(r2, (PyLongObject *)_PyLong_Add(r2, r1));
+    if (r2 == NULL)
+        goto done;
+    Py_SETREF(r2, (PyLongObject *)_PyLong_Subtract(r2, r4));
+    if (r2 == NULL)
+        goto done;
+    Py_SETREF(r1, (PyLongObject *)_PyLong_Subtract(r1, r3));
+    if (r1 == NULL)
+        goto done;
+
+    /* The coefficients of C are sums of products of the (non-negative)
+     * pieces, so that they are non-negative as well, and C(X) is the
+     * result.  Add them into the result at their digit offsets: as for
+     * k_lopsided_mul, the partial sums never exceed the final result, so
+     * that they always have room.
+     */
+    ret = _PyLong_New(asize + bsize);
+    if (ret == NULL)
+        goto done;
+    memset(ret->long_value.ob_digit, 0, (asize + bsize) * sizeof(digit));
+    PyLongObject *coefficients[5] = {r0, r1, r2, r3, r4};
+    for (i = 0; i < 5; i++) {
+        PyLongObject *c = coefficients[i];
+        assert(!_PyLong_IsNegative(c));
+        if (_PyLong_IsZero(c))
+            continue;
+        assert(i * shift + _PyLong_DigitCount(c) <= asize + bsize);
+        (void)v_iadd(ret->long_value.ob_digit + i * shift,
+                     asize + bsize - i * shift,
+                     c->long_value.ob_digit, _PyLong_DigitCount(c));
+    }
+    ret = long_normalize(ret);
+
+  done:
+    Py_XDECREF(a0);
+    Py_XDECREF(a1);
+    Py_XDECREF(a2);
+    Py_XDECREF(b0);
+    Py_XDECREF(b1);
+    Py_XDECREF(b2);
+    Py_XDECREF(pa1);
+    Py_XDECREF(pam1);
+    Py_XDECREF(pam2);
+    Py_XDECREF(pb1);
+    Py_XDECREF(pbm1);
+    Py_XDECREF(pbm2);
+    Py_XDECREF(r0);
+    Py_XDECREF(r1);
+    Py_XDECREF(r2);
+    Py_XDECREF(r3);
+    Py_XDECREF(r4);
+    Py_XDECREF(rm1);
+    Py_XDECREF(rm2);
+    return ret;
+}
+
 PyObject *
 _PyLong_Multiply(PyLongObject *a, PyLongObject *b)
 {
@@ -7,6 +7,7 @@
 #include "pycore_context.h"       // _PyContextTokenMissing_Type
 #include "pycore_dict.h"          // _PyObject_MakeDictFromInstanceAttributes()
 #include "pycore_floatobject.h"   // _PyFloat_DebugMallocStats()
+#include "pycore_genobject.h"     // _PyGen_DebugMallocStats()
 #include "pycore_initconfig.h"    // _PyStatus_EXCEPTION()
 #include "pycore_namespace.h"     // _PyNamespace_Type
 #include "pycore_object.h"        // _PyType_CheckConsistency(), _Py_FatalRefcountError()
@@ -1916,9 +1917,9 @@ PyTypeObject _PyNone_Type = {
 
 PyObject _Py_NoneStruct = {
     _PyObject_EXTRA_INIT
-    { _Py_IMMORTAL_REFCNT },
-    &_PyNone_Type,
-    _Py_IMMUTABLE
+    { _Py_IMMUTABLE_REFCNT },
+    &_PyNone_Type
+    _PyObject_REGION_INIT(_Py_IMMUTABLE)
 };
 
 /* NotImplemented is an object that can be used to signal that an
@@ -2213,6 +2214,9 @@ new_reference(PyObject *op)
     if (_PyRuntime.tracemalloc.config.tracing) {
         _PyTraceMalloc_NewReference(op);
     }
+    if (_PyRuntime.obmalloc.census_active) {
+        _PyObject_AllocCensusNewReference(op);
+    }
     // Skip the immortal object check in Py_SET_REFCNT; always set refcnt to 1
     op->ob_refcnt = 1;
 #ifdef Py_TRACE_REFS
@@ -2355,6 +2359,7 @@ _PyObject_DebugTypeStats(FILE *out)
 {
     _PyDict_DebugMallocStats(out);
     _PyFloat_DebugMallocStats(out);
+    _PyGen_DebugMallocStats(out);
     _PyList_DebugMallocStats(out);
     _PyTuple_DebugMallocStats(out);
 }
@@ -2642,6 +2647,9 @@ _Py_Dealloc(PyObject *op)
 #ifdef Py_TRACE_REFS
     _Py_ForgetReference(op);
 #endif
+    if (_PyRuntime.obmalloc.census_active) {
+        _PyObject_AllocCensusDealloc(op);
+    }
     (*dealloc)(op);
 
 #ifdef Py_DEBUG
@@ -2,6 +2,7 @@
 
 #include "Python.h"
 #include "pycore_code.h"          // stats
+#include "pycore_hashtable.h"     // _Py_hashtable_t
 #include "pycore_pystate.h"       // _PyInterpreterState_GET
 
 #include "pycore_obmalloc.h"
@@ -880,6 +881,7 @@ get_state(void)
 #define narenas_currently_allocated (state->mgmt.narenas_currently_allocated)
 #define ntimes_arena_allocated (state->mgmt.ntimes_arena_allocated)
 #define narenas_highwater (state->mgmt.narenas_highwater)
+#define npools_purged (state->mgmt.npools_purged)
 #define raw_allocated_blocks (state->mgmt.raw_allocated_blocks)
 
 Py_ssize_t
@@ -895,7 +897,8 @@ _PyInterpreterState_GetAllocatedBlocks(PyInterpreterState *interp)
 #endif
     OMState *state = &interp->obmalloc;
 
-    Py_ssize_t n = raw_allocated_blocks;
+    /* The blocks in the caches of the threads are free */
+    Py_ssize_t n = raw_allocated_blocks - state->cache.cached_blocks;
     /* add up allocated blocks for used pools */
     for (uint i = 0; i < maxarenas; ++i) {
         /* Skip arenas which are not allocated. */
@@ -1134,6 +1137,112 @@ arena_map_is_used(OMState *state, pymem_block *p)
 #endif /* WITH_PYMALLOC_RADIX_TREE */
 
 
+/*==========================================================================*/
+/* Giving the memory of free pools back to the OS.
+ *
+ * An arena is unmapped as soon as all of its pools are free, but one live
+ * object is enough to keep the whole arena mapped, so after a spike of
+ * allocations most of the memory of the arenas that survive it sits in free
+ * pools.  When ARENA_PURGE_POOLS of the free pools of an arena have been
+ * used since their pages were last given back, the pages of all of them,
+ * except the first one that holds the pool header, are given back to the OS
+ * with madvise().  A purged pool gets DUMMY_SIZE_IDX as size class, so that
+ * allocate_from_new_pool() initializes it anew instead of reusing its free
+ * list.
+ *
+ * On Linux MADV_DONTNEED drops the pages at once; elsewhere it may only be a
+ * hint, and MADV_FREE is used instead.
+ */
+#if defined(ARENAS_USE_MMAP) && defined(HAVE_MADVISE) && defined(HAVE_SYSCONF)
+#  if defined(__linux__) && defined(MADV_DONTNEED)
+#    define POOL_PURGE_ADVICE MADV_DONTNEED
+#  elif defined(MADV_FREE)
+#    define POOL_PURGE_ADVICE MADV_FREE
+#  endif
+#endif
+
+#define ARENA_PURGE_POOLS (MAX_POOLS_IN_ARENA / 8)
+
+/* The hugepage mode, set by PYTHONMALLOCHUGEPAGES, asks the OS to back the
+ * arenas with transparent huge pages.  The free pools aren't purged then:
+ * that would split the huge pages.
+ */
+static int
+arena_hugepages(void)
+{
+    int hugepages = _PyRuntime.obmalloc.arena_hugepages;
+    if (UNLIKELY(hugepages == -1)) {
+        const char *opt = Py_GETENV("PYTHONMALLOCHUGEPAGES");
+        hugepages = (opt != NULL && *opt != '\0');
+        _PyRuntime.obmalloc.arena_hugepages = hugepages;
+    }
+    return hugepages;
+}
+
+#ifdef POOL_PURGE_ADVICE
+/* Return the number of bytes to give back from the end of each free pool,
+ * or 0 if free pools are not purged.
+ */
+static size_t
+pool_purge_size(void)
+{
+    static size_t purge_size = (size_t)-1;
+    if (UNLIKELY(purge_size == (size_t)-1)) {
+        long page_size = sysconf(_SC_PAGESIZE);
+        if (page_size > 0 && (size_t)page_size < POOL_SIZE) {
+            purge_size = POOL_SIZE - (size_t)page_size;
+        }
+        else {
+            purge_size = 0;
+        }
+    }
+    if (arena_hugepages() || _PyObject_Arena.alloc != _PyMem_ArenaAlloc) {
+        /* The arenas may not be plain anonymous mappings. */
+        return 0;
+    }
+    return purge_size;
+}
+#endif
+
+/* Called when pool has been added to the free pools of its arena ao. */
+static inline void
+arena_add_dirty_pool(OMState *state, struct arena_object *ao)
+{
+#ifdef POOL_PURGE_ADVICE
+    if (++ao->ndirtypools < ARENA_PURGE_POOLS) {
+        return;
+    }
+    size_t purge_size = pool_purge_size();
+    if (purge_size == 0) {
+        return;
+    }
+    for (poolp pool = ao->freepools; pool != NULL; pool = pool->nextpool) {
+        if (pool->szidx == DUMMY_SIZE_IDX) {
+            continue;
+        }
+        (void)madvise((pymem_block *)pool + (POOL_SIZE - purge_size),
+                      purge_size, POOL_PURGE_ADVICE);
+        pool->szidx = DUMMY_SIZE_IDX;
+        ++npools_purged;
+    }
+    ao->ndirtypools = 0;
+#else
+    (void)state;
+    ++ao->ndirtypools;
+#endif
+}
+
+/* Called when pool is taken from the free pools of its arena ao. */
+static inline void
+arena_remove_free_pool(struct arena_object *ao, poolp pool)
+{
+    if (pool->szidx != DUMMY_SIZE_IDX) {
+        assert(ao->ndirtypools > 0);
+        --ao->ndirtypools;
+    }
+}
+
+
 /* Allocate a new arena.  If we run out of memory, return NULL.  Else
  * allocate a new arena, and return the address of an arena_object
  * describing the new arena.  It's expected that the caller will set
@@ -1155,6 +1264,7 @@ new_arena(OMState *state)
     if (debug_stats) {
         _PyObject_DebugMallocStats(stderr);
     }
+    int hugepages = arena_hugepages();
 
     if (unused_arena_objects == NULL) {
         uint i;
@@ -1222,12 +1332,22 @@ new_arena(OMState *state)
         return NULL;
     }
     arenaobj->address = (uintptr_t)address;
+#if defined(ARENAS_USE_MMAP) && defined(HAVE_MADVISE) && defined(MADV_HUGEPAGE)
+    if (hugepages && _PyObject_Arena.alloc == _PyMem_ArenaAlloc) {
+        /* Consecutive arenas are usually mapped next to each other, so the
+         * kernel can merge them and back them with huge pages. */
+        (void)madvise(address, ARENA_SIZE, MADV_HUGEPAGE);
+    }
+#else
+    (void)hugepages;
+#endif
 
     ++narenas_currently_allocated;
     ++ntimes_arena_allocated;
     if (narenas_currently_allocated > narenas_highwater)
         narenas_highwater = narenas_currently_allocated;
     arenaobj->freepools = NULL;
+    arenaobj->ndirtypools = 0;
     /* pool_address <- first pool-aligned address in the arena
        nfreepools <- number of whole pools that fit after alignment */
     arenaobj->pool_address = (pymem_block*)arenaobj->address;
@@ -1418,6 +1538,7 @@ allocate_from_new_pool(OMState *state, uint size)
         /* Unlink from cached pools. */
         usable_arenas->freepools = pool->nextpool;
         usable_arenas->nfreepools--;
+        arena_remove_free_pool(usable_arenas, pool);
         if (UNLIKELY(usable_arenas->nfreepools == 0)) {
             /* Wholly allocated:  remove. */
             assert(usable_arenas->freepools == NULL);
@@ -1501,6 +1622,80 @@ allocate_from_new_pool(OMState *state, uint size)
     return bp;
 }
 
+/* Per-thread caches (see struct _obmalloc_thread_cache) */
+
+/* Pop a free block of size class size from the cache of the current thread,
+   or return NULL, also when no thread state is current. */
+static inline pymem_block *
+thread_cache_pop(OMState *state, uint size)
+{
+    PyThreadState *tstate = _PyThreadState_GET();
+    if (UNLIKELY(tstate == NULL)) {
+        return NULL;
+    }
+    struct _obmalloc_thread_cache *cache = tstate->obmalloc_cache;
+    if (UNLIKELY(cache == NULL || cache->state != state)) {
+        return NULL;
+    }
+    pymem_block *bp = cache->blocks[size];
+    if (UNLIKELY(bp == NULL)) {
+        cache->misses++;
+        return NULL;
+    }
+    cache->blocks[size] = *(pymem_block **)bp;
+    cache->nblocks[size]--;
+    state->cache.cached_blocks--;
+    cache->hits++;
+    return bp;
+}
+
+static struct _obmalloc_thread_cache *
+new_thread_cache(OMState *state, PyThreadState *tstate)
+{
+    if (!tstate->_status.initialized || tstate->_status.cleared) {
+        /* The cache would never be cleared */
+        return NULL;
+    }
+    /* Not PyMem_RawCalloc(): the raw allocator may be replaced before the
+       cache is freed */
+    struct _obmalloc_thread_cache *cache = calloc(1, sizeof(*cache));
+    if (cache == NULL) {
+        return NULL;
+    }
+    cache->state = state;
+    tstate->obmalloc_cache = cache;
+    return cache;
+}
+
+/* Push the free block p of pool to the cache of the current thread.
+   Return 0 if no thread state is current or the cache can't take it. */
+static inline int
+thread_cache_push(OMState *state, poolp pool, pymem_block *p)
+{
+    PyThreadState *tstate = _PyThreadState_GET();
+    if (UNLIKELY(tstate == NULL)) {
+        return 0;
+    }
+    struct _obmalloc_thread_cache *cache = tstate->obmalloc_cache;
+    if (UNLIKELY(cache == NULL)) {
+        cache = new_thread_cache(state, tstate);
+        if (cache == NULL) {
+            return 0;
+        }
+    }
+    uint size = pool->szidx;
+    if (UNLIKELY(cache->state != state
+                 || cache->nblocks[size] >= OBMALLOC_CACHE_BLOCKS))
+    {
+        return 0;
+    }
+    *(pymem_block **)p = cache->blocks[size];
+    cache->blocks[size] = p;
+    cache->nblocks[size]++;
+    state->cache.cached_blocks++;
+    return 1;
+}
+
 /* pymalloc allocator
 
    Return a pointer to newly allocated memory if pymalloc allocated memory.
@@ -1529,9 +1724,12 @@ pymalloc_alloc(OMState *state, void *Py_UNUSED(ctx), size_t nbytes)
     }
 
     uint size = (uint)(nbytes - 1) >> ALIGNMENT_SHIFT;
-    poolp pool = usedpools[size + size];
-    pymem_block *bp;
+    pymem_block *bp = thread_cache_pop(state, size);
+    if (LIKELY(bp != NULL)) {
+        return (void *)bp;
+    }
 
+    poolp pool = usedpools[size + size];
     if (LIKELY(pool != pool->nextpool)) {
         /*
          * There is a used pool for this size class.
@@ -1707,6 +1905,9 @@ insert_to_freepool(OMState *state, poolp pool)
         return;
     }
 
+    /* The arena stays: purge its free pools if there are enough of them. */
+    arena_add_dirty_pool(state, ao);
+
     if (nf == 1) {
         /* Case 2.  Put ao at the head of
          * usable_arenas.  Note that because
@@ -1778,26 +1979,10 @@ insert_to_freepool(OMState *state, poolp pool)
            || ao->prevarena->nextarena == ao);
 }
 
-/* Free a memory block allocated by pymalloc_alloc().
-   Return 1 if it was freed.
-   Return 0 if the block was not allocated by pymalloc_alloc(). */
-static inline int
-pymalloc_free(OMState *state, void *Py_UNUSED(ctx), void *p)
+/* Give the block p back to its pool */
+static void
+pool_free(OMState *state, poolp pool, pymem_block *p)
 {
-    assert(p != NULL);
-
-#ifdef WITH_VALGRIND
-    if (UNLIKELY(running_on_valgrind > 0)) {
-        return 0;
-    }
-#endif
-
-    poolp pool = POOL_ADDR(p);
-    if (UNLIKELY(!address_in_range(state, p, pool))) {
-        return 0;
-    }
-    /* We allocated this address. */
-
     /* Link p to the start of the pool's freeblock list.  Since
      * the pool had at least the p block outstanding, the pool
      * wasn't empty (so it's already in a usedpools[] list, or
@@ -1807,7 +1992,7 @@ pymalloc_free(OMState *state, void *Py_UNUSED(ctx), void *p)
     assert(pool->ref.count > 0);            /* else it was empty */
     pymem_block *lastfree = pool->freeblock;
     *(pymem_block **)p = lastfree;
-    pool->freeblock = (pymem_block *)p;
+    pool->freeblock = p;
     pool->ref.count--;
 
     if (UNLIKELY(lastfree == NULL)) {
@@ -1818,7 +2003,7 @@ pymalloc_free(OMState *state, void *Py_UNUSED(ctx), void *p)
          * blocks of the same size class.
          */
         insert_to_usedpool(state, pool);
-        return 1;
+        return;
     }
 
     /* freeblock wasn't NULL, so the pool wasn't full,
@@ -1826,7 +2011,7 @@ pymalloc_free(OMState *state, void *Py_UNUSED(ctx), void *p)
      */
     if (LIKELY(pool->ref.count != 0)) {
         /* pool isn't empty:  leave it in usedpools */
-        return 1;
+        return;
     }
 
     /* Pool is now empty:  unlink from usedpools, and
@@ -1835,10 +2020,60 @@ pymalloc_free(OMState *state, void *Py_UNUSED(ctx), void *p)
      * (being not referenced, they are perhaps paged out).
      */
     insert_to_freepool(state, pool);
+}
+
+/* Free a memory block allocated by pymalloc_alloc().
+   Return 1 if it was freed.
+   Return 0 if the block was not allocated by pymalloc_alloc(). */
+static inline int
+pymalloc_free(OMState *state, void *Py_UNUSED(ctx), void *p)
+{
+    assert(p != NULL);
+
+#ifdef WITH_VALGRIND
+    if (UNLIKELY(running_on_valgrind > 0)) {
+        return 0;
+    }
+#endif
+
+    poolp pool = POOL_ADDR(p);
+    if (UNLIKELY(!address_in_range(state, p, pool))) {
+        return 0;
+    }
+    /* We allocated this address. */
+
+    if (LIKELY(thread_cache_push(state, pool, (pymem_block *)p))) {
+        return 1;
+    }
+    pool_free(state, pool, (pymem_block *)p);
     return 1;
 }
 
 
+void
+_PyObject_ClearThreadCache(PyThreadState *tstate)
+{
+    struct _obmalloc_thread_cache *cache = tstate->obmalloc_cache;
+    if (cache == NULL) {
+        return;
+    }
+    tstate->obmalloc_cache = NULL;
+    OMState *state = cache->state;
+    for (uint size = 0; size < NB_SMALL_SIZE_CLASSES; size++) {
+        pymem_block *bp = cache->blocks[size];
+        while (bp != NULL) {
+            pymem_block *next = *(pymem_block **)bp;
+            pool_free(state, POOL_ADDR(bp), bp);
+            bp = next;
+        }
+        state->cache.cached_blocks -= cache->nblocks[size];
+    }
+    state->cache.hits += cache->hits;
+    state->cache.misses += cache->misses;
+    free(cache);
+}
+
+
 void
 _PyObject_Free(void *ctx, void *p)
 {
@@ -1974,6 +2209,12 @@ _Py_FinalizeAllocatedBlocks(_PyRuntimeState *Py_UNUSED(runtime))
     return;
 }
 
+void
+_PyObject_ClearThreadCache(PyThreadState *Py_UNUSED(tstate))
+{
+    return;
+}
+
 #endif /* WITH_PYMALLOC */
 
 
@@ -2661,6 +2902,7 @@ _PyObject_DebugMallocStats(FILE *out)
     (void)printone(out, "# arenas reclaimed", ntimes_arena_allocated - narenas);
     (void)printone(out, "# arenas highwater mark", narenas_highwater);
     (void)printone(out, "# arenas allocated current", narenas);
+    (void)printone(out, "# pools returned to the OS", npools_purged);
 
     PyOS_snprintf(buf, sizeof(buf),
                   "%zu arenas * %d bytes/arena",
@@ -2683,6 +2925,33 @@ _PyObject_DebugMallocStats(FILE *out)
     (void)printone(out, "Total", total);
     assert(narenas * ARENA_SIZE == total);
 
+    /* The blocks in the caches of the threads are counted above as
+       allocated blocks. */
+    size_t ncaches = 0;
+    size_t hits = state->cache.hits;
+    size_t misses = state->cache.misses;
+    _PyRuntimeState *runtime = &_PyRuntime;
+    HEAD_LOCK(runtime);
+    for (PyInterpreterState *interp = PyInterpreterState_Head();
+         interp != NULL; interp = PyInterpreterState_Next(interp))
+    {
+        for (PyThreadState *t = interp->threads.head; t != NULL; t = t->next) {
+            struct _obmalloc_thread_cache *cache = t->obmalloc_cache;
+            if (cache != NULL && cache->state == state) {
+                ncaches++;
+                hits += cache->hits;
+                misses += cache->misses;
+            }
+        }
+    }
+    HEAD_UNLOCK(runtime);
+    fputc('\n', out);
+    (void)printone(out, "# thread caches", ncaches);
+    (void)printone(out, "# blocks in thread caches",
+                   (size_t)state->cache.cached_blocks);
+    (void)printone(out, "# thread cache hits", hits);
+    (void)printone(out, "# thread cache misses", misses);
+
 #if WITH_PYMALLOC_RADIX_TREE
     fputs("\narena map counts\n", out);
 #ifdef USE_INTERIOR_NODES
@@ -2704,3 +2973,275 @@ _PyObject_DebugMallocStats(FILE *out)
 }
 
 #endif /* #ifdef WITH_PYMALLOC */
+
+
+/*==========================================================================*/
+/* the census of the object allocations */
+
+/* Index of the statistics of the objects that aren't in pymalloc blocks */
+#define CENSUS_LARGE NB_SMALL_SIZE_CLASSES
+
+struct census_class_stats {
+    size_t allocated;
+    size_t freed;
+    /* Sum of the lifetimes of the freed objects */
+    uint64_t lifetime;
+};
+
+struct census_type_stats {
+    struct census_class_stats classes[CENSUS_LARGE + 1];
+};
+
+struct census_sample {
+    struct census_class_stats *stats;
+    uint64_t birth;
+};
+
+static struct _obmalloc_census *
+get_census(PyInterpreterState *interp)
+{
+#ifdef WITH_PYMALLOC
+    if (!has_own_state(interp)) {
+        interp = _PyInterpreterState_Main();
+    }
+#endif
+    return &interp->obmalloc.census;
+}
+
+/* Return the size class of the pymalloc block that holds op,
+   or CENSUS_LARGE. */
+static uint
+census_size_class(PyObject *op)
+{
+#ifdef WITH_PYMALLOC
+    /* The GC header and the padding of the debug hooks come before op,
+       in the same block. */
+    if (_PyMem_PymallocEnabled()) {
+        OMState *state = get_state();
+        poolp pool = POOL_ADDR(op);
+        if (address_in_range(state, op, pool)) {
+            return pool->szidx;
+        }
+    }
+#endif
+    return CENSUS_LARGE;
+}
+
+static Py_ssize_t
+census_next_countdown(struct _obmalloc_census *census)
+{
+    /* xorshift64: vary the distance between two samples around the
+       interval, so that they don't follow the period of a loop. */
+    uint64_t x = census->rng;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    census->rng = x;
+    return 1 + (Py_ssize_t)(x % (uint64_t)(2 * census->interval - 1));
+}
+
+static void
+census_decref_type(void *type)
+{
+    Py_DECREF((PyObject *)type);
+}
+
+static void
+census_clear(struct _obmalloc_census *census)
+{
+    if (census->enabled) {
+        census->enabled = 0;
+        HEAD_LOCK(&_PyRuntime);
+        _PyRuntime.obmalloc.census_active--;
+        HEAD_UNLOCK(&_PyRuntime);
+    }
+    /* Destroying the types table may deallocate objects: detach the tables
+       first. */
+    _Py_hashtable_t *samples = census->samples;
+    _Py_hashtable_t *types = census->types;
+    census->samples = NULL;
+    census->types = NULL;
+    if (samples != NULL) {
+        _Py_hashtable_destroy(samples);
+    }
+    if (types != NULL) {
+        _Py_hashtable_destroy(types);
+    }
+}
+
+int
+_PyObject_StartAllocCensus(Py_ssize_t interval)
+{
+    assert(interval >= 1);
+    struct _obmalloc_census *census = get_census(_PyInterpreterState_GET());
+    census_clear(census);
+
+    _Py_hashtable_allocator_t alloc = {PyMem_RawMalloc, PyMem_RawFree};
+    census->types = _Py_hashtable_new_full(
+        _Py_hashtable_hash_ptr, _Py_hashtable_compare_direct,
+        census_decref_type, PyMem_RawFree, &alloc);
+    census->samples = _Py_hashtable_new_full(
+        _Py_hashtable_hash_ptr, _Py_hashtable_compare_direct,
+        NULL, PyMem_RawFree, &alloc);
+    if (census->types == NULL || census->samples == NULL) {
+        census_clear(census);
+        PyErr_NoMemory();
+        return -1;
+    }
+    census->interval = interval;
+    census->rng = 0x9e3779b97f4a7c15;
+    census->countdown = census_next_countdown(census);
+    census->clock = 0;
+    census->enabled = 1;
+    HEAD_LOCK(&_PyRuntime);
+    _PyRuntime.obmalloc.census_active++;
+    HEAD_UNLOCK(&_PyRuntime);
+    return 0;
+}
+
+void
+_PyObject_StopAllocCensus(void)
+{
+    struct _obmalloc_census *census = get_census(_PyInterpreterState_GET());
+    if (!census->enabled) {
+        return;
+    }
+    census->enabled = 0;
+    HEAD_LOCK(&_PyRuntime);
+    _PyRuntime.obmalloc.census_active--;
+    HEAD_UNLOCK(&_PyRuntime);
+    /* The objects still alive are no longer followed, but the statistics
+       are kept until the next census. */
+    _Py_hashtable_clear(census->samples);
+}
+
+void
+_PyObject_ClearAllocCensus(PyInterpreterState *interp)
+{
+#ifdef WITH_PYMALLOC
+    if (!has_own_state(interp)) {
+        return;
+    }
+#endif
+    census_clear(&interp->obmalloc.census);
+}
+
+void
+_PyObject_AllocCensusNewReference(PyObject *op)
+{
+    struct _obmalloc_census *census = get_census(_PyInterpreterState_GET());
+    if (!census->enabled) {
+        return;
+    }
+    census->clock++;
+    if (census->samples->nentries != 0) {
+        /* Some deallocators skip _Py_Dealloc(): forget the sample of the
+           object that was at this address. */
+        struct census_sample *sample = _Py_hashtable_steal(census->samples,
+                                                           op);
+        PyMem_RawFree(sample);
+    }
+    if (--census->countdown > 0) {
+        return;
+    }
+    census->countdown = census_next_countdown(census);
+
+    PyTypeObject *type = Py_TYPE(op);
+    struct census_type_stats *stats = _Py_hashtable_get(census->types, type);
+    if (stats == NULL) {
+        stats = PyMem_RawCalloc(1, sizeof(*stats));
+        if (stats == NULL) {
+            return;
+        }
+        if (_Py_hashtable_set(census->types, type, stats) < 0) {
+            PyMem_RawFree(stats);
+            return;
+        }
+        Py_INCREF(type);
+    }
+    struct census_class_stats *class_stats =
+        &stats->classes[census_size_class(op)];
+    class_stats->allocated++;
+
+    struct census_sample *sample = PyMem_RawMalloc(sizeof(*sample));
+    if (sample == NULL) {
+        return;
+    }
+    sample->stats = class_stats;
+    sample->birth = census->clock;
+    if (_Py_hashtable_set(census->samples, op, sample) < 0) {
+        PyMem_RawFree(sample);
+    }
+}
+
+void
+_PyObject_AllocCensusDealloc(PyObject *op)
+{
+    struct _obmalloc_census *census = get_census(_PyInterpreterState_GET());
+    if (!census->enabled || census->samples->nentries == 0) {
+        return;
+    }
+    struct census_sample *sample = _Py_hashtable_steal(census->samples, op);
+    if (sample == NULL) {
+        return;
+    }
+    sample->stats->freed++;
+    sample->stats->lifetime += census->clock - sample->birth;
+    PyMem_RawFree(sample);
+}
+
+static int
+census_add_type(_Py_hashtable_t *Py_UNUSED(ht), const void *key,
+                const void *value, void *user_data)
+{
+    PyObject *type = (PyObject *)key;
+    const struct census_type_stats *stats = value;
+    PyObject *list = user_data;
+    for (uint i = 0; i <= CENSUS_LARGE; i++) {
+        const struct census_class_stats *cs = &stats->classes[i];
+        if (cs->allocated == 0) {
+            continue;
+        }
+        PyObject *size;
+        if (i == CENSUS_LARGE) {
+            size = Py_NewRef(Py_None);
+        }
+        else {
+            size = PyLong_FromLong((long)INDEX2SIZE(i));
+        }
+        PyObject *item = Py_BuildValue("(ONnnK)", type, size,
+                                       (Py_ssize_t)cs->allocated,
+                                       (Py_ssize_t)cs->freed,
+                                       (unsigned long long)cs->lifetime);
+        if (item == NULL) {
+            return -1;
+        }
+        int res = PyList_Append(list, item);
+        Py_DECREF(item);
+        if (res < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+PyObject *
+_PyObject_GetAllocCensus(void)
+{
+    struct _obmalloc_census *census = get_census(_PyInterpreterState_GET());
+    PyObject *list = PyList_New(0);
+    if (list == NULL || census->types == NULL) {
+        return list;
+    }
+    /* Don't sample the objects created here: they would change the table
+       that is iterated. */
+    int enabled = census->enabled;
+    census->enabled = 0;
+    int res = _Py_hashtable_foreach(census->types, census_add_type, list);
+    census->enabled = enabled;
+    if (res < 0) {
+        Py_DECREF(list);
+        return NULL;
+    }
+    return list;
+}
@@ -408,7 +408,7 @@ PyObject* _Py_MakeImmutable(PyObject* obj)
             _Py_VPYDBG(" already immutable!\n");
             // Direct access like this is not recommended, but will be removed in the future as
             // this is just for debugging purposes.
-            if(type->ob_base.ob_base.ob_region != _Py_IMMUTABLE){
+            if(!_Py_IsImmutable(type)){
                // Why do we need to handle the type here, surely what ever made this immutable already did that?
                // Log so we can investigate.
                 _Py_VPYDBG("type ");
@@ -221,6 +221,21 @@ set_insert_clean(setentry *table, size_t mask, PyObject *key, Py_hash_t hash)
     entry->hash = hash;
 }
 
+/* Loops which insert keys known to be absent into a table of more than
+   SET_PREFETCH_MINSIZE slots, which likely misses the caches every time,
+   take the keys by batches of SET_BATCH and prefetch the first slot of each
+   before inserting any, so that the misses overlap instead of adding up. */
+#if defined(__GNUC__) || defined(__clang__)
+#  define SET_PREFETCH(p) __builtin_prefetch(p)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  include <xmmintrin.h>          // _mm_prefetch()
+#  define SET_PREFETCH(p) _mm_prefetch((const char *)(p), _MM_HINT_T0)
+#else
+#  define SET_PREFETCH(p) ((void)(p))
+#endif
+#define SET_PREFETCH_MINSIZE (1 << 14)
+#define SET_BATCH 16
+
 /* ======== End logic for probing the hash table ========================== */
 /* ======================================================================== */
 
@@ -879,36 +894,78 @@ set_iter(PySetObject *so)
     return (PyObject *)si;
 }
 
+/* Iterating a keys view iterates the table of its dict, whatever the type of
+   the dict: return that dict, or other itself if it is an exact dict. */
+static PyObject *
+set_dict_of(PyObject *other)
+{
+    if (PyDict_CheckExact(other))
+        return other;
+    if (PyDictKeys_Check(other))
+        return (PyObject *)((_PyDictViewObject *)other)->dv_dict;
+    return NULL;
+}
+
+static int
+set_update_dict(PySetObject *so, PyObject *dict)
+{
+    PyObject *key, *value;
+    Py_ssize_t pos = 0;
+    Py_hash_t hash;
+    Py_ssize_t dictsize = PyDict_GET_SIZE(dict);
+
+    /* Do one big resize at the start, rather than
+    * incrementally resizing as we insert new keys.  Expect
+    * that there will be no (or few) overlapping keys.
+    */
+    if (dictsize < 0)
+        return -1;
+    if ((so->fill + dictsize)*5 >= so->mask*3) {
+        if (set_table_resize(so, (so->used + dictsize)*2) != 0)
+            return -1;
+    }
+    if (so->fill == 0) {
+        /* The keys of a dict are distinct: insert them with their cached
+           hashes without comparing them, which runs no code. */
+        setentry batch[SET_BATCH];
+        size_t mask = (size_t)so->mask;
+        Py_ssize_t i, n;
+        do {
+            for (n = 0; n < SET_BATCH; n++) {
+                if (!_PyDict_Next(dict, &pos, &key, &value, &hash))
+                    break;
+                batch[n].key = key;
+                batch[n].hash = hash;
+                if (mask >= SET_PREFETCH_MINSIZE)
+                    SET_PREFETCH(&so->table[(size_t)hash & mask]);
+            }
+            for (i = 0; i < n; i++) {
+                set_insert_clean(so->table, mask, Py_NewRef(batch[i].key),
+                                 batch[i].hash);
+            }
+            so->fill += n;
+            so->used += n;
+        } while (n == SET_BATCH);
+        return 0;
+    }
+    while (_PyDict_Next(dict, &pos, &key, &value, &hash)) {
+        if (set_add_entry(so, key, hash))
+            return -1;
+    }
+    return 0;
+}
+
 static int
 set_update_internal(PySetObject *so, PyObject *other)
 {
-    PyObject *key, *it;
+    PyObject *key, *it, *dict;
 
     if (PyAnySet_Check(other))
         return set_merge(so, other);
 
-    if (PyDict_CheckExact(other)) {
-        PyObject *value;
-        Py_ssize_t pos = 0;
-        Py_hash_t hash;
-        Py_ssize_t dictsize = PyDict_GET_SIZE(other);
-
-        /* Do one big resize at the start, rather than
-        * incrementally resizing as we insert new keys.  Expect
-        * that there will be no (or few) overlapping keys.
-        */
-        if (dictsize < 0)
-            return -1;
-        if ((so->fill + dictsize)*5 >= so->mask*3) {
-            if (set_table_resize(so, (so->used + dictsize)*2) != 0)
-                return -1;
-        }
-        while (_PyDict_Next(other, &pos, &key, &value, &hash)) {
-            if (set_add_entry(so, key, hash))
-                return -1;
-        }
-        return 0;
-    }
+    dict = set_dict_of(other);
+    if (dict != NULL)
+        return set_update_dict(so, dict);
 
     it = PyObject_GetIter(other);
     if (it == NULL)
@@ -1231,6 +1288,36 @@ set_intersection(PySetObject *so, PyObject *other)
         return (PyObject *)result;
     }
 
+    PyObject *dict = set_dict_of(other);
+    if (dict != NULL) {
+        /* Reuse the hashes the dict caches. */
+        Py_ssize_t pos = 0;
+        PyObject *value;
+
+        while (_PyDict_Next(dict, &pos, &key, &value, &hash)) {
+            Py_INCREF(key);
+            rv = set_contains_entry(so, key, hash);
+            if (rv < 0) {
+                Py_DECREF(result);
+                Py_DECREF(key);
+                return NULL;
+            }
+            if (rv) {
+                if (set_add_entry(result, key, hash)) {
+                    Py_DECREF(result);
+                    Py_DECREF(key);
+                    return NULL;
+                }
+                if (PySet_GET_SIZE(result) >= PySet_GET_SIZE(so)) {
+                    Py_DECREF(key);
+                    break;
+                }
+            }
+            Py_DECREF(key);
+        }
+        return (PyObject *)result;
+    }
+
     it = PyObject_GetIter(other);
     if (it == NULL) {
         Py_DECREF(result);
@@ -1409,6 +1496,8 @@ PyDoc_STRVAR(isdisjoint_doc,
 static int
 set_difference_update_internal(PySetObject *so, PyObject *other)
 {
+    PyObject *dict;
+
     if ((PyObject *)so == other)
         return set_clear_internal(so);
 
@@ -1440,6 +1529,19 @@ set_difference_update_internal(PySetObject *so, PyObject *other)
         }
 
         Py_DECREF(other);
+    } else if ((dict = set_dict_of(other)) != NULL) {
+        PyObject *key, *value;
+        Py_ssize_t pos = 0;
+        Py_hash_t hash;
+
+        while (_PyDict_Next(dict, &pos, &key, &value, &hash)) {
+            Py_INCREF(key);
+            if (set_discard_entry(so, key, hash) < 0) {
+                Py_DECREF(key);
+                return -1;
+            }
+            Py_DECREF(key);
+        }
     } else {
         PyObject *key, *it;
         it = PyObject_GetIter(other);
@@ -1498,7 +1600,7 @@ static PyObject *
 set_difference(PySetObject *so, PyObject *other)
 {
     PyObject *result;
-    PyObject *key;
+    PyObject *key, *dict = NULL;
     Py_hash_t hash;
     setentry *entry;
     Py_ssize_t pos = 0, other_size;
@@ -1507,8 +1609,8 @@ set_difference(PySetObject *so, PyObject *other)
     if (PyAnySet_Check(other)) {
         other_size = PySet_GET_SIZE(other);
     }
-    else if (PyDict_CheckExact(other)) {
-        other_size = PyDict_GET_SIZE(other);
+    else if ((dict = set_dict_of(other)) != NULL) {
+        other_size = PyDict_GET_SIZE(dict);
     }
     else {
         return set_copy_and_difference(so, other);
@@ -1524,12 +1626,12 @@ set_difference(PySetObject *so, PyObject *other)
     if (result == NULL)
         return NULL;
 
-    if (PyDict_CheckExact(other)) {
+    if (dict != NULL) {
         while (set_next(so, &pos, &entry)) {
             key = entry->key;
             hash = entry->hash;
             Py_INCREF(key);
-            rv = _PyDict_Contains_KnownHash(other, key, hash);
+            rv = _PyDict_Contains_KnownHash(dict, key, hash);
             if (rv < 0) {
                 Py_DECREF(result);
                 Py_DECREF(key);
@@ -1629,9 +1731,10 @@ set_symmetric_difference_update(PySetObject *so, PyObject *other)
     if ((PyObject *)so == other)
         return set_clear(so, NULL);
 
-    if (PyDict_CheckExact(other)) {
+    PyObject *dict = set_dict_of(other);
+    if (dict != NULL) {
         PyObject *value;
-        while (_PyDict_Next(other, &pos, &key, &value, &hash)) {
+        while (_PyDict_Next(dict, &pos, &key, &value, &hash)) {
             Py_INCREF(key);
             rv = set_discard_entry(so, key, hash);
             if (rv < 0) {
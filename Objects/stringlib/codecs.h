@@ -19,6 +19,63 @@
 /* 10xxxxxx */
 #define IS_CONTINUATION_BYTE(ch) ((ch) >= 0x80 && (ch) < 0xC0)
 
+/* SSE2, which x86-64 always has, copies runs of ASCII characters 16 at a
+   time. */
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>          // _mm_movemask_epi8()
+#  define UTF8_SSE2
+#endif
+
+/* Index of the lowest set bit of the non-zero unsigned int x. */
+#define UTF8_LOWEST_BIT(x) (_Py_bit_length((x) & (0u - (x))) - 1)
+
+#ifdef UTF8_SSE2
+/* Decode the run of ASCII characters at *inptr, 16 bytes at a time, and
+   return the next free position of the output.  Whole blocks are stored,
+   also past the end of the run: the callers reserve room for as many
+   characters as there are bytes left, and there are at least 16. */
+Py_LOCAL_INLINE(STRINGLIB_CHAR *)
+STRINGLIB(ascii_decode_sse2)(const char **inptr, const char *end,
+                             STRINGLIB_CHAR *p)
+{
+    const char *s = *inptr;
+#if STRINGLIB_SIZEOF_CHAR > 1
+    const __m128i zero = _mm_setzero_si128();
+#endif
+
+    while (end - s >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)s);
+#if STRINGLIB_SIZEOF_CHAR == 1
+        _mm_storeu_si128((__m128i *)p, v);
+#else
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+# if STRINGLIB_SIZEOF_CHAR == 2
+        _mm_storeu_si128((__m128i *)p, lo);
+        _mm_storeu_si128((__m128i *)(p + 8), hi);
+# else
+        _mm_storeu_si128((__m128i *)p, _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(p + 4), _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(p + 8), _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128((__m128i *)(p + 12), _mm_unpackhi_epi16(hi, zero));
+# endif
+#endif
+        unsigned int high = (unsigned int)_mm_movemask_epi8(v);
+        if (high) {
+            int n = UTF8_LOWEST_BIT(high);
+            s += n;
+            p += n;
+            break;
+        }
+        s += 16;
+        p += 16;
+    }
+    *inptr = s;
+    return p;
+}
+#endif
+
 Py_LOCAL_INLINE(Py_UCS4)
 STRINGLIB(utf8_decode)(const char **inptr, const char *end,
                        STRINGLIB_CHAR *dest,
@@ -31,6 +88,22 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
     while (s < end) {
         ch = (unsigned char)*s;
 
+#ifdef UTF8_SSE2
+        /* Only take runs of at least 4 ASCII characters: shorter ones, as
+           between the words of non-Latin text, are faster byte by byte. */
+        if (ch < 0x80 && end - s >= 16) {
+            uint32_t head;
+            memcpy(&head, s, sizeof(head));
+            if (!(head & 0x80808080U)) {
+                p = STRINGLIB(ascii_decode_sse2)(&s, end, p);
+                if (s == end) {
+                    break;
+                }
+                ch = (unsigned char)*s;
+            }
+        }
+#endif
+
         if (ch < 0x80) {
             /* Fast path for runs of ASCII characters. Given that common UTF-8
                input will consist of an overwhelming majority of ASCII
@@ -254,6 +327,54 @@ STRINGLIB(utf8_decode)(const char **inptr, const char *end,
 #undef ASCII_CHAR_MASK
 
 
+#if defined(UTF8_SSE2) && STRINGLIB_SIZEOF_CHAR == 1 \
+    && STRINGLIB_MAX_CHAR > 0x7F
+/* Encode the Latin-1 characters from data[i] to *outptr 16 at a time.
+   Every character is stored as a whole 2-byte word, of which only the
+   length of its encoding is kept: 2 bytes are reserved for each.  Returns
+   the index of the next character to encode. */
+Py_LOCAL_INLINE(Py_ssize_t)
+STRINGLIB(utf8_encode_sse2)(const STRINGLIB_CHAR *data, Py_ssize_t i,
+                            Py_ssize_t size, char **outptr)
+{
+    char *p = *outptr;
+    const __m128i zero = _mm_setzero_si128();
+
+    while (size - i >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(data + i));
+        unsigned int high = (unsigned int)_mm_movemask_epi8(v);
+        if (high == 0) {
+            _mm_storeu_si128((__m128i *)p, v);
+            p += 16;
+            i += 16;
+            continue;
+        }
+        /* The words of 2-byte sequences are 0x80C0 | (ch & 0x3F) << 8
+           | ch >> 6, those of ASCII characters ch itself. */
+        uint16_t words[16];
+        for (int k = 0; k < 2; k++) {
+            __m128i c = k ? _mm_unpackhi_epi8(v, zero)
+                          : _mm_unpacklo_epi8(v, zero);
+            __m128i w2 = _mm_or_si128(
+                _mm_or_si128(_mm_srli_epi16(c, 6),
+                             _mm_set1_epi16((short)0x80C0)),
+                _mm_slli_epi16(_mm_and_si128(c, _mm_set1_epi16(0x3F)), 8));
+            __m128i ascii = _mm_cmplt_epi16(c, _mm_set1_epi16(0x80));
+            _mm_storeu_si128((__m128i *)(words + 8 * k),
+                             _mm_or_si128(_mm_and_si128(ascii, c),
+                                          _mm_andnot_si128(ascii, w2)));
+        }
+        for (int k = 0; k < 16; k++) {
+            memcpy(p, &words[k], 2);
+            p += 1 + ((high >> k) & 1);
+        }
+        i += 16;
+    }
+    *outptr = p;
+    return i;
+}
+#endif
+
 /* UTF-8 encoder specialized for a Unicode kind to avoid the slow
    PyUnicode_READ() macro. Delete some parts of the code depending on the kind:
    UCS-1 strings don't need to handle surrogates for example. */
@@ -293,6 +414,13 @@ STRINGLIB(utf8_encoder)(_PyBytesWriter *writer,
         return NULL;
 
     for (i = 0; i < size;) {
+#if defined(UTF8_SSE2) && STRINGLIB_SIZEOF_CHAR == 1 \
+    && STRINGLIB_MAX_CHAR > 0x7F
+        i = STRINGLIB(utf8_encode_sse2)(data, i, size, &p);
+        if (i == size) {
+            break;
+        }
+#endif
         Py_UCS4 ch = data[i++];
 
         if (ch < 0x80) {
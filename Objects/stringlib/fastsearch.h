@@ -40,6 +40,35 @@
 #define STRINGLIB_BLOOM(mask, ch)     \
     ((mask &  (1UL << ((ch) & (STRINGLIB_BLOOM_WIDTH -1)))))
 
+/* With SSE2, which x86-64 always has, compare 16 bytes of characters at a
+   time.  movemask() sets STRINGLIB_SIZEOF_CHAR bits per equal character:
+   SSE2_LANE_BITS keeps the lowest one. */
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include "pycore_bitutils.h"    // _Py_bit_length()
+#  include <emmintrin.h>          // _mm_movemask_epi8()
+#  define FASTSEARCH_SSE2
+#  define SSE2_LANES (16 / STRINGLIB_SIZEOF_CHAR)
+#  if STRINGLIB_SIZEOF_CHAR == 1
+#    define SSE2_SPLAT(ch) _mm_set1_epi8((char)(ch))
+#    define SSE2_CMPEQ(a, b) _mm_cmpeq_epi8(a, b)
+#    define SSE2_LANE_BITS 0xFFFFu
+#    define SSE2_MAX_NEEDLE 32
+#  elif STRINGLIB_SIZEOF_CHAR == 2
+#    define SSE2_SPLAT(ch) _mm_set1_epi16((short)(ch))
+#    define SSE2_CMPEQ(a, b) _mm_cmpeq_epi16(a, b)
+#    define SSE2_LANE_BITS 0x5555u
+#    define SSE2_MAX_NEEDLE 32
+#  else
+#    define SSE2_SPLAT(ch) _mm_set1_epi32((int)(ch))
+#    define SSE2_CMPEQ(a, b) _mm_cmpeq_epi32(a, b)
+#    define SSE2_LANE_BITS 0x1111u
+#    define SSE2_MAX_NEEDLE 8     // 4 windows at a time only pay off so far
+#  endif
+/* Index of the lowest set bit of the non-zero unsigned int x. */
+#  define SSE2_LOWEST_BIT(x) (_Py_bit_length((x) & (0u - (x))) - 1)
+#endif
+
 #ifdef STRINGLIB_FAST_MEMCHR
 #  define MEMCHR_CUT_OFF 15
 #else
@@ -679,6 +708,74 @@ STRINGLIB(adaptive_find)(const STRINGLIB_CHAR* s, Py_ssize_t n,
 }
 
 
+#ifdef FASTSEARCH_SSE2
+/* Look for a short needle in SSE2_LANES windows of the haystack at a time,
+   only comparing those whose first and last characters match the needle's.
+   Like adaptive_find, switch to the two-way algorithm if too many of them
+   don't match. */
+static Py_ssize_t
+STRINGLIB(sse2_find)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                     const STRINGLIB_CHAR* p, Py_ssize_t m,
+                     Py_ssize_t maxcount, int mode)
+{
+    const Py_ssize_t w = n - m;
+    const __m128i first = SSE2_SPLAT(p[0]);
+    const __m128i last = SSE2_SPLAT(p[m - 1]);
+    Py_ssize_t i = 0, count = 0, hits = 0, res;
+
+    while (w - i >= SSE2_LANES - 1) {
+        __m128i f = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i l = _mm_loadu_si128((const __m128i *)(s + i + m - 1));
+        unsigned int candidates = SSE2_LANE_BITS
+            & (unsigned int)_mm_movemask_epi8(
+                _mm_and_si128(SSE2_CMPEQ(f, first), SSE2_CMPEQ(l, last)));
+        Py_ssize_t next = i + SSE2_LANES;
+        while (candidates) {
+            Py_ssize_t j = i + SSE2_LOWEST_BIT(candidates)
+                               / STRINGLIB_SIZEOF_CHAR;
+            if (memcmp(s + j + 1, p + 1,
+                       (m - 2) * STRINGLIB_SIZEOF_CHAR) == 0) {
+                /* got a match! */
+                if (mode != FAST_COUNT) {
+                    return j;
+                }
+                count++;
+                if (count == maxcount) {
+                    return maxcount;
+                }
+                next = j + m;
+                break;
+            }
+            hits++;
+            candidates &= candidates - 1;
+        }
+        i = next;
+        if (hits > 64 + i / 16 && m >= 6 && w - i > 2000) {
+            if (mode == FAST_SEARCH) {
+                res = STRINGLIB(_two_way_find)(s + i, n - i, p, m);
+                return res == -1 ? -1 : res + i;
+            }
+            else {
+                res = STRINGLIB(_two_way_count)(s + i, n - i, p, m,
+                                                maxcount - count);
+                return res + count;
+            }
+        }
+    }
+    if (i > w) {
+        return mode == FAST_COUNT ? count : -1;
+    }
+    /* the last windows */
+    res = STRINGLIB(default_find)(s + i, n - i, p, m,
+                                  maxcount - count, mode);
+    if (mode == FAST_COUNT) {
+        return res + count;
+    }
+    return res == -1 ? -1 : res + i;
+}
+#endif
+
+
 static Py_ssize_t
 STRINGLIB(default_rfind)(const STRINGLIB_CHAR* s, Py_ssize_t n,
                          const STRINGLIB_CHAR* p, Py_ssize_t m,
@@ -733,8 +830,28 @@ static inline Py_ssize_t
 STRINGLIB(count_char)(const STRINGLIB_CHAR *s, Py_ssize_t n,
                       const STRINGLIB_CHAR p0, Py_ssize_t maxcount)
 {
-    Py_ssize_t i, count = 0;
-    for (i = 0; i < n; i++) {
+    Py_ssize_t i = 0, count = 0;
+#ifdef FASTSEARCH_SSE2
+    /* Every match subtracts -1 from each of its bytes in acc: add them up
+       every 255 blocks at most, before they overflow. */
+    const __m128i needle = SSE2_SPLAT(p0);
+    const __m128i zero = _mm_setzero_si128();
+    while (n - i >= SSE2_LANES) {
+        Py_ssize_t blocks = Py_MIN((n - i) / SSE2_LANES, 255);
+        __m128i acc = zero;
+        for (; blocks > 0; blocks--, i += SSE2_LANES) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+            acc = _mm_sub_epi8(acc, SSE2_CMPEQ(v, needle));
+        }
+        __m128i sums = _mm_sad_epu8(acc, zero);
+        count += (_mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4))
+                 / STRINGLIB_SIZEOF_CHAR;
+        if (count >= maxcount) {
+            return maxcount;
+        }
+    }
+#endif
+    for (; i < n; i++) {
         if (s[i] == p0) {
             count++;
             if (count == maxcount) {
@@ -771,6 +888,11 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
     }
 
     if (mode != FAST_RSEARCH) {
+#ifdef FASTSEARCH_SSE2
+        if (m <= SSE2_MAX_NEEDLE && n - m >= SSE2_LANES - 1) {
+            return STRINGLIB(sse2_find)(s, n, p, m, maxcount, mode);
+        }
+#endif
         if (n < 2500 || (m < 100 && n < 30000) || m < 6) {
             return STRINGLIB(default_find)(s, n, p, m, maxcount, mode);
         }
@@ -802,3 +924,11 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
     }
 }
 
+#ifdef FASTSEARCH_SSE2
+#undef SSE2_LANES
+#undef SSE2_SPLAT
+#undef SSE2_CMPEQ
+#undef SSE2_LANE_BITS
+#undef SSE2_MAX_NEEDLE
+#undef SSE2_LOWEST_BIT
+#endif
@@ -50,6 +50,34 @@
 /* Always force the list to the expected size. */
 #define FIX_PREALLOC_SIZE(list) Py_SET_SIZE(list, count)
 
+#if defined(FASTSEARCH_SSE2) && STRINGLIB_SIZEOF_CHAR == 1
+/* Skip the characters of str[i:str_len] which cannot be whitespace 16 at a
+   time.  Whitespace characters of a 1-byte kind are either at most ' ' or
+   U+0085 or U+00A0: return the index of the first such candidate, which the
+   caller still checks with STRINGLIB_ISSPACE(), or of the last 15 bytes. */
+Py_LOCAL_INLINE(Py_ssize_t)
+STRINGLIB(skip_nonspace)(const STRINGLIB_CHAR* str, Py_ssize_t i,
+                         Py_ssize_t str_len)
+{
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i nel = _mm_set1_epi8((char)0x85);
+    const __m128i nbsp = _mm_set1_epi8((char)0xA0);
+    while (str_len - i >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(str + i));
+        __m128i low = _mm_cmpeq_epi8(_mm_min_epu8(v, space), v);
+        __m128i high = _mm_or_si128(_mm_cmpeq_epi8(v, nel),
+                                    _mm_cmpeq_epi8(v, nbsp));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(
+            _mm_or_si128(low, high));
+        if (mask != 0) {
+            return i + _Py_bit_length(mask & (0u - mask)) - 1;
+        }
+        i += 16;
+    }
+    return i;
+}
+#endif
+
 Py_LOCAL_INLINE(PyObject *)
 STRINGLIB(split_whitespace)(PyObject* str_obj,
                            const STRINGLIB_CHAR* str, Py_ssize_t str_len,
@@ -68,6 +96,9 @@ STRINGLIB(split_whitespace)(PyObject* str_obj,
             i++;
         if (i == str_len) break;
         j = i; i++;
+#if defined(FASTSEARCH_SSE2) && STRINGLIB_SIZEOF_CHAR == 1
+        i = STRINGLIB(skip_nonspace)(str, i, str_len);
+#endif
         while (i < str_len && !STRINGLIB_ISSPACE(str[i]))
             i++;
 #if !STRINGLIB_MUTABLE
@@ -1819,6 +1819,17 @@ subtype_traverse(PyObject *self, visitproc visit, void *arg)
     return 0;
 }
 
+int
+_PyType_HasBuiltinTraverse(PyTypeObject *type)
+{
+    /* subtype_traverse() only reads the slots and the dict of the instance
+       before calling the traverse function of the base */
+    while (type->tp_traverse == subtype_traverse) {
+        type = type->tp_base;
+    }
+    return (type->tp_flags & _Py_TPFLAGS_STATIC_BUILTIN) != 0;
+}
+
 static void
 clear_slots(PyTypeObject *type, PyObject *self)
 {
@@ -4572,6 +4572,15 @@ ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
 {
     const char *p = start;
 
+#ifdef UTF8_SSE2
+    /* See in stringlib/codecs.h: dest has room for the whole input */
+    Py_UCS1 *q = ucs1lib_ascii_decode_sse2(&p, end, dest);
+    while (p < end && !((unsigned char)*p & 0x80)) {
+        *q++ = *p++;
+    }
+    return p - start;
+#else
+
 #if SIZEOF_SIZE_T <= SIZEOF_VOID_P
     assert(_Py_IS_ALIGNED(dest, ALIGNOF_SIZE_T));
     if (_Py_IS_ALIGNED(p, ALIGNOF_SIZE_T)) {
@@ -4619,6 +4628,7 @@ ascii_decode(const char *start, const char *end, Py_UCS1 *dest)
     }
     memcpy(dest, start, p - start);
     return p - start;
+#endif
 }
 
 static PyObject *
@@ -10845,35 +10855,26 @@ PyUnicode_Concat(PyObject *left, PyObject *right)
     return result;
 }
 
-void
-PyUnicode_Append(PyObject **p_left, PyObject *right)
+/* Like PyUnicode_Append(), but on error *p_left is left as it was and -1 is
+   returned.  Both arguments must be str objects. */
+int
+_PyUnicode_AppendNoClear(PyObject **p_left, PyObject *right)
 {
-    PyObject *left, *res;
+    PyObject *left = *p_left, *res;
     Py_UCS4 maxchar, maxchar2;
     Py_ssize_t left_len, right_len, new_len;
 
-    if (p_left == NULL) {
-        if (!PyErr_Occurred())
-            PyErr_BadInternalCall();
-        return;
-    }
-    left = *p_left;
-    if (right == NULL || left == NULL
-        || !PyUnicode_Check(left) || !PyUnicode_Check(right)) {
-        if (!PyErr_Occurred())
-            PyErr_BadInternalCall();
-        goto error;
-    }
+    assert(PyUnicode_Check(left) && PyUnicode_Check(right));
 
     /* Shortcuts */
     PyObject *empty = unicode_get_empty();  // Borrowed reference
     if (left == empty) {
         Py_DECREF(left);
         *p_left = Py_NewRef(right);
-        return;
+        return 0;
     }
     if (right == empty) {
-        return;
+        return 0;
     }
 
     left_len = PyUnicode_GET_LENGTH(left);
@@ -10881,7 +10882,7 @@ PyUnicode_Append(PyObject **p_left, PyObject *right)
     if (left_len > PY_SSIZE_T_MAX - right_len) {
         PyErr_SetString(PyExc_OverflowError,
                         "strings are too large to concat");
-        goto error;
+        return -1;
     }
     new_len = left_len + right_len;
 
@@ -10894,9 +10895,9 @@ PyUnicode_Append(PyObject **p_left, PyObject *right)
            not so different than duplicating the string. */
         && !(PyUnicode_IS_ASCII(left) && !PyUnicode_IS_ASCII(right)))
     {
-        /* append inplace */
+        /* append inplace; on failure unicode_resize() keeps 'left' */
         if (unicode_resize(p_left, new_len) != 0)
-            goto error;
+            return -1;
 
         /* copy 'right' into the newly allocated area of 'left' */
         _PyUnicode_FastCopyCharacters(*p_left, left_len, right, 0, right_len);
@@ -10909,13 +10910,35 @@ PyUnicode_Append(PyObject **p_left, PyObject *right)
         /* Concat the two Unicode strings */
         res = PyUnicode_New(new_len, maxchar);
         if (res == NULL)
-            goto error;
+            return -1;
         _PyUnicode_FastCopyCharacters(res, 0, left, 0, left_len);
         _PyUnicode_FastCopyCharacters(res, left_len, right, 0, right_len);
         Py_DECREF(left);
         *p_left = res;
     }
     assert(_PyUnicode_CheckConsistency(*p_left, 1));
+    return 0;
+}
+
+void
+PyUnicode_Append(PyObject **p_left, PyObject *right)
+{
+    PyObject *left;
+
+    if (p_left == NULL) {
+        if (!PyErr_Occurred())
+            PyErr_BadInternalCall();
+        return;
+    }
+    left = *p_left;
+    if (right == NULL || left == NULL
+        || !PyUnicode_Check(left) || !PyUnicode_Check(right)) {
+        if (!PyErr_Occurred())
+            PyErr_BadInternalCall();
+        goto error;
+    }
+    if (_PyUnicode_AppendNoClear(p_left, right) < 0)
+        goto error;
     return;
 
 error:
@@ -2,6 +2,7 @@
 
 #include "Python.h"
 #include <ctype.h>
+#include "pycore_abstract.h"      // _PyZip_LengthHint()
 #include "pycore_ast.h"           // _PyAST_Validate()
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_compile.h"       // _PyAST_Compile()
@@ -2957,6 +2958,29 @@ zip_next(zipobject *lz)
     return NULL;
 }
 
+/* Return the smallest length hint of the iterators of the zip object self:
+   the number of tuples it will produce if it is not strict, or 0 if one of
+   them has no hint.  Return -1 on error. */
+Py_ssize_t
+_PyZip_LengthHint(PyObject *self)
+{
+    zipobject *lz = (zipobject *)self;
+    Py_ssize_t hint = 0;
+
+    assert(Py_IS_TYPE(self, &PyZip_Type));
+    for (Py_ssize_t i = 0; i < lz->tuplesize; i++) {
+        PyObject *it = PyTuple_GET_ITEM(lz->ittuple, i);
+        Py_ssize_t n = PyObject_LengthHint(it, -1);
+        if (n == -1) {
+            return PyErr_Occurred() ? -1 : 0;
+        }
+        if (i == 0 || n < hint) {
+            hint = n;
+        }
+    }
+    return hint;
+}
+
 static PyObject *
 zip_reduce(zipobject *lz, PyObject *Py_UNUSED(ignored))
 {
@@ -26,6 +26,7 @@
 #include "pycore_sysmodule.h"     // _PySys_Audit()
 #include "pycore_tuple.h"         // _PyTuple_ITEMS()
 #include "pycore_typeobject.h"    // _PySuper_Lookup()
+#include "pycore_unicodeobject.h" // _PyUnicode_AppendNoClear()
 #include "pycore_emscripten_signal.h"  // _Py_CHECK_EMSCRIPTEN_SIGNALS
 
 #include "pycore_dict.h"
@@ -283,6 +284,7 @@ dummy_func(
             BINARY_OP_ADD_INT,
             BINARY_OP_ADD_UNICODE,
             // BINARY_OP_INPLACE_ADD_UNICODE,  // This is an odd duck.
+            BINARY_OP_INPLACE_ADD_UNICODE_STORE,
             BINARY_OP_MULTIPLY_FLOAT,
             BINARY_OP_MULTIPLY_INT,
             BINARY_OP_SUBTRACT_FLOAT,
@@ -372,6 +374,39 @@ dummy_func(
             JUMPBY(INLINE_CACHE_ENTRIES_BINARY_OP + 1);
         }
 
+        // Likewise for `owner.attr += right` and `container[sub] += right`,
+        // where SWAPs and then STORE_ATTR or STORE_SUBSCR follow.
+        inst(BINARY_OP_INPLACE_ADD_UNICODE_STORE, (unused/1, left, right -- res)) {
+            DEOPT_IF(!PyUnicode_CheckExact(left), BINARY_OP);
+            DEOPT_IF(Py_TYPE(right) != Py_TYPE(left), BINARY_OP);
+            STAT_INC(BINARY_OP, hit);
+            /* The store which follows replaces the reference of the owner
+             * or container to `left` with `res`.  When it is their only
+             * other reference and nothing runs in between, take it over
+             * now, leaving the immortal None in its place: PyUnicode_Append
+             * may then extend `left` in place.  If that fails, `left` is
+             * intact and goes back to the holder before the error is raised.
+             */
+            PyObject **slot = held_str_slot(
+                next_instr + INLINE_CACHE_ENTRIES_BINARY_OP,
+                stack_pointer - 2, left);
+            if (slot != NULL) {
+                *slot = Py_None;
+                _Py_DECREF_NO_DEALLOC(left);
+                res = left;
+                if (_PyUnicode_AppendNoClear(&res, right) < 0) {
+                    *slot = res;
+                    res = NULL;
+                }
+            }
+            else {
+                res = PyUnicode_Concat(left, right);
+                _Py_DECREF_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            }
+            _Py_DECREF_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            ERROR_IF(res == NULL, error);
+        }
+
         inst(BINARY_OP_ADD_FLOAT, (unused/1, left, right -- sum)) {
             DEOPT_IF(!PyFloat_CheckExact(left), BINARY_OP);
             DEOPT_IF(Py_TYPE(right) != Py_TYPE(left), BINARY_OP);
@@ -1647,6 +1682,13 @@ dummy_func(
         inst(MAP_ADD, (key, value --)) {
             PyObject *dict = PEEK(oparg + 2);  // key, value are still on the stack
             assert(PyDict_CheckExact(dict));
+            if (oparg > 1 && ((PyDictObject *)dict)->ma_used == 0) {
+                /* First item of a comprehension (oparg is 1 in big dict
+                   displays): presize the dict from the iterator of the
+                   outermost loop, which is just above it on the stack */
+                _PyDict_PresizeFromIterator((PyDictObject *)dict,
+                                            PEEK(oparg + 1), key);
+            }
             /* dict[key] = value */
             // Do not DECREF INPUTS because the function steals the references
             ERROR_IF(_PyDict_SetItem_Take2((PyDictObject *)dict, key, value) != 0, error);
@@ -1822,7 +1864,9 @@ dummy_func(
             assert(tp->tp_flags & Py_TPFLAGS_MANAGED_DICT);
             PyDictOrValues dorv = *_PyObject_DictOrValuesPointer(owner);
             DEOPT_IF(!_PyDictOrValues_IsValues(dorv), LOAD_ATTR);
-            res = _PyDictOrValues_GetValues(dorv)->values[index];
+            PyDictValues *values = _PyDictOrValues_GetValues(dorv);
+            DEOPT_IF(index >= _PyDictValues_Capacity(values), LOAD_ATTR);
+            res = values->values[index];
             DEOPT_IF(res == NULL, LOAD_ATTR);
             STAT_INC(LOAD_ATTR, hit);
             Py_INCREF(res);
@@ -1965,6 +2009,8 @@ dummy_func(
             assert(tp->tp_flags & Py_TPFLAGS_MANAGED_DICT);
             PyDictOrValues dorv = *_PyObject_DictOrValuesPointer(owner);
             DEOPT_IF(!_PyDictOrValues_IsValues(dorv), STORE_ATTR);
+            PyDictValues *values = _PyDictOrValues_GetValues(dorv);
+            DEOPT_IF(index >= _PyDictValues_Capacity(values), STORE_ATTR);
             STAT_INC(STORE_ATTR, hit);
             if (!Py_CHECKWRITE(owner))
             {
@@ -1972,7 +2018,6 @@ dummy_func(
                 Py_DECREF(owner);
                 goto error;
             }
-            PyDictValues *values = _PyDictOrValues_GetValues(dorv);
             PyObject *old_value = values->values[index];
             values->values[index] = value;
             if (old_value == NULL) {
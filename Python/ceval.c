@@ -22,6 +22,7 @@
 #include "pycore_sysmodule.h"     // _PySys_Audit()
 #include "pycore_tuple.h"         // _PyTuple_ITEMS()
 #include "pycore_typeobject.h"    // _PySuper_Lookup()
+#include "pycore_unicodeobject.h" // _PyUnicode_AppendNoClear()
 #include "pycore_emscripten_signal.h"  // _Py_CHECK_EMSCRIPTEN_SIGNALS
 
 #include "pycore_dict.h"
@@ -207,6 +208,8 @@ static PyObject * import_from(PyThreadState *, PyObject *, PyObject *);
 static void format_exc_check_arg(PyThreadState *, PyObject *, const char *, PyObject *);
 static void format_exc_notwriteable(PyThreadState *tstate, PyCodeObject *co, int oparg);
 static void format_exc_unbound(PyThreadState *tstate, PyCodeObject *co, int oparg);
+static PyObject **held_str_slot(_Py_CODEUNIT *next, PyObject **stack,
+                                PyObject *str);
 static int check_args_iterable(PyThreadState *, PyObject *func, PyObject *vararg);
 static int check_except_type_valid(PyThreadState *tstate, PyObject* right);
 static int check_except_star_type_valid(PyThreadState *tstate, PyObject* right);
@@ -2741,6 +2744,102 @@ format_exc_notwriteable(PyThreadState *tstate, PyCodeObject *co, int oparg)
                          NOT_WRITEABLE_ERROR_MSG, name);
 }
 
+/* Return the address where the owner or container below the operands of
+ * BINARY_OP_INPLACE_ADD_UNICODE_STORE holds `str`, its left operand, or
+ * NULL.  `next` is the instruction after the BINARY_OP and `stack` points
+ * just below its operands.  The address is only returned when the store
+ * which follows will overwrite it without running any code: a specialized
+ * STORE_ATTR, or any STORE_SUBSCR into an exact list or str-keyed dict.  The
+ * stack must also hold the only other reference to `str`.
+ */
+static PyObject **
+held_str_slot(_Py_CODEUNIT *next, PyObject **stack, PyObject *str)
+{
+    PyObject **slot;
+
+    if (Py_REFCNT(str) != 2 || next[0].op.code != SWAP) {
+        return NULL;
+    }
+    if (next[0].op.arg == 2) {
+        /* owner.attr += right: SWAP 2; STORE_ATTR */
+        PyObject *owner = stack[-1];
+        _PyAttrCache *cache = (_PyAttrCache *)(next + 2);
+        if (Py_TYPE(owner)->tp_version_tag != read_u32(cache->version)
+            || !Py_CHECKWRITE(owner))
+        {
+            return NULL;
+        }
+        switch (next[1].op.code) {
+            case STORE_ATTR_INSTANCE_VALUE: {
+                PyDictOrValues dorv = *_PyObject_DictOrValuesPointer(owner);
+                if (!_PyDictOrValues_IsValues(dorv)) {
+                    return NULL;
+                }
+                PyDictValues *values = _PyDictOrValues_GetValues(dorv);
+                if (cache->index >= _PyDictValues_Capacity(values)) {
+                    return NULL;
+                }
+                slot = &values->values[cache->index];
+                break;
+            }
+            case STORE_ATTR_SLOT:
+                slot = (PyObject **)((char *)owner + cache->index);
+                break;
+            default:
+                return NULL;
+        }
+    }
+    else {
+        /* container[sub] += right: SWAP 3; SWAP 2; STORE_SUBSCR */
+        PyObject *container = stack[-2];
+        PyObject *sub = stack[-1];
+        if (next[1].op.code != SWAP || !Py_CHECKWRITE(container)) {
+            return NULL;
+        }
+        if (_PyOpcode_Deopt[next[2].op.code] != STORE_SUBSCR) {
+            return NULL;
+        }
+        if (PyList_CheckExact(container)) {
+            if (!PyLong_CheckExact(sub)
+                || !_PyLong_IsCompact((PyLongObject *)sub))
+            {
+                return NULL;
+            }
+            Py_ssize_t index = _PyLong_CompactValue((PyLongObject *)sub);
+            if (index < 0) {
+                index += PyList_GET_SIZE(container);
+            }
+            if (index < 0 || index >= PyList_GET_SIZE(container)) {
+                return NULL;
+            }
+            slot = &((PyListObject *)container)->ob_item[index];
+        }
+        else if (PyDict_CheckExact(container)) {
+            /* Only str keys in a table of str keys: looking them up
+               never calls __eq__(). */
+            PyDictObject *dict = (PyDictObject *)container;
+            Py_ssize_t ix = _PyDictKeys_StringLookup(dict->ma_keys, sub);
+            if (ix < 0) {
+                return NULL;
+            }
+            PyDictUnicodeEntry *ep = DK_UNICODE_ENTRIES(dict->ma_keys) + ix;
+            if (_PyDictEntry_IsImmutable(ep)) {
+                return NULL;
+            }
+            if (dict->ma_values != NULL) {
+                slot = &dict->ma_values->values[ix];
+            }
+            else {
+                slot = &ep->_me_value;
+            }
+        }
+        else {
+            return NULL;
+        }
+    }
+    return *slot == str ? slot : NULL;
+}
+
 static void
 format_exc_unbound(PyThreadState *tstate, PyCodeObject *co, int oparg)
 {
@@ -292,6 +292,162 @@ monitoring_restart_events(PyObject *module, PyObject *Py_UNUSED(ignored))
     return monitoring_restart_events_impl(module);
 }
 
+PyDoc_STRVAR(monitoring_set_event_buffer__doc__,
+"set_event_buffer($module, tool_id, size, flush=None, /)\n"
+"--\n"
+"\n"
+"Buffer the LINE, INSTRUCTION, JUMP and BRANCH events of a tool.\n"
+"\n"
+"Up to size events are stored instead of calling the callbacks registered\n"
+"for them.  When the buffer is full, flush is called with the list of the\n"
+"buffered events, or the oldest event is discarded if flush is None.  A size\n"
+"of zero discards the buffered events and restores the callbacks.");
+
+#define MONITORING_SET_EVENT_BUFFER_METHODDEF    \
+    {"set_event_buffer", _PyCFunction_CAST(monitoring_set_event_buffer), METH_FASTCALL, monitoring_set_event_buffer__doc__},
+
+static PyObject *
+monitoring_set_event_buffer_impl(PyObject *module, int tool_id,
+                                 Py_ssize_t size, PyObject *flush);
+
+static PyObject *
+monitoring_set_event_buffer(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int tool_id;
+    Py_ssize_t size;
+    PyObject *flush = Py_None;
+
+    if (!_PyArg_CheckPositional("set_event_buffer", nargs, 2, 3)) {
+        goto exit;
+    }
+    tool_id = _PyLong_AsInt(args[0]);
+    if (tool_id == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[1]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        size = ival;
+    }
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    flush = args[2];
+skip_optional:
+    return_value = monitoring_set_event_buffer_impl(module, tool_id, size, flush);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(monitoring_drain_event_buffer__doc__,
+"drain_event_buffer($module, tool_id, /)\n"
+"--\n"
+"\n"
+"Remove the buffered events of a tool and return them.\n"
+"\n"
+"The events are returned as a list of (code, offset, event, arg) tuples, in\n"
+"the order they occurred.  arg is the line number for LINE events, the\n"
+"destination offset for JUMP and BRANCH events, and offset otherwise.");
+
+#define MONITORING_DRAIN_EVENT_BUFFER_METHODDEF    \
+    {"drain_event_buffer", (PyCFunction)monitoring_drain_event_buffer, METH_O, monitoring_drain_event_buffer__doc__},
+
+static PyObject *
+monitoring_drain_event_buffer_impl(PyObject *module, int tool_id);
+
+static PyObject *
+monitoring_drain_event_buffer(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int tool_id;
+
+    tool_id = _PyLong_AsInt(arg);
+    if (tool_id == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = monitoring_drain_event_buffer_impl(module, tool_id);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(monitoring_set_record_lines__doc__,
+"set_record_lines($module, tool_id, enabled, /)\n"
+"--\n"
+"\n"
+"Record the lines executed instead of calling the LINE callback of a tool.\n"
+"\n"
+"Each line is recorded once and its LINE event is then disabled for the tool,\n"
+"as if the callback had returned DISABLE.  Disabling recording forgets the\n"
+"recorded lines.");
+
+#define MONITORING_SET_RECORD_LINES_METHODDEF    \
+    {"set_record_lines", _PyCFunction_CAST(monitoring_set_record_lines), METH_FASTCALL, monitoring_set_record_lines__doc__},
+
+static PyObject *
+monitoring_set_record_lines_impl(PyObject *module, int tool_id, int enabled);
+
+static PyObject *
+monitoring_set_record_lines(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    int tool_id;
+    int enabled;
+
+    if (!_PyArg_CheckPositional("set_record_lines", nargs, 2, 2)) {
+        goto exit;
+    }
+    tool_id = _PyLong_AsInt(args[0]);
+    if (tool_id == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    enabled = PyObject_IsTrue(args[1]);
+    if (enabled < 0) {
+        goto exit;
+    }
+    return_value = monitoring_set_record_lines_impl(module, tool_id, enabled);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(monitoring_get_recorded_lines__doc__,
+"get_recorded_lines($module, tool_id, /)\n"
+"--\n"
+"\n"
+"Return a dict mapping code objects to the frozenset of their recorded lines.");
+
+#define MONITORING_GET_RECORDED_LINES_METHODDEF    \
+    {"get_recorded_lines", (PyCFunction)monitoring_get_recorded_lines, METH_O, monitoring_get_recorded_lines__doc__},
+
+static PyObject *
+monitoring_get_recorded_lines_impl(PyObject *module, int tool_id);
+
+static PyObject *
+monitoring_get_recorded_lines(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int tool_id;
+
+    tool_id = _PyLong_AsInt(arg);
+    if (tool_id == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = monitoring_get_recorded_lines_impl(module, tool_id);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(monitoring__all_events__doc__,
 "_all_events($module, /)\n"
 "--\n"
@@ -308,4 +464,4 @@ monitoring__all_events(PyObject *module, PyObject *Py_UNUSED(ignored))
 {
     return monitoring__all_events_impl(module);
 }
-/*[clinic end generated code: output=11cc0803875b3ffa input=a9049054013a1b77]*/
+/*[clinic end generated code: output=d56ad517a6e2d529 input=a9049054013a1b77]*/
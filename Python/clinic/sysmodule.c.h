@@ -821,6 +821,65 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(sys__set_sort_threads__doc__,
+"_set_sort_threads($module, threads, /)\n"
+"--\n"
+"\n"
+"Use threads threads to sort large lists of ints, floats or strs.\n"
+"\n"
+"A value of 1 sorts them with the calling thread only.  Values above 64\n"
+"are taken as 64.");
+
+#define SYS__SET_SORT_THREADS_METHODDEF    \
+    {"_set_sort_threads", (PyCFunction)sys__set_sort_threads, METH_O, sys__set_sort_threads__doc__},
+
+static PyObject *
+sys__set_sort_threads_impl(PyObject *module, int threads);
+
+static PyObject *
+sys__set_sort_threads(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int threads;
+
+    threads = _PyLong_AsInt(arg);
+    if (threads == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = sys__set_sort_threads_impl(module, threads);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(sys__get_sort_threads__doc__,
+"_get_sort_threads($module, /)\n"
+"--\n"
+"\n"
+"Return the number of threads set by sys._set_sort_threads().");
+
+#define SYS__GET_SORT_THREADS_METHODDEF    \
+    {"_get_sort_threads", (PyCFunction)sys__get_sort_threads, METH_NOARGS, sys__get_sort_threads__doc__},
+
+static int
+sys__get_sort_threads_impl(PyObject *module);
+
+static PyObject *
+sys__get_sort_threads(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    int _return_value;
+
+    _return_value = sys__get_sort_threads_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromLong((long)_return_value);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(sys_getrefcount__doc__,
 "getrefcount($module, object, /)\n"
 "--\n"
@@ -1082,6 +1141,124 @@ sys__debugmallocstats(PyObject *module, PyObject *Py_UNUSED(ignored))
     return sys__debugmallocstats_impl(module);
 }
 
+PyDoc_STRVAR(sys__start_alloc_census__doc__,
+"_start_alloc_census($module, /, interval=100)\n"
+"--\n"
+"\n"
+"Start a sampling census of the object allocations.\n"
+"\n"
+"About one object allocation in interval is sampled.  The statistics of\n"
+"the previous census are discarded.");
+
+#define SYS__START_ALLOC_CENSUS_METHODDEF    \
+    {"_start_alloc_census", _PyCFunction_CAST(sys__start_alloc_census), METH_FASTCALL|METH_KEYWORDS, sys__start_alloc_census__doc__},
+
+static PyObject *
+sys__start_alloc_census_impl(PyObject *module, Py_ssize_t interval);
+
+static PyObject *
+sys__start_alloc_census(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(interval), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"interval", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "_start_alloc_census",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    Py_ssize_t interval = 100;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 0, 1, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[0]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        interval = ival;
+    }
+skip_optional_pos:
+    return_value = sys__start_alloc_census_impl(module, interval);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(sys__stop_alloc_census__doc__,
+"_stop_alloc_census($module, /)\n"
+"--\n"
+"\n"
+"Stop the census of the object allocations.\n"
+"\n"
+"Its statistics are kept until the next census starts.");
+
+#define SYS__STOP_ALLOC_CENSUS_METHODDEF    \
+    {"_stop_alloc_census", (PyCFunction)sys__stop_alloc_census, METH_NOARGS, sys__stop_alloc_census__doc__},
+
+static PyObject *
+sys__stop_alloc_census_impl(PyObject *module);
+
+static PyObject *
+sys__stop_alloc_census(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__stop_alloc_census_impl(module);
+}
+
+PyDoc_STRVAR(sys__get_alloc_census__doc__,
+"_get_alloc_census($module, /)\n"
+"--\n"
+"\n"
+"Return the statistics of the census of the object allocations.\n"
+"\n"
+"Return a list of (type, size, allocated, freed, lifetime) tuples.  size is\n"
+"the size of the pymalloc blocks the objects are allocated in, or None for\n"
+"the other objects.  allocated and freed are the numbers of sampled objects\n"
+"allocated, and deallocated since, and lifetime the sum of the lifetimes of\n"
+"the deallocated ones, in number of object allocations.");
+
+#define SYS__GET_ALLOC_CENSUS_METHODDEF    \
+    {"_get_alloc_census", (PyCFunction)sys__get_alloc_census, METH_NOARGS, sys__get_alloc_census__doc__},
+
+static PyObject *
+sys__get_alloc_census_impl(PyObject *module);
+
+static PyObject *
+sys__get_alloc_census(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__get_alloc_census_impl(module);
+}
+
 PyDoc_STRVAR(sys__clear_type_cache__doc__,
 "_clear_type_cache($module, /)\n"
 "--\n"
@@ -1415,4 +1592,4 @@ exit:
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=6d598acc26237fbe input=a9049054013a1b77]*/
+/*[clinic end generated code: output=d86be98ea14eea7f input=a9049054013a1b77]*/
@@ -1957,7 +1957,7 @@ _PyErr_WriteToImmutable(const char* filename, int lineno, PyObject* obj)
     PyThreadState *tstate = _PyThreadState_GET();
     if (!_PyErr_Occurred(tstate)) {
         string = PyUnicode_FromFormat("object of type %s is immutable (in region %" PRIuPTR ") at %s:%d",
-                                      obj->ob_type->tp_name, obj->ob_region, filename, lineno);
+                                      obj->ob_type->tp_name, Py_REGION(obj), filename, lineno);
         if (string != NULL) {
             _PyErr_SetObject(tstate, PyExc_NotWriteableError, string);
             Py_DECREF(string);
@@ -124,12 +124,20 @@ The following implementation-specific options are available:\n\
     able to report Python calls. This option is only available on some platforms and will \n\
     do nothing if is not supported on the current system. The default value is \"off\".\n\
 \n\
+-X perf_jit: activate support for the Linux \"perf\" profiler like -X perf, but\n\
+    describe the trampolines in a jitdump file (/tmp/jit-PID.dump) that can be\n\
+    processed with \"perf inject --jit\". The default value is \"off\".\n\
+\n\
 -X frozen_modules=[on|off]: whether or not frozen modules should be used.\n\
    The default is \"on\" (or \"off\" if you are running a local build).\n\
 \n\
 -X int_max_str_digits=number: limit the size of int<->str conversions.\n\
     This helps avoid denial of service attacks when parsing untrusted data.\n\
-    The default is sys.int_info.default_max_str_digits.  0 disables."
+    The default is sys.int_info.default_max_str_digits.  0 disables.\n\
+\n\
+-X gc_adaptive: adapt the collection thresholds of the young generations of\n\
+    the garbage collector to the survival rate and the cost of their\n\
+    collections. The default value is \"off\"."
 
 #ifdef Py_STATS
 "\n\
@@ -168,6 +176,7 @@ static const char usage_envvars[] =
 "PYTHONBREAKPOINT: if this variable is set to 0, it disables the default\n"
 "   debugger. It can be set to the callable of your debugger of choice.\n"
 "PYTHONDEVMODE: enable the development mode.\n"
+"PYTHONGCADAPTIVE: adapt the thresholds of the garbage collector (-X gc_adaptive).\n"
 "PYTHONPYCACHEPREFIX: root directory for bytecode cache (pyc) files.\n"
 "PYTHONWARNDEFAULTENCODING: enable opt-in EncodingWarning for 'encoding=None'.\n"
 "PYTHONNODEBUGRANGES: If this variable is set, it disables the inclusion of the \n"
@@ -662,6 +671,7 @@ config_check_consistency(const PyConfig *config)
     assert(config->faulthandler >= 0);
     assert(config->tracemalloc >= 0);
     assert(config->import_time >= 0);
+    assert(config->gc_adaptive >= 0);
     assert(config->code_debug_ranges >= 0);
     assert(config->show_ref_count >= 0);
     assert(config->dump_refs >= 0);
@@ -967,6 +977,7 @@ _PyConfig_Copy(PyConfig *config, const PyConfig *config2)
     COPY_ATTR(tracemalloc);
     COPY_ATTR(perf_profiling);
     COPY_ATTR(import_time);
+    COPY_ATTR(gc_adaptive);
     COPY_ATTR(code_debug_ranges);
     COPY_ATTR(show_ref_count);
     COPY_ATTR(dump_refs);
@@ -1078,6 +1089,7 @@ _PyConfig_AsDict(const PyConfig *config)
     SET_ITEM_INT(tracemalloc);
     SET_ITEM_INT(perf_profiling);
     SET_ITEM_INT(import_time);
+    SET_ITEM_INT(gc_adaptive);
     SET_ITEM_INT(code_debug_ranges);
     SET_ITEM_INT(show_ref_count);
     SET_ITEM_INT(dump_refs);
@@ -1366,6 +1378,7 @@ _PyConfig_FromDict(PyConfig *config, PyObject *dict)
     GET_UINT(tracemalloc);
     GET_UINT(perf_profiling);
     GET_UINT(import_time);
+    GET_UINT(gc_adaptive);
     GET_UINT(code_debug_ranges);
     GET_UINT(show_ref_count);
     GET_UINT(dump_refs);
@@ -1735,10 +1748,24 @@ config_init_perf_profiling(PyConfig *config)
             config->perf_profiling = 1;
         }
     }
+    env = config_get_env(config, "PYTHON_PERF_JIT_SUPPORT");
+    if (env) {
+        active = 0;
+        if (_Py_str_to_int(env, &active) != 0) {
+            active = 0;
+        }
+        if (active) {
+            config->perf_profiling = 2;
+        }
+    }
     const wchar_t *xoption = config_get_xoption(config, L"perf");
     if (xoption) {
         config->perf_profiling = 1;
     }
+    xoption = config_get_xoption(config, L"perf_jit");
+    if (xoption) {
+        config->perf_profiling = 2;
+    }
     return _PyStatus_OK();
 
 }
@@ -1877,6 +1904,11 @@ config_read_complex_options(PyConfig *config)
         config->import_time = 1;
     }
 
+    if (config_get_env(config, "PYTHONGCADAPTIVE")
+       || config_get_xoption(config, L"gc_adaptive")) {
+        config->gc_adaptive = 1;
+    }
+
     if (config_get_env(config, "PYTHONNODEBUGRANGES")
        || config_get_xoption(config, L"no_debug_ranges")) {
         config->code_debug_ranges = 0;
@@ -942,6 +942,166 @@ static const char *const event_names [] = {
     [PY_MONITORING_EVENT_STOP_ITERATION] = "STOP_ITERATION",
 };
 
+/* Native consumers */
+
+static inline uint8_t
+get_native_tools(PyInterpreterState *interp, int event)
+{
+    switch (event) {
+        case PY_MONITORING_EVENT_LINE:
+            return interp->monitoring_buffered_tools |
+                   interp->monitoring_recording_tools;
+        case PY_MONITORING_EVENT_INSTRUCTION:
+        case PY_MONITORING_EVENT_JUMP:
+        case PY_MONITORING_EVENT_BRANCH:
+            return interp->monitoring_buffered_tools;
+        default:
+            return 0;
+    }
+}
+
+/* Move the buffered events to a new list of
+ * (code, offset, event, arg) tuples */
+static PyObject *
+drain_buffer(_PyMonitoringConsumer *consumer)
+{
+    PyObject *list = PyList_New(consumer->length);
+    if (list == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < consumer->length; i++) {
+        _PyMonitoringBufferEntry *entry =
+            &consumer->buffer[(consumer->start + i) % consumer->size];
+        PyObject *item = Py_BuildValue("(Oiii)", entry->code, entry->offset,
+                                       1 << entry->event, entry->arg);
+        if (item == NULL) {
+            Py_DECREF(list);
+            return NULL;
+        }
+        PyList_SET_ITEM(list, i, item);
+    }
+    for (Py_ssize_t i = 0; i < consumer->length; i++) {
+        Py_DECREF(consumer->buffer[(consumer->start + i) % consumer->size].code);
+    }
+    consumer->start = 0;
+    consumer->length = 0;
+    return list;
+}
+
+static int
+flush_buffer(PyThreadState *tstate, _PyMonitoringConsumer *consumer)
+{
+    PyObject *events = drain_buffer(consumer);
+    if (events == NULL) {
+        return -1;
+    }
+    PyObject *flush = Py_NewRef(consumer->flush);
+    /* Like callbacks, the flush function does not generate events. */
+    tstate->tracing++;
+    PyObject *res = PyObject_CallOneArg(flush, events);
+    tstate->tracing--;
+    Py_DECREF(flush);
+    Py_DECREF(events);
+    if (res == NULL) {
+        return -1;
+    }
+    Py_DECREF(res);
+    return 0;
+}
+
+static int
+buffer_event(PyThreadState *tstate, int tool, PyCodeObject *code,
+             int offset, int event, int arg)
+{
+    _PyMonitoringConsumer *consumer = tstate->interp->monitoring_consumers[tool];
+    PyCodeObject *overwritten = NULL;
+    if (consumer->length == consumer->size) {
+        if (consumer->flush != NULL) {
+            if (flush_buffer(tstate, consumer) < 0) {
+                return -1;
+            }
+            /* The flush function may have changed the consumer. */
+            consumer = tstate->interp->monitoring_consumers[tool];
+            if (consumer == NULL || consumer->buffer == NULL) {
+                return 0;
+            }
+        }
+        else {
+            overwritten = consumer->buffer[consumer->start].code;
+            consumer->start = (consumer->start + 1) % consumer->size;
+            consumer->length--;
+        }
+    }
+    _PyMonitoringBufferEntry *entry =
+        &consumer->buffer[(consumer->start + consumer->length) % consumer->size];
+    entry->code = (PyCodeObject *)Py_NewRef(code);
+    entry->offset = offset;
+    entry->event = event;
+    entry->arg = arg;
+    consumer->length++;
+    Py_XDECREF(overwritten);
+    return 0;
+}
+
+static int
+record_line(_PyMonitoringConsumer *consumer, PyCodeObject *code, int line)
+{
+    PyObject *lines = PyDict_GetItemWithError(consumer->lines, (PyObject *)code);
+    if (lines == NULL) {
+        if (PyErr_Occurred()) {
+            return -1;
+        }
+        lines = PySet_New(NULL);
+        if (lines == NULL) {
+            return -1;
+        }
+        int err = PyDict_SetItem(consumer->lines, (PyObject *)code, lines);
+        Py_DECREF(lines);
+        if (err < 0) {
+            return -1;
+        }
+    }
+    PyObject *line_obj = PyLong_FromLong(line);
+    if (line_obj == NULL) {
+        return -1;
+    }
+    int err = PySet_Add(lines, line_obj);
+    Py_DECREF(line_obj);
+    return err;
+}
+
+/* Pass the event to the native consumers of *tools*, where *offset* is the
+ * index of the instruction.  Return -1 on error, 0 otherwise. */
+static int
+call_native_consumers(PyThreadState *tstate, uint8_t tools, int event,
+                      PyCodeObject *code, int offset, int arg)
+{
+    PyInterpreterState *interp = tstate->interp;
+    while (tools) {
+        int tool = most_significant_bit(tools);
+        tools &= ~(1 << tool);
+        _PyMonitoringConsumer *consumer = interp->monitoring_consumers[tool];
+        if (consumer == NULL) {
+            /* Removed by the flush function of another tool */
+            continue;
+        }
+        if (event == PY_MONITORING_EVENT_LINE && consumer->lines != NULL) {
+            if (record_line(consumer, code, arg) < 0) {
+                return -1;
+            }
+            /* Each line only needs recording once. */
+            remove_line_tools(code, offset, 1 << tool);
+        }
+        else if (consumer->buffer != NULL) {
+            int bytes_offset = offset * (int)sizeof(_Py_CODEUNIT);
+            if (buffer_event(tstate, tool, code, bytes_offset, event, arg) < 0) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
 static int
 call_instrumentation_vector(
     PyThreadState *tstate, int event,
@@ -959,6 +1119,22 @@ call_instrumentation_vector(
     assert(args[1] == NULL);
     args[1] = (PyObject *)code;
     int offset = (int)(instr - _PyCode_CODE(code));
+    PyInterpreterState *interp = tstate->interp;
+    uint8_t tools = get_tools_for_instruction(code, interp, offset, event);
+    uint8_t native_tools = tools & get_native_tools(interp, event);
+    if (native_tools) {
+        assert(event == PY_MONITORING_EVENT_JUMP ||
+               event == PY_MONITORING_EVENT_BRANCH);
+        int target = _PyLong_AsInt(args[3]);
+        if (call_native_consumers(tstate, native_tools, event,
+                                  code, offset, target) < 0) {
+            return -1;
+        }
+        tools &= ~native_tools;
+        if (tools == 0) {
+            return 0;
+        }
+    }
     /* Offset visible to user should be the offset in bytes, as that is the
      * convention for APIs involving code offsets. */
     int bytes_offset = offset * (int)sizeof(_Py_CODEUNIT);
@@ -968,8 +1144,6 @@ call_instrumentation_vector(
     }
     assert(args[2] == NULL);
     args[2] = offset_obj;
-    PyInterpreterState *interp = tstate->interp;
-    uint8_t tools = get_tools_for_instruction(code, interp, offset, event);
     Py_ssize_t nargsf = nargs | PY_VECTORCALL_ARGUMENTS_OFFSET;
     PyObject **callargs = &args[1];
     int err = 0;
@@ -1141,6 +1315,17 @@ _Py_call_instrumentation_line(PyThreadState *tstate, _PyInterpreterFrame* frame,
         (interp->monitors.tools[PY_MONITORING_EVENT_LINE] |
          code->_co_monitoring->local_monitors.tools[PY_MONITORING_EVENT_LINE]
         );
+    uint8_t native_tools = tools & get_native_tools(interp, PY_MONITORING_EVENT_LINE);
+    if (native_tools) {
+        if (call_native_consumers(tstate, native_tools, PY_MONITORING_EVENT_LINE,
+                                  code, i, line) < 0) {
+            return -1;
+        }
+        tools &= ~native_tools;
+        if (tools == 0) {
+            goto done;
+        }
+    }
     PyObject *line_obj = PyLong_FromSsize_t(line);
     if (line_obj == NULL) {
         return -1;
@@ -1197,6 +1382,17 @@ _Py_call_instrumentation_instruction(PyThreadState *tstate, _PyInterpreterFrame*
          code->_co_monitoring->local_monitors.tools[PY_MONITORING_EVENT_INSTRUCTION]
         );
     int bytes_offset = offset * (int)sizeof(_Py_CODEUNIT);
+    uint8_t native_tools = tools & get_native_tools(interp, PY_MONITORING_EVENT_INSTRUCTION);
+    if (native_tools) {
+        if (call_native_consumers(tstate, native_tools, PY_MONITORING_EVENT_INSTRUCTION,
+                                  code, offset, bytes_offset) < 0) {
+            return -1;
+        }
+        tools &= ~native_tools;
+        if (tools == 0) {
+            return next_opcode;
+        }
+    }
     PyObject *offset_obj = PyLong_FromSsize_t(bytes_offset);
     if (offset_obj == NULL) {
         return -1;
@@ -1781,6 +1977,73 @@ _PyMonitoring_SetLocalEvents(PyCodeObject *code, int tool_id, _PyMonitoringEvent
     return 0;
 }
 
+static _PyMonitoringConsumer *
+get_consumer(PyInterpreterState *interp, int tool_id)
+{
+    _PyMonitoringConsumer *consumer = interp->monitoring_consumers[tool_id];
+    if (consumer == NULL) {
+        consumer = PyMem_Calloc(1, sizeof(_PyMonitoringConsumer));
+        if (consumer == NULL) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+        interp->monitoring_consumers[tool_id] = consumer;
+    }
+    return consumer;
+}
+
+static void
+free_consumer_if_unused(PyInterpreterState *interp, int tool_id)
+{
+    _PyMonitoringConsumer *consumer = interp->monitoring_consumers[tool_id];
+    if (consumer != NULL && consumer->buffer == NULL && consumer->lines == NULL) {
+        interp->monitoring_consumers[tool_id] = NULL;
+        PyMem_Free(consumer);
+    }
+}
+
+static void
+clear_buffer(PyInterpreterState *interp, int tool_id)
+{
+    _PyMonitoringConsumer *consumer = interp->monitoring_consumers[tool_id];
+    if (consumer == NULL || consumer->buffer == NULL) {
+        return;
+    }
+    interp->monitoring_buffered_tools &= ~(1 << tool_id);
+    _PyMonitoringBufferEntry *buffer = consumer->buffer;
+    Py_ssize_t start = consumer->start;
+    Py_ssize_t length = consumer->length;
+    Py_ssize_t size = consumer->size;
+    PyObject *flush = consumer->flush;
+    consumer->buffer = NULL;
+    consumer->size = consumer->start = consumer->length = 0;
+    consumer->flush = NULL;
+    for (Py_ssize_t i = 0; i < length; i++) {
+        Py_DECREF(buffer[(start + i) % size].code);
+    }
+    PyMem_Free(buffer);
+    Py_XDECREF(flush);
+}
+
+static void
+clear_recorded_lines(PyInterpreterState *interp, int tool_id)
+{
+    _PyMonitoringConsumer *consumer = interp->monitoring_consumers[tool_id];
+    if (consumer == NULL) {
+        return;
+    }
+    interp->monitoring_recording_tools &= ~(1 << tool_id);
+    Py_CLEAR(consumer->lines);
+}
+
+void
+_PyMonitoring_ClearConsumer(PyInterpreterState *interp, int tool_id)
+{
+    clear_buffer(interp, tool_id);
+    clear_recorded_lines(interp, tool_id);
+    free_consumer_if_unused(interp, tool_id);
+}
+
 /*[clinic input]
 module monitoring
 [clinic start generated code]*/
@@ -1845,6 +2108,8 @@ monitoring_free_tool_id_impl(PyObject *module, int tool_id)
     }
     PyInterpreterState *interp = _PyInterpreterState_Get();
     Py_CLEAR(interp->monitoring_tool_names[tool_id]);
+    /* The next user of the id doesn't inherit the buffer or lines */
+    _PyMonitoring_ClearConsumer(interp, tool_id);
     Py_RETURN_NONE;
 }
 
@@ -2064,6 +2329,174 @@ monitoring_restart_events_impl(PyObject *module)
     Py_RETURN_NONE;
 }
 
+/*[clinic input]
+monitoring.set_event_buffer
+
+    tool_id: int
+    size: Py_ssize_t
+    flush: object = None
+    /
+
+Buffer the LINE, INSTRUCTION, JUMP and BRANCH events of a tool.
+
+Up to size events are stored instead of calling the callbacks registered
+for them.  When the buffer is full, flush is called with the list of the
+buffered events, or the oldest event is discarded if flush is None.  A size
+of zero discards the buffered events and restores the callbacks.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_set_event_buffer_impl(PyObject *module, int tool_id,
+                                 Py_ssize_t size, PyObject *flush)
+/*[clinic end generated code: output=638587eaa78d955c input=5007a01898ba76fb]*/
+{
+    if (check_valid_tool(tool_id))  {
+        return NULL;
+    }
+    if (size < 0 || size > PY_SSIZE_T_MAX / (Py_ssize_t)sizeof(_PyMonitoringBufferEntry)) {
+        PyErr_Format(PyExc_ValueError, "invalid buffer size %zd", size);
+        return NULL;
+    }
+    if (flush != Py_None && !PyCallable_Check(flush)) {
+        PyErr_SetString(PyExc_TypeError, "flush must be callable or None");
+        return NULL;
+    }
+    PyInterpreterState *interp = _PyInterpreterState_Get();
+    clear_buffer(interp, tool_id);
+    if (size == 0) {
+        free_consumer_if_unused(interp, tool_id);
+        Py_RETURN_NONE;
+    }
+    _PyMonitoringConsumer *consumer = get_consumer(interp, tool_id);
+    if (consumer == NULL) {
+        return NULL;
+    }
+    consumer->buffer = PyMem_New(_PyMonitoringBufferEntry, size);
+    if (consumer->buffer == NULL) {
+        free_consumer_if_unused(interp, tool_id);
+        return PyErr_NoMemory();
+    }
+    consumer->size = size;
+    consumer->flush = flush == Py_None ? NULL : Py_NewRef(flush);
+    interp->monitoring_buffered_tools |= (1 << tool_id);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+monitoring.drain_event_buffer
+
+    tool_id: int
+    /
+
+Remove the buffered events of a tool and return them.
+
+The events are returned as a list of (code, offset, event, arg) tuples, in
+the order they occurred.  arg is the line number for LINE events, the
+destination offset for JUMP and BRANCH events, and offset otherwise.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_drain_event_buffer_impl(PyObject *module, int tool_id)
+/*[clinic end generated code: output=2a50d03e83a39be1 input=33f7d742b837cec7]*/
+{
+    if (check_valid_tool(tool_id))  {
+        return NULL;
+    }
+    PyInterpreterState *interp = _PyInterpreterState_Get();
+    _PyMonitoringConsumer *consumer = interp->monitoring_consumers[tool_id];
+    if (consumer == NULL || consumer->buffer == NULL) {
+        PyErr_Format(PyExc_ValueError, "tool %d has no event buffer", tool_id);
+        return NULL;
+    }
+    return drain_buffer(consumer);
+}
+
+/*[clinic input]
+monitoring.set_record_lines
+
+    tool_id: int
+    enabled: bool
+    /
+
+Record the lines executed instead of calling the LINE callback of a tool.
+
+Each line is recorded once and its LINE event is then disabled for the tool,
+as if the callback had returned DISABLE.  Disabling recording forgets the
+recorded lines.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_set_record_lines_impl(PyObject *module, int tool_id, int enabled)
+/*[clinic end generated code: output=26e35ec21337e020 input=6e0922e18e373d7f]*/
+{
+    if (check_valid_tool(tool_id))  {
+        return NULL;
+    }
+    PyInterpreterState *interp = _PyInterpreterState_Get();
+    if (!enabled) {
+        clear_recorded_lines(interp, tool_id);
+        free_consumer_if_unused(interp, tool_id);
+        Py_RETURN_NONE;
+    }
+    _PyMonitoringConsumer *consumer = get_consumer(interp, tool_id);
+    if (consumer == NULL) {
+        return NULL;
+    }
+    if (consumer->lines == NULL) {
+        consumer->lines = PyDict_New();
+        if (consumer->lines == NULL) {
+            free_consumer_if_unused(interp, tool_id);
+            return NULL;
+        }
+    }
+    interp->monitoring_recording_tools |= (1 << tool_id);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+monitoring.get_recorded_lines
+
+    tool_id: int
+    /
+
+Return a dict mapping code objects to the frozenset of their recorded lines.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_get_recorded_lines_impl(PyObject *module, int tool_id)
+/*[clinic end generated code: output=0d1720334dc04685 input=e638c4defcebdacc]*/
+{
+    if (check_valid_tool(tool_id))  {
+        return NULL;
+    }
+    PyInterpreterState *interp = _PyInterpreterState_Get();
+    _PyMonitoringConsumer *consumer = interp->monitoring_consumers[tool_id];
+    if (consumer == NULL || consumer->lines == NULL) {
+        PyErr_Format(PyExc_ValueError, "tool %d is not recording lines", tool_id);
+        return NULL;
+    }
+    PyObject *res = PyDict_New();
+    if (res == NULL) {
+        return NULL;
+    }
+    Py_ssize_t pos = 0;
+    PyObject *code, *lines;
+    while (PyDict_Next(consumer->lines, &pos, &code, &lines)) {
+        PyObject *frozen = PyFrozenSet_New(lines);
+        if (frozen == NULL) {
+            Py_DECREF(res);
+            return NULL;
+        }
+        int err = PyDict_SetItem(res, code, frozen);
+        Py_DECREF(frozen);
+        if (err < 0) {
+            Py_DECREF(res);
+            return NULL;
+        }
+    }
+    return res;
+}
+
 static int
 add_power2_constant(PyObject *obj, const char *name, int i)
 {
@@ -2116,6 +2549,10 @@ static PyMethodDef methods[] = {
     MONITORING_GET_LOCAL_EVENTS_METHODDEF
     MONITORING_SET_LOCAL_EVENTS_METHODDEF
     MONITORING_RESTART_EVENTS_METHODDEF
+    MONITORING_SET_EVENT_BUFFER_METHODDEF
+    MONITORING_DRAIN_EVENT_BUFFER_METHODDEF
+    MONITORING_SET_RECORD_LINES_METHODDEF
+    MONITORING_GET_RECORDED_LINES_METHODDEF
     MONITORING__ALL_EVENTS_METHODDEF
     {NULL, NULL}  // sentinel
 };
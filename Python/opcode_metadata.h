@@ -67,6 +67,8 @@ _PyOpcode_num_popped(int opcode, int oparg, bool jump) {
             return 2;
         case BINARY_OP_INPLACE_ADD_UNICODE:
             return 2;
+        case BINARY_OP_INPLACE_ADD_UNICODE_STORE:
+            return 2;
         case BINARY_OP_ADD_FLOAT:
             return 2;
         case BINARY_OP_ADD_INT:
@@ -463,6 +465,8 @@ _PyOpcode_num_pushed(int opcode, int oparg, bool jump) {
             return 1;
         case BINARY_OP_INPLACE_ADD_UNICODE:
             return 0;
+        case BINARY_OP_INPLACE_ADD_UNICODE_STORE:
+            return 1;
         case BINARY_OP_ADD_FLOAT:
             return 1;
         case BINARY_OP_ADD_INT:
@@ -834,6 +838,7 @@ const struct opcode_metadata _PyOpcode_opcode_metadata[256] = {
     [BINARY_OP_SUBTRACT_FLOAT] = { true, INSTR_FMT_IXC },
     [BINARY_OP_ADD_UNICODE] = { true, INSTR_FMT_IXC },
     [BINARY_OP_INPLACE_ADD_UNICODE] = { true, INSTR_FMT_IX },
+    [BINARY_OP_INPLACE_ADD_UNICODE_STORE] = { true, INSTR_FMT_IXC },
     [BINARY_OP_ADD_FLOAT] = { true, INSTR_FMT_IXC },
     [BINARY_OP_ADD_INT] = { true, INSTR_FMT_IXC },
     [BINARY_SUBSCR] = { true, INSTR_FMT_IXC },
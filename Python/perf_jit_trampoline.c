@@ -0,0 +1,380 @@
+/*
+
+Perf jitdump support
+====================
+
+This file implements a second backend for the perf trampolines described in
+Python/perf_trampoline.c. Instead of the /tmp/perf-PID.map text file, it
+writes a "jitdump" file, the binary format documented in
+tools/perf/Documentation/jitdump-specification.txt in the Linux sources.
+
+A perf map file only gives a name to an address range. A jitdump file also
+carries a copy of the machine code of every trampoline and a line table for
+it, which "perf inject --jit" turns into one small ELF image per trampoline.
+That makes "perf report" resolve the trampolines the same way as the perf
+map does, and "perf annotate" and "perf report --sort srcline" able to show
+the Python source line where each function is defined:
+
+    $ perf record -k 1 -g --call-graph=fp python -X perf_jit script.py
+    $ perf inject --jit -i perf.data -o perf.jit.data
+    $ perf report -g -i perf.jit.data
+
+The "-k 1" option makes perf use CLOCK_MONOTONIC for its timestamps, which
+is the clock used for the records written here; perf inject needs both to
+agree to order code loads with respect to samples.
+
+perf does not look for the dump file by name. It notices it because the
+profiled process maps the file with PROT_EXEC, which generates an mmap event
+in perf.data pointing at /tmp/jit-PID.dump, so the file stays mapped for as
+long as the backend is active.
+
+Every trampoline is a copy of the same few instructions, so the line table
+has a single entry mapping the trampoline to the first line of its code
+object. Samples taken while a Python function runs still land in
+_PyEval_EvalFrameDefault; the trampoline only identifies which Python
+function is being evaluated by that native frame.
+*/
+
+#include "Python.h"
+#include "pycore_ceval.h"         // _PyPerf_Callbacks
+#include "pycore_frame.h"
+#include "pycore_interp.h"
+
+
+#ifdef PY_HAVE_PERF_TRAMPOLINE
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+#define JITDUMP_MAGIC 0x4A695444  // "JiTD"
+#define JITDUMP_VERSION 1
+
+#if defined(__x86_64__)
+#  define JITDUMP_ELF_MACHINE 62    // EM_X86_64
+#elif defined(__aarch64__)
+#  define JITDUMP_ELF_MACHINE 183   // EM_AARCH64
+#else
+#  define JITDUMP_ELF_MACHINE 0     // EM_NONE
+#endif
+
+enum {
+    JIT_CODE_LOAD = 0,
+    JIT_CODE_DEBUG_INFO = 2,
+};
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t total_size;
+    uint32_t elf_mach;
+    uint32_t pad1;
+    uint32_t pid;
+    uint64_t timestamp;
+    uint64_t flags;
+} jitdump_header;
+
+typedef struct {
+    uint32_t id;
+    uint32_t total_size;
+    uint64_t timestamp;
+} jitdump_record_prefix;
+
+/* Followed by the NUL-terminated function name and the machine code. */
+typedef struct {
+    jitdump_record_prefix prefix;
+    uint32_t pid;
+    uint32_t tid;
+    uint64_t vma;
+    uint64_t code_addr;
+    uint64_t code_size;
+    uint64_t code_index;
+} jitdump_code_load;
+
+/* Followed by nr_entry line table entries. */
+typedef struct {
+    jitdump_record_prefix prefix;
+    uint64_t code_addr;
+    uint64_t nr_entry;
+} jitdump_debug_info;
+
+/* Followed by the NUL-terminated source file name. */
+typedef struct {
+    uint64_t code_addr;
+    uint32_t line;
+    uint32_t discrim;
+} jitdump_debug_entry;
+
+typedef struct {
+    FILE *file;
+    void *mapped;          // PROT_EXEC mapping that announces the file to perf
+    size_t mapped_size;
+    uint64_t code_index;   // Number of JIT_CODE_LOAD records written
+    PyThread_type_lock lock;
+} perf_jit_state;
+
+
+static uint64_t
+jitdump_timestamp(void)
+{
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) {
+        return 0;
+    }
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+static void
+jitdump_filename(char *buf, size_t size, pid_t pid)
+{
+    snprintf(buf, size, "/tmp/jit-%jd.dump", (intmax_t)pid);
+}
+
+static int
+perf_jit_free_state(void *arg)
+{
+    perf_jit_state *state = (perf_jit_state *)arg;
+    if (state == NULL) {
+        return 0;
+    }
+    if (state->mapped != NULL) {
+        munmap(state->mapped, state->mapped_size);
+    }
+    if (state->file != NULL) {
+        fclose(state->file);
+    }
+    if (state->lock != NULL) {
+        PyThread_free_lock(state->lock);
+    }
+    PyMem_RawFree(state);
+    return 0;
+}
+
+static void *
+perf_jit_init_state(void)
+{
+    char filename[100];
+    jitdump_filename(filename, sizeof(filename), getpid());
+
+    perf_jit_state *state = PyMem_RawCalloc(1, sizeof(perf_jit_state));
+    if (state == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    state->lock = PyThread_allocate_lock();
+    if (state->lock == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "can't allocate lock");
+        goto error;
+    }
+    // Use nofollow flag to prevent symlink attacks.
+    int flags = O_RDWR | O_CREAT | O_TRUNC | O_NOFOLLOW;
+#ifdef O_CLOEXEC
+    flags |= O_CLOEXEC;
+#endif
+    int fd = open(filename, flags, 0600);
+    if (fd == -1) {
+        PyErr_SetFromErrnoWithFilename(PyExc_OSError, filename);
+        goto error;
+    }
+    state->mapped_size = sysconf(_SC_PAGESIZE);
+    state->mapped = mmap(NULL, state->mapped_size, PROT_READ | PROT_EXEC,
+                         MAP_PRIVATE, fd, 0);
+    if (state->mapped == MAP_FAILED) {
+        state->mapped = NULL;
+        PyErr_SetFromErrnoWithFilename(PyExc_OSError, filename);
+        close(fd);
+        goto error;
+    }
+    state->file = fdopen(fd, "w");
+    if (state->file == NULL) {
+        PyErr_SetFromErrnoWithFilename(PyExc_OSError, filename);
+        close(fd);
+        goto error;
+    }
+
+    jitdump_header header = {
+        .magic = JITDUMP_MAGIC,
+        .version = JITDUMP_VERSION,
+        .total_size = sizeof(jitdump_header),
+        .elf_mach = JITDUMP_ELF_MACHINE,
+        .pid = (uint32_t)getpid(),
+        .timestamp = jitdump_timestamp(),
+    };
+    if (fwrite(&header, sizeof(header), 1, state->file) != 1 ||
+        fflush(state->file) != 0)
+    {
+        PyErr_SetFromErrnoWithFilename(PyExc_OSError, filename);
+        goto error;
+    }
+    return state;
+
+error:
+    perf_jit_free_state(state);
+    return NULL;
+}
+
+static void
+perf_jit_write_state(void *arg, const void *code_addr,
+                     unsigned int code_size, PyCodeObject *co)
+{
+    perf_jit_state *state = (perf_jit_state *)arg;
+    if (state == NULL || state->file == NULL) {
+        return;
+    }
+    const char *entry = "";
+    if (co->co_qualname != NULL) {
+        entry = PyUnicode_AsUTF8(co->co_qualname);
+    }
+    const char *filename = "";
+    if (co->co_filename != NULL) {
+        filename = PyUnicode_AsUTF8(co->co_filename);
+    }
+    if (entry == NULL || filename == NULL) {
+        PyErr_Clear();
+        return;
+    }
+    size_t name_size = snprintf(NULL, 0, "py::%s:%s", entry, filename) + 1;
+    char *name = PyMem_RawMalloc(name_size);
+    if (name == NULL) {
+        return;
+    }
+    snprintf(name, name_size, "py::%s:%s", entry, filename);
+    size_t filename_size = strlen(filename) + 1;
+    uint64_t timestamp = jitdump_timestamp();
+
+    // The line table must precede the JIT_CODE_LOAD record it describes.
+    jitdump_debug_info debug_info = {
+        .prefix = {
+            .id = JIT_CODE_DEBUG_INFO,
+            .total_size = (uint32_t)(sizeof(jitdump_debug_info) +
+                                     sizeof(jitdump_debug_entry) +
+                                     filename_size),
+            .timestamp = timestamp,
+        },
+        .code_addr = (uintptr_t)code_addr,
+        .nr_entry = 1,
+    };
+    jitdump_debug_entry debug_entry = {
+        .code_addr = (uintptr_t)code_addr,
+        .line = (uint32_t)co->co_firstlineno,
+    };
+    jitdump_code_load code_load = {
+        .prefix = {
+            .id = JIT_CODE_LOAD,
+            .total_size = (uint32_t)(sizeof(jitdump_code_load) +
+                                     name_size + code_size),
+            .timestamp = timestamp,
+        },
+        .pid = (uint32_t)getpid(),
+        .tid = (uint32_t)PyThread_get_thread_native_id(),
+        .vma = (uintptr_t)code_addr,
+        .code_addr = (uintptr_t)code_addr,
+        .code_size = code_size,
+    };
+
+    PyThread_acquire_lock(state->lock, 1);
+    code_load.code_index = state->code_index++;
+    fwrite(&debug_info, sizeof(debug_info), 1, state->file);
+    fwrite(&debug_entry, sizeof(debug_entry), 1, state->file);
+    fwrite(filename, filename_size, 1, state->file);
+    fwrite(&code_load, sizeof(code_load), 1, state->file);
+    fwrite(name, name_size, 1, state->file);
+    fwrite(code_addr, code_size, 1, state->file);
+    fflush(state->file);
+    PyThread_release_lock(state->lock);
+
+    PyMem_RawFree(name);
+}
+
+/* Append the records of the parent's jitdump file to the one of this
+   (forked) process, so that the trampolines inherited from the parent
+   are described without being compiled again. The JIT_CODE_LOAD records
+   are rewritten to belong to this process. */
+int
+_PyPerfJit_CopyParentDump(void *arg, pid_t parent_pid)
+{
+    perf_jit_state *state = (perf_jit_state *)arg;
+    if (state == NULL || state->file == NULL) {
+        return -1;
+    }
+    char filename[100];
+    jitdump_filename(filename, sizeof(filename), parent_pid);
+    FILE *from = fopen(filename, "rb");
+    if (from == NULL) {
+        return -1;
+    }
+
+    int result = -1;
+    char *record = NULL;
+    jitdump_header header;
+    if (fread(&header, sizeof(header), 1, from) != 1 ||
+        header.magic != JITDUMP_MAGIC ||
+        header.total_size < sizeof(header) ||
+        fseek(from, header.total_size, SEEK_SET) != 0)
+    {
+        goto done;
+    }
+
+    uint32_t pid = (uint32_t)getpid();
+    uint32_t tid = (uint32_t)PyThread_get_thread_native_id();
+    size_t capacity = 0;
+    PyThread_acquire_lock(state->lock, 1);
+    while (1) {
+        jitdump_record_prefix prefix;
+        if (fread(&prefix, sizeof(prefix), 1, from) != 1) {
+            // End of the parent's file.
+            result = feof(from) ? 0 : -1;
+            break;
+        }
+        if (prefix.total_size < sizeof(prefix)) {
+            break;
+        }
+        if (prefix.total_size > capacity) {
+            char *resized = PyMem_RawRealloc(record, prefix.total_size);
+            if (resized == NULL) {
+                break;
+            }
+            record = resized;
+            capacity = prefix.total_size;
+        }
+        memcpy(record, &prefix, sizeof(prefix));
+        size_t body_size = prefix.total_size - sizeof(prefix);
+        if (body_size &&
+            fread(record + sizeof(prefix), body_size, 1, from) != 1)
+        {
+            break;
+        }
+        if (prefix.id == JIT_CODE_LOAD &&
+            prefix.total_size >= sizeof(jitdump_code_load))
+        {
+            jitdump_code_load *load = (jitdump_code_load *)record;
+            load->pid = pid;
+            load->tid = tid;
+            load->code_index = state->code_index++;
+        }
+        if (fwrite(record, prefix.total_size, 1, state->file) != 1) {
+            break;
+        }
+    }
+    if (fflush(state->file) != 0) {
+        result = -1;
+    }
+    PyThread_release_lock(state->lock);
+
+done:
+    PyMem_RawFree(record);
+    fclose(from);
+    return result;
+}
+
+_PyPerf_Callbacks _Py_perfmap_jit_callbacks = {
+    &perf_jit_init_state,
+    &perf_jit_write_state,
+    &perf_jit_free_state,
+};
+
+#endif  // PY_HAVE_PERF_TRAMPOLINE
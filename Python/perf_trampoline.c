@@ -192,6 +192,7 @@ typedef struct trampoline_api_st trampoline_api_t;
 #define perf_code_arena _PyRuntime.ceval.perf.code_arena
 #define trampoline_api _PyRuntime.ceval.perf.trampoline_api
 #define perf_map_file _PyRuntime.ceval.perf.map_file
+#define persist_after_fork _PyRuntime.ceval.perf.persist_after_fork
 
 
 static void
@@ -358,6 +359,16 @@ py_trampoline_evaluator(PyThreadState *ts, _PyInterpreterFrame *frame,
     // Something failed, fall back to the default evaluator.
     return _PyEval_EvalFrameDefault(ts, frame, throw);
 }
+
+/* Free the state of the backend with the callbacks that created it */
+static void
+free_trampoline_state(void)
+{
+    if (trampoline_api.state != NULL && trampoline_api.free_state != NULL) {
+        trampoline_api.free_state(trampoline_api.state);
+    }
+    trampoline_api.state = NULL;
+}
 #endif  // PY_HAVE_PERF_TRAMPOLINE
 
 int
@@ -394,10 +405,10 @@ _PyPerfTrampoline_SetCallbacks(_PyPerf_Callbacks *callbacks)
     if (trampoline_api.state) {
         _PyPerfTrampoline_Fini();
     }
+    free_trampoline_state();
     trampoline_api.init_state = callbacks->init_state;
     trampoline_api.write_state = callbacks->write_state;
     trampoline_api.free_state = callbacks->free_state;
-    trampoline_api.state = NULL;
     perf_status = PERF_STATUS_OK;
 #endif
     return 0;
@@ -419,6 +430,12 @@ _PyPerfTrampoline_Init(int activate)
         tstate->interp->eval_frame = NULL;
     }
     else {
+        if (trampoline_api.state == NULL && trampoline_api.init_state != NULL) {
+            trampoline_api.state = trampoline_api.init_state();
+            if (trampoline_api.state == NULL) {
+                return -1;
+            }
+        }
         tstate->interp->eval_frame = py_trampoline_evaluator;
         if (new_code_arena() < 0) {
             return -1;
@@ -442,15 +459,63 @@ _PyPerfTrampoline_Fini(void)
         tstate->interp->eval_frame = NULL;
     }
     free_code_arenas();
+    free_trampoline_state();
     extra_code_index = -1;
 #endif
     return 0;
 }
 
+int
+PyUnstable_PerfTrampoline_SetPersistAfterFork(int enable)
+{
+#ifdef PY_HAVE_PERF_TRAMPOLINE
+    persist_after_fork = enable;
+    return 1;
+#endif
+    return 0;
+}
+
 PyStatus
 _PyPerfTrampoline_AfterFork_Child(void)
 {
 #ifdef PY_HAVE_PERF_TRAMPOLINE
+    if (persist_after_fork && _PyIsPerfTrampolineActive()) {
+        // The code arenas and the trampolines attached to the code objects
+        // were inherited from the parent and are still valid: keep them and
+        // describe them in the files of the child.
+        pid_t parent_pid = getppid();
+        const char *failure = NULL;
+        if (trampoline_api.write_state == _Py_perfmap_jit_callbacks.write_state) {
+            free_trampoline_state();
+            trampoline_api.state = trampoline_api.init_state();
+            if (trampoline_api.state == NULL ||
+                _PyPerfJit_CopyParentDump(trampoline_api.state, parent_pid) < 0)
+            {
+                failure = "jitdump";
+            }
+        }
+        else {
+            char filename[100];
+            snprintf(filename, sizeof(filename), "/tmp/perf-%jd.map",
+                     (intmax_t)parent_pid);
+            PyUnstable_PerfMapState_Fini();
+            if (PyUnstable_CopyPerfMapFile(filename) != 0) {
+                failure = "perf map";
+            }
+        }
+        if (failure == NULL) {
+            return PyStatus_Ok();
+        }
+        // Profiling must not take down the child: start afresh, as without
+        // persist_after_fork.
+        if (PyErr_WarnFormat(PyExc_RuntimeWarning, 1,
+                             "cannot copy the %s file of the parent process; "
+                             "the trampolines are restarted in the child",
+                             failure) < 0)
+        {
+            PyErr_WriteUnraisable(NULL);
+        }
+    }
     // Restart trampoline in file in child.
     int was_active = _PyIsPerfTrampolineActive();
     _PyPerfTrampoline_Fini();
@@ -687,7 +687,10 @@ init_interpreter(PyInterpreterState *interp,
             interp->monitoring_callables[t][e] = NULL;
 
         }
+        interp->monitoring_consumers[t] = NULL;
     }
+    interp->monitoring_buffered_tools = 0;
+    interp->monitoring_recording_tools = 0;
     interp->sys_profile_initialized = false;
     interp->sys_trace_initialized = false;
     if (interp != &runtime->_main_interpreter) {
@@ -804,6 +807,8 @@ interpreter_clear(PyInterpreterState *interp, PyThreadState *tstate)
         _PyErr_Clear(tstate);
     }
 
+    _PyObject_ClearAllocCensus(interp);
+
     // Clear the current/main thread state last.
     HEAD_LOCK(runtime);
     PyThreadState *p = interp->threads.head;
@@ -845,6 +850,7 @@ interpreter_clear(PyInterpreterState *interp, PyThreadState *tstate)
     interp->sys_trace_initialized = false;
     for (int t = 0; t < PY_MONITORING_TOOL_IDS; t++) {
         Py_CLEAR(interp->monitoring_tool_names[t]);
+        _PyMonitoring_ClearConsumer(interp, t);
     }
 
     PyConfig_Clear(&interp->config);
@@ -891,6 +897,9 @@ interpreter_clear(PyInterpreterState *interp, PyThreadState *tstate)
         /* We are now safe to fix tstate->_status.cleared. */
         // XXX Do this (much) earlier?
         tstate->_status.cleared = 1;
+
+        /* The thread kept allocating after PyThreadState_Clear() */
+        _PyObject_ClearThreadCache(tstate);
     }
 
     for (int i=0; i < DICT_MAX_WATCHERS; i++) {
@@ -1506,6 +1515,9 @@ PyThreadState_Clear(PyThreadState *tstate)
 
     tstate->_status.cleared = 1;
 
+    /* After the cleared flag, so that the thread doesn't start another */
+    _PyObject_ClearThreadCache(tstate);
+
     // XXX Call _PyThreadStateSwap(runtime, NULL) here if "current".
     // XXX Do it as early in the function as possible.
 }
@@ -1899,6 +1899,22 @@ binary_op_fail_kind(int oparg, PyObject *lhs, PyObject *rhs)
 }
 #endif
 
+/* Do the instructions at next store the result of an augmented assignment
+   back into the attribute or the item its left operand was loaded from? */
+static bool
+stores_back(_Py_CODEUNIT *next)
+{
+    if (next[0].op.code != SWAP) {
+        return false;
+    }
+    if (next[0].op.arg == 2) {
+        return _PyOpcode_Deopt[next[1].op.code] == STORE_ATTR;
+    }
+    return next[0].op.arg == 3 &&
+           next[1].op.code == SWAP && next[1].op.arg == 2 &&
+           _PyOpcode_Deopt[next[2].op.code] == STORE_SUBSCR;
+}
+
 void
 _Py_Specialize_BinaryOp(PyObject *lhs, PyObject *rhs, _Py_CODEUNIT *instr,
                         int oparg, PyObject **locals)
@@ -1920,6 +1936,12 @@ _Py_Specialize_BinaryOp(PyObject *lhs, PyObject *rhs, _Py_CODEUNIT *instr,
                     instr->op.code = BINARY_OP_INPLACE_ADD_UNICODE;
                     goto success;
                 }
+                if (oparg == NB_INPLACE_ADD &&
+                    stores_back(instr + INLINE_CACHE_ENTRIES_BINARY_OP + 1))
+                {
+                    instr->op.code = BINARY_OP_INPLACE_ADD_UNICODE_STORE;
+                    goto success;
+                }
                 instr->op.code = BINARY_OP_ADD_UNICODE;
                 goto success;
             }
@@ -62,6 +62,7 @@ static const char* _Py_stdlib_module_names[] = {
 "_pylong",
 "_queue",
 "_random",
+"_sampleprof",
 "_scproxy",
 "_sha1",
 "_sha2",
@@ -229,6 +230,7 @@ static const char* _Py_stdlib_module_names[] = {
 "resource",
 "rlcompleter",
 "runpy",
+"sampleprof",
 "sched",
 "secrets",
 "select",
@@ -1772,6 +1772,45 @@ sys_set_int_max_str_digits_impl(PyObject *module, int maxdigits)
     }
 }
 
+/*[clinic input]
+sys._set_sort_threads
+
+    threads: int
+    /
+
+Use threads threads to sort large lists of ints, floats or strs.
+
+A value of 1 sorts them with the calling thread only.  Values above 64
+are taken as 64.
+[clinic start generated code]*/
+
+static PyObject *
+sys__set_sort_threads_impl(PyObject *module, int threads)
+/*[clinic end generated code: output=3db022043db746ef input=a322d8a8fb148c14]*/
+{
+    if (threads < 1) {
+        PyErr_SetString(PyExc_ValueError, "threads must be at least 1");
+        return NULL;
+    }
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    interp->list.sort_threads = Py_MIN(threads, _PyList_MAX_SORT_THREADS);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+sys._get_sort_threads -> int
+
+Return the number of threads set by sys._set_sort_threads().
+[clinic start generated code]*/
+
+static int
+sys__get_sort_threads_impl(PyObject *module)
+/*[clinic end generated code: output=b9b8459798d0a584 input=a29e7a9476bc8d47]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    return Py_MAX(interp->list.sort_threads, 1);
+}
+
 size_t
 _PySys_GetSizeOf(PyObject *o)
 {
@@ -2038,6 +2077,66 @@ sys__debugmallocstats_impl(PyObject *module)
     Py_RETURN_NONE;
 }
 
+/*[clinic input]
+sys._start_alloc_census
+
+    interval: Py_ssize_t = 100
+
+Start a sampling census of the object allocations.
+
+About one object allocation in interval is sampled.  The statistics of
+the previous census are discarded.
+[clinic start generated code]*/
+
+static PyObject *
+sys__start_alloc_census_impl(PyObject *module, Py_ssize_t interval)
+/*[clinic end generated code: output=a6dba5a239050c49 input=c082eff3d6f31247]*/
+{
+    if (interval < 1) {
+        PyErr_SetString(PyExc_ValueError, "interval must be positive");
+        return NULL;
+    }
+    if (_PyObject_StartAllocCensus(interval) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+sys._stop_alloc_census
+
+Stop the census of the object allocations.
+
+Its statistics are kept until the next census starts.
+[clinic start generated code]*/
+
+static PyObject *
+sys__stop_alloc_census_impl(PyObject *module)
+/*[clinic end generated code: output=61ddccac6af28de3 input=a0427bef10d25c42]*/
+{
+    _PyObject_StopAllocCensus();
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+sys._get_alloc_census
+
+Return the statistics of the census of the object allocations.
+
+Return a list of (type, size, allocated, freed, lifetime) tuples.  size is
+the size of the pymalloc blocks the objects are allocated in, or None for
+the other objects.  allocated and freed are the numbers of sampled objects
+allocated, and deallocated since, and lifetime the sum of the lifetimes of
+the deallocated ones, in number of object allocations.
+[clinic start generated code]*/
+
+static PyObject *
+sys__get_alloc_census_impl(PyObject *module)
+/*[clinic end generated code: output=fd94f724a9d2eabd input=94b585c88c516ded]*/
+{
+    return _PyObject_GetAllocCensus();
+}
+
 #ifdef Py_TRACE_REFS
 /* Defined in objects.c because it uses static globals in that file */
 extern PyObject *_Py_GetObjects(PyObject *, PyObject *);
@@ -2177,6 +2276,16 @@ sys_activate_stack_trampoline_impl(PyObject *module, const char *backend)
             }
         }
     }
+    else if (strcmp(backend, "perf_jit") == 0) {
+        _PyPerf_Callbacks cur_cb;
+        _PyPerfTrampoline_GetCallbacks(&cur_cb);
+        if (cur_cb.write_state != _Py_perfmap_jit_callbacks.write_state) {
+            if (_PyPerfTrampoline_SetCallbacks(&_Py_perfmap_jit_callbacks) < 0 ) {
+                PyErr_SetString(PyExc_ValueError, "can't activate perf jit trampoline");
+                return NULL;
+            }
+        }
+    }
     else {
         PyErr_Format(PyExc_ValueError, "invalid backend: %s", backend);
         return NULL;
@@ -2338,6 +2447,46 @@ PyAPI_FUNC(void) PyUnstable_PerfMapState_Fini(void) {
 #endif
 }
 
+PyAPI_FUNC(int) PyUnstable_CopyPerfMapFile(const char *parent_filename) {
+#ifndef MS_WINDOWS
+    if (perf_map_state.perf_map == NULL) {
+        int ret = PyUnstable_PerfMapState_Init();
+        if (ret != 0) {
+            return ret;
+        }
+    }
+    FILE *from = fopen(parent_filename, "r");
+    if (from == NULL) {
+        return -1;
+    }
+    char buf[4096];
+    int result = 0;
+    PyThread_acquire_lock(perf_map_state.map_lock, 1);
+    while (1) {
+        size_t bytes_read = fread(buf, 1, sizeof(buf), from);
+        size_t bytes_written = fwrite(buf, 1, bytes_read,
+                                      perf_map_state.perf_map);
+        if (bytes_written < bytes_read) {
+            result = -1;
+            break;
+        }
+        if (bytes_read < sizeof(buf)) {
+            if (ferror(from)) {
+                result = -1;
+            }
+            break;
+        }
+    }
+    if (fflush(perf_map_state.perf_map) != 0) {
+        result = -1;
+    }
+    PyThread_release_lock(perf_map_state.map_lock);
+    fclose(from);
+    return result;
+#endif
+    return 0;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -2390,6 +2539,9 @@ static PyMethodDef sys_methods[] = {
     SYS_GETTRACE_METHODDEF
     SYS_CALL_TRACING_METHODDEF
     SYS__DEBUGMALLOCSTATS_METHODDEF
+    SYS__START_ALLOC_CENSUS_METHODDEF
+    SYS__STOP_ALLOC_CENSUS_METHODDEF
+    SYS__GET_ALLOC_CENSUS_METHODDEF
     SYS_SET_COROUTINE_ORIGIN_TRACKING_DEPTH_METHODDEF
     SYS_GET_COROUTINE_ORIGIN_TRACKING_DEPTH_METHODDEF
     {"set_asyncgen_hooks", _PyCFunction_CAST(sys_set_asyncgen_hooks),
@@ -2402,6 +2554,8 @@ static PyMethodDef sys_methods[] = {
     SYS_UNRAISABLEHOOK_METHODDEF
     SYS_GET_INT_MAX_STR_DIGITS_METHODDEF
     SYS_SET_INT_MAX_STR_DIGITS_METHODDEF
+    SYS__GET_SORT_THREADS_METHODDEF
+    SYS__SET_SORT_THREADS_METHODDEF
 #ifdef Py_STATS
     SYS__STATS_ON_METHODDEF
     SYS__STATS_OFF_METHODDEF
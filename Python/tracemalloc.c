@@ -9,6 +9,7 @@
 #include <pycore_frame.h>
 #include "frameobject.h"          // _PyInterpreterFrame_GetLine
 
+#include <math.h>                 // log()
 #include <stdlib.h>               // malloc()
 
 #define tracemalloc_config _PyRuntime.tracemalloc.config
@@ -77,6 +78,12 @@ typedef struct {
 #define tracemalloc_tracebacks _PyRuntime.tracemalloc.tracebacks
 #define tracemalloc_traces _PyRuntime.tracemalloc.traces
 #define tracemalloc_domains _PyRuntime.tracemalloc.domains
+#define tracemalloc_bytes_until_sample _PyRuntime.tracemalloc.bytes_until_sample
+#define tracemalloc_sampling_rng _PyRuntime.tracemalloc.sampling_rng
+#define tracemalloc_sampled_filter _PyRuntime.tracemalloc.sampled_filter
+
+#define SAMPLED_FILTER_BITS 16
+#define SAMPLED_FILTER_SIZE (1 << SAMPLED_FILTER_BITS)
 
 
 #ifdef TRACE_DEBUG
@@ -437,6 +444,41 @@ tracemalloc_get_traces_table(unsigned int domain)
 }
 
 
+/* When sampling, most freed memory blocks are not traced.  The counting
+   filter tells which addresses may be traced without taking the tables
+   lock: its counters are only zero if no traced block hashes to them.
+   Saturated counters are never decremented. */
+static inline uint8_t *
+sampled_filter_counter(uintptr_t ptr)
+{
+    uint64_t h = (uint64_t)ptr * UINT64_C(0x9E3779B97F4A7C15);
+    return &tracemalloc_sampled_filter[h >> (64 - SAMPLED_FILTER_BITS)];
+}
+
+static inline void
+sampled_filter_add(unsigned int domain, uintptr_t ptr)
+{
+    if (tracemalloc_sampled_filter != NULL && domain == DEFAULT_DOMAIN) {
+        uint8_t *counter = sampled_filter_counter(ptr);
+        if (*counter != UINT8_MAX) {
+            (*counter)++;
+        }
+    }
+}
+
+static inline void
+sampled_filter_remove(unsigned int domain, uintptr_t ptr)
+{
+    if (tracemalloc_sampled_filter != NULL && domain == DEFAULT_DOMAIN) {
+        uint8_t *counter = sampled_filter_counter(ptr);
+        assert(*counter != 0);
+        if (*counter != UINT8_MAX) {
+            (*counter)--;
+        }
+    }
+}
+
+
 static void
 tracemalloc_remove_trace(unsigned int domain, uintptr_t ptr)
 {
@@ -451,6 +493,7 @@ tracemalloc_remove_trace(unsigned int domain, uintptr_t ptr)
     if (!trace) {
         return;
     }
+    sampled_filter_remove(domain, ptr);
     assert(tracemalloc_traced_memory >= trace->size);
     tracemalloc_traced_memory -= trace->size;
     raw_free(trace);
@@ -506,6 +549,7 @@ tracemalloc_add_trace(unsigned int domain, uintptr_t ptr,
             raw_free(trace);
             return res;
         }
+        sampled_filter_add(domain, ptr);
     }
 
     assert(tracemalloc_traced_memory <= SIZE_MAX - size);
@@ -520,6 +564,72 @@ tracemalloc_add_trace(unsigned int domain, uintptr_t ptr,
             tracemalloc_add_trace(DEFAULT_DOMAIN, (uintptr_t)(ptr), size)
 
 
+/* Sampling.
+
+   With a non-zero sampling_interval, the bytes allocated are sampled by a
+   Poisson process, as done by the heap profilers of tcmalloc and jemalloc:
+   the distance in bytes between two samples follows an exponential
+   distribution of mean sampling_interval, and a memory block is traced if
+   a sample falls into it.  Most allocations only decrement a counter and
+   neither compute a traceback nor touch the traces table.
+
+   A block of size bytes is traced with probability
+   p = 1 - exp(-size / sampling_interval).  Its trace records size / p bytes
+   instead of size, which makes the sum of the traced sizes an unbiased
+   estimate of the memory allocated. */
+
+static uint64_t
+sampling_random(void)
+{
+    /* xorshift64* */
+    uint64_t x = tracemalloc_sampling_rng;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    tracemalloc_sampling_rng = x;
+    return x * UINT64_C(0x2545F4914F6CDD1D);
+}
+
+/* Draw the number of bytes until the next sample. */
+static size_t
+sampling_next_interval(void)
+{
+    /* u is uniform in (0, 1] */
+    double u = ((double)(sampling_random() >> 11) + 1.0) / 9007199254740992.0;
+    double bytes = -log(u) * (double)tracemalloc_config.sampling_interval;
+    if (bytes >= (double)(SIZE_MAX / 2)) {
+        return SIZE_MAX / 2;
+    }
+    return (size_t)bytes + 1;
+}
+
+/* Return the size to record in the trace of a new memory block of size
+   bytes, or 0 if the memory block must not be traced.
+   The GIL must be held. */
+static size_t
+sampling_trace_size(size_t size)
+{
+    if (tracemalloc_config.sampling_interval == 0) {
+        return size;
+    }
+    if (size < tracemalloc_bytes_until_sample) {
+        tracemalloc_bytes_until_sample -= size;
+        return 0;
+    }
+    /* The distribution is memoryless: the next interval can start at the
+       end of this memory block. */
+    tracemalloc_bytes_until_sample = sampling_next_interval();
+
+    double interval = (double)tracemalloc_config.sampling_interval;
+    double p = -expm1(-(double)size / interval);
+    double estimate = (double)size / p;
+    if (estimate >= (double)(SIZE_MAX / 2)) {
+        return size;
+    }
+    return Py_MAX((size_t)estimate, size);
+}
+
+
 static void*
 tracemalloc_alloc(int use_calloc, void *ctx, size_t nelem, size_t elsize)
 {
@@ -535,8 +645,13 @@ tracemalloc_alloc(int use_calloc, void *ctx, size_t nelem, size_t elsize)
     if (ptr == NULL)
         return NULL;
 
+    size_t trace_size = sampling_trace_size(nelem * elsize);
+    if (trace_size == 0) {
+        return ptr;
+    }
+
     TABLES_LOCK();
-    if (ADD_TRACE(ptr, nelem * elsize) < 0) {
+    if (ADD_TRACE(ptr, trace_size) < 0) {
         /* Failed to allocate a trace for the new memory block */
         TABLES_UNLOCK();
         alloc->free(alloc->ctx, ptr);
@@ -557,6 +672,9 @@ tracemalloc_realloc(void *ctx, void *ptr, size_t new_size)
     if (ptr2 == NULL)
         return NULL;
 
+    /* A resized memory block is sampled like a new one */
+    size_t trace_size = sampling_trace_size(new_size);
+
     if (ptr != NULL) {
         /* an existing memory block has been resized */
 
@@ -564,11 +682,15 @@ tracemalloc_realloc(void *ctx, void *ptr, size_t new_size)
 
         /* tracemalloc_add_trace() updates the trace if there is already
            a trace at address ptr2 */
-        if (ptr2 != ptr) {
+        if (ptr2 != ptr || trace_size == 0) {
             REMOVE_TRACE(ptr);
         }
+        if (trace_size == 0) {
+            TABLES_UNLOCK();
+            return ptr2;
+        }
 
-        if (ADD_TRACE(ptr2, new_size) < 0) {
+        if (ADD_TRACE(ptr2, trace_size) < 0) {
             /* Memory allocation failed. The error cannot be reported to
                the caller, because realloc() may already have shrunk the
                memory block and so removed bytes.
@@ -584,9 +706,12 @@ tracemalloc_realloc(void *ctx, void *ptr, size_t new_size)
     }
     else {
         /* new allocation */
+        if (trace_size == 0) {
+            return ptr2;
+        }
 
         TABLES_LOCK();
-        if (ADD_TRACE(ptr2, new_size) < 0) {
+        if (ADD_TRACE(ptr2, trace_size) < 0) {
             /* Failed to allocate a trace for the new memory block */
             TABLES_UNLOCK();
             alloc->free(alloc->ctx, ptr2);
@@ -611,6 +736,14 @@ tracemalloc_free(void *ctx, void *ptr)
 
     alloc->free(alloc->ctx, ptr);
 
+    /* A block that was traced when the caller got it still has a non-zero
+       counter: only traces of other blocks can change concurrently. */
+    if (tracemalloc_sampled_filter != NULL
+        && *sampled_filter_counter((uintptr_t)ptr) == 0)
+    {
+        return;
+    }
+
     TABLES_LOCK();
     REMOVE_TRACE(ptr);
     TABLES_UNLOCK();
@@ -785,6 +918,9 @@ tracemalloc_clear_traces(void)
     TABLES_LOCK();
     _Py_hashtable_clear(tracemalloc_traces);
     _Py_hashtable_clear(tracemalloc_domains);
+    if (tracemalloc_sampled_filter != NULL) {
+        memset(tracemalloc_sampled_filter, 0, SAMPLED_FILTER_SIZE);
+    }
     tracemalloc_traced_memory = 0;
     tracemalloc_peak_traced_memory = 0;
     TABLES_UNLOCK();
@@ -889,6 +1025,13 @@ tracemalloc_deinit(void)
 
 int
 _PyTraceMalloc_Start(int max_nframe)
+{
+    return _PyTraceMalloc_StartSampling(max_nframe, 0);
+}
+
+
+int
+_PyTraceMalloc_StartSampling(int max_nframe, size_t sampling_interval)
 {
     PyMemAllocatorEx alloc;
     size_t size;
@@ -910,6 +1053,7 @@ _PyTraceMalloc_Start(int max_nframe)
     }
 
     tracemalloc_config.max_nframe = max_nframe;
+    tracemalloc_config.sampling_interval = sampling_interval;
 
     /* allocate a buffer to store a new traceback */
     size = TRACEBACK_SIZE(max_nframe);
@@ -920,6 +1064,22 @@ _PyTraceMalloc_Start(int max_nframe)
         return -1;
     }
 
+    if (sampling_interval) {
+        assert(tracemalloc_sampled_filter == NULL);
+        tracemalloc_sampled_filter = raw_malloc(SAMPLED_FILTER_SIZE);
+        if (tracemalloc_sampled_filter == NULL) {
+            raw_free(tracemalloc_traceback);
+            tracemalloc_traceback = NULL;
+            PyErr_NoMemory();
+            return -1;
+        }
+        memset(tracemalloc_sampled_filter, 0, SAMPLED_FILTER_SIZE);
+        /* The seed only needs to differ between runs; it must not be 0. */
+        tracemalloc_sampling_rng = ((uint64_t)_PyTime_GetPerfCounter()
+                                    ^ (uint64_t)(uintptr_t)&alloc) | 1;
+        tracemalloc_bytes_until_sample = sampling_next_interval();
+    }
+
 #ifdef TRACE_RAW_MALLOC
     alloc.malloc = tracemalloc_raw_malloc;
     alloc.calloc = tracemalloc_raw_calloc;
@@ -972,6 +1132,8 @@ _PyTraceMalloc_Stop(void)
     /* release memory */
     raw_free(tracemalloc_traceback);
     tracemalloc_traceback = NULL;
+    raw_free(tracemalloc_sampled_filter);
+    tracemalloc_sampled_filter = NULL;
 }
 
 
@@ -1515,6 +1677,15 @@ int _PyTraceMalloc_GetTracebackLimit(void) {
     return tracemalloc_config.max_nframe;
 }
 
+size_t
+_PyTraceMalloc_GetSamplingInterval(void)
+{
+    if (!tracemalloc_config.tracing) {
+        return 0;
+    }
+    return tracemalloc_config.sampling_interval;
+}
+
 size_t
 _PyTraceMalloc_GetMemory(void) {
 
@@ -516,9 +516,11 @@ def get_keys_values(self):
         if (int(char_ptr) & 1) == 0:
             return None
         char_ptr += 1
+        # The values may have fewer slots than the keys have entries
+        capacity = int((char_ptr - 3).dereference()) & 0xff
         values_ptr = char_ptr.cast(gdb.lookup_type("PyDictValues").pointer())
         values = values_ptr['values']
-        return PyKeysValuesPair(self.get_cached_keys(), values)
+        return PyKeysValuesPair(self.get_cached_keys(), values, capacity)
 
     def get_cached_keys(self):
         typeobj = self.type()
@@ -732,8 +734,10 @@ def addr2line(self, addrq):
         assert False, "Unreachable"
 
 
-def items_from_keys_and_values(keys, values):
+def items_from_keys_and_values(keys, values, capacity=None):
     entries, nentries = PyDictObjectPtr._get_entries(keys)
+    if capacity is not None:
+        nentries = min(nentries, capacity)
     for i in safe_range(nentries):
         ep = entries[i]
         pyop_value = PyObjectPtr.from_pyobject_ptr(values[i])
@@ -743,12 +747,14 @@ def items_from_keys_and_values(keys, values):
 
 class PyKeysValuesPair:
 
-    def __init__(self, keys, values):
+    def __init__(self, keys, values, capacity):
         self.keys = keys
         self.values = values
+        self.capacity = capacity
 
     def iteritems(self):
-        return items_from_keys_and_values(self.keys, self.values)
+        return items_from_keys_and_values(self.keys, self.values,
+                                          self.capacity)
 
     def proxyval(self, visited):
         result = {}
@@ -774,9 +780,11 @@ def iteritems(self):
         values = self.field('ma_values')
         has_values = int(values)
         if has_values:
+            char_ptr = values.cast(_type_unsigned_char_ptr())
+            capacity = int((char_ptr - 3).dereference())
             values = values['values']
         if has_values:
-            for item in items_from_keys_and_values(keys, values):
+            for item in items_from_keys_and_values(keys, values, capacity):
                 yield item
             return
         entries, nentries = self._get_entries(keys)
@@ -0,0 +1,60 @@
+'Measure the cost of creating short-lived generators and await chains.'
+
+# Every call of a generator or coroutine function allocates a new object
+# embedding the callee's frame.  This script times workloads dominated by
+# those allocations, e.g. to compare builds with and without the
+# generator freelists (configure --without-freelists).
+
+import asyncio
+from timeit import Timer
+
+loops = 1000
+depth = 10
+
+def small_gen():
+    yield 1
+
+def large_gen(a=0, b=1, c=2, d=3, e=4, f=5, g=6, h=7, i=8, j=9):
+    x = a + b + c + d + e
+    y = f + g + h + i + j
+    yield x + y
+
+def create_generators(loops=loops):
+    for _ in range(loops):
+        for _ in small_gen():
+            pass
+        for _ in large_gen():
+            pass
+
+async def leaf():
+    return 1
+
+async def chain(n):
+    if n:
+        return await chain(n - 1) + 1
+    return await leaf()
+
+def await_chain(loops=loops, depth=depth):
+    # Drive the chain by hand so the event loop is not part of the timing.
+    for _ in range(loops):
+        coro = chain(depth)
+        try:
+            coro.send(None)
+        except StopIteration:
+            pass
+
+async def gather_chains(loops=loops, depth=depth):
+    await asyncio.gather(*[chain(depth) for _ in range(loops)])
+
+def event_loop_chains(loops=loops, depth=depth):
+    asyncio.run(gather_chains(loops, depth))
+
+
+if __name__ == '__main__':
+    for f, per_call in [
+            (create_generators, 2),
+            (await_chain, depth + 2),
+            (event_loop_chains, depth + 2)]:
+        timing = min(Timer(f).repeat(7, 10))
+        timing *= 1e9 / (10 * loops * per_call)
+        print('{:6.1f} ns per generator\t{}'.format(timing, f.__name__))
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""Measure the time of lookups in str-keyed dicts of various sizes.
+
+For every size, builds a dict of that many str keys and times three kinds
+of lookups, in a random order:
+
+    hit    the keys themselves
+    equal  equal strings which are distinct objects, so that they are
+           compared character by character
+    miss   strings which are not in the dict
+
+and prints the time per lookup in nanoseconds.  Run it with two interpreters
+to compare them, for example:
+
+    ./python Tools/scripts/dict_lookup_benchmark.py
+    ./python Tools/scripts/dict_lookup_benchmark.py --sizes 1000000 4000000
+"""
+
+import argparse
+import collections
+import random
+import time
+
+
+def make_keys(n, prefix):
+    return [f'{prefix}{i:x}.symbol' for i in range(n)]
+
+
+def copy_str(s):
+    # Concatenation and slicing build a new object, equal to s.
+    return (s + '.')[:-1]
+
+
+def bench(d, probes, repeat):
+    lookup = d.get
+    best = float('inf')
+    for _ in range(repeat):
+        t0 = time.perf_counter()
+        collections.deque(map(lookup, probes), maxlen=0)
+        best = min(best, time.perf_counter() - t0)
+    return best / len(probes) * 1e9
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--sizes', type=int, nargs='+',
+                        default=[1_000, 10_000, 100_000, 1_000_000, 4_000_000],
+                        help='numbers of keys of the dicts '
+                             '(default: %(default)s)')
+    parser.add_argument('--lookups', type=int, default=1_000_000,
+                        help='number of lookups of each kind '
+                             '(default: %(default)s)')
+    parser.add_argument('--repeat', type=int, default=5,
+                        help='keep the best of REPEAT runs '
+                             '(default: %(default)s)')
+    parser.add_argument('--seed', type=int, default=0,
+                        help='seed of the random order of the lookups '
+                             '(default: %(default)s)')
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    print(f'{"size":>10}  {"hit":>8}  {"equal":>8}  {"miss":>8}  (ns/lookup)')
+    for n in args.sizes:
+        keys = make_keys(n, 'k')
+        d = dict.fromkeys(keys, 0)
+        hits = rng.choices(keys, k=args.lookups)
+        equal = [copy_str(k) for k in hits]
+        misses = rng.choices(make_keys(n, 'm'), k=args.lookups)
+        for s in equal + misses:
+            hash(s)
+        times = [bench(d, probes, args.repeat)
+                 for probes in (hits, equal, misses)]
+        print(f'{n:>10}  ' + '  '.join(f'{t:8.1f}' for t in times))
+        del keys, d, hits, equal, misses
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+"""Measure the memory used by a dict of small tuples.
+
+Builds a dict mapping ints to small tuples of an int, a float and a str,
+and reports the memory it uses, as traced by tracemalloc and as measured
+by the growth of the resident set size, per entry.  Run it with two
+interpreters to compare them, for example to see the effect of the size of
+the object header:
+
+    ./python Tools/scripts/dict_memory_benchmark.py -n 1000000
+"""
+
+import argparse
+import gc
+import os
+import sys
+import tracemalloc
+
+
+def rss():
+    try:
+        with open('/proc/self/statm') as f:
+            return int(f.read().split()[1]) * os.sysconf('SC_PAGE_SIZE')
+    except OSError:
+        return None
+
+
+def build(n):
+    return {i: (i, float(i), str(i)) for i in range(n)}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--entries', type=int, default=1_000_000,
+                        help='number of entries of the dict '
+                             '(default: %(default)s)')
+    args = parser.parse_args()
+    n = args.entries
+
+    gc.collect()
+    rss_before = rss()
+    data = build(n)
+    rss_after = rss()
+    del data
+
+    tracemalloc.start()
+    data = build(n)
+    traced = tracemalloc.get_traced_memory()[0]
+    tracemalloc.stop()
+
+    print(f'{sys.version.split()[0]}: object header of '
+          f'{object.__basicsize__} bytes, {n:,} entries')
+    print(f'traced memory: {traced / 2**20:.1f} MiB, '
+          f'{traced / n:.1f} bytes per entry')
+    if rss_before is not None:
+        grown = rss_after - rss_before
+        print(f'RSS growth:    {grown / 2**20:.1f} MiB, '
+              f'{grown / n:.1f} bytes per entry')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Measure the memory that forked children stop sharing with their parent.
+
+Builds a heap of objects in the parent, forks children that read every
+object and run a full collection, and reports how much of the memory they
+share with the parent each child has copied on write, as the growth of its
+private dirty memory (Linux only).  Compare the ways to prepare the heap
+before forking:
+
+    ./python Tools/scripts/fork_cow_benchmark.py --mode freeze
+    ./python Tools/scripts/fork_cow_benchmark.py --mode immortalize
+
+The modes are:
+
+    none         fork without calling gc.freeze()
+    freeze       call gc.freeze() before forking
+    immortalize  call gc.freeze(immortalize=True) before forking
+"""
+
+import argparse
+import gc
+import os
+import statistics
+import sys
+import time
+
+
+class Node:
+    __slots__ = ('ref', 'name', 'value')
+
+
+def build_heap(n):
+    nodes = [Node() for i in range(n)]
+    for i, node in enumerate(nodes):
+        node.ref = nodes[(i * 7919) % n]
+        node.name = f'node-{i}'
+        node.value = i * 1000003
+    return nodes
+
+
+def private_dirty():
+    """Return the private dirty memory of the process in bytes."""
+    with open('/proc/self/smaps_rollup') as f:
+        for line in f:
+            if line.startswith('Private_Dirty:'):
+                return int(line.split()[1]) * 1024
+    raise RuntimeError('no Private_Dirty in /proc/self/smaps_rollup')
+
+
+def child(heap, wfd):
+    before = private_dirty()
+    for node in heap:
+        node.ref, node.name, node.value
+    gc.enable()
+    gc.collect()
+    after = private_dirty()
+    os.write(wfd, str(after - before).encode())
+    os._exit(0)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--objects', type=int, default=1_000_000,
+                        help='number of objects in the heap '
+                             '(default: %(default)s)')
+    parser.add_argument('--mode', default='freeze',
+                        choices=('none', 'freeze', 'immortalize'),
+                        help='how to prepare the heap before forking '
+                             '(default: %(default)s)')
+    parser.add_argument('-r', '--repeat', type=int, default=5,
+                        help='number of children to fork '
+                             '(default: %(default)s)')
+    args = parser.parse_args()
+
+    if not os.path.exists('/proc/self/smaps_rollup'):
+        sys.exit('this benchmark needs /proc/self/smaps_rollup (Linux)')
+
+    gc.disable()
+    t0 = time.perf_counter()
+    heap = build_heap(args.objects)
+    print(f'built {len(heap):,} objects in {time.perf_counter() - t0:.1f}s')
+    if args.mode == 'freeze':
+        gc.freeze()
+    elif args.mode == 'immortalize':
+        gc.freeze(immortalize=True)
+
+    growth = []
+    for i in range(args.repeat):
+        rfd, wfd = os.pipe()
+        pid = os.fork()
+        if pid == 0:
+            os.close(rfd)
+            child(heap, wfd)
+        os.close(wfd)
+        with os.fdopen(rfd, 'rb') as f:
+            growth.append(int(f.read()))
+        os.waitpid(pid, 0)
+
+    print(f'{sys.version.split()[0]} ({args.mode}): private memory growth '
+          f'per child min {min(growth) / 2**20:.1f} MiB, '
+          f'median {statistics.median(growth) / 2**20:.1f} MiB, '
+          f'{statistics.median(growth) / len(heap):.1f} bytes per object')
+
+
+if __name__ == '__main__':
+    main()
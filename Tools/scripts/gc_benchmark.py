@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""Measure the time of full garbage collections of a large heap.
+
+Builds a heap of small container objects and times gc.collect() on it.
+Run it with two interpreters to compare them, for example before and after
+a change to the collector:
+
+    ./python Tools/scripts/gc_benchmark.py -n 10000000 --shape random
+
+The shapes of heap are:
+
+    chain       every object refers to the next one allocated
+    random      every object refers to an object chosen at random
+    fragmented  like random, but the objects are allocated in the holes
+                left by freeing a random half of a heap twice as large, so
+                that the order of the collector's lists doesn't follow
+                the order of the objects in memory
+"""
+
+import argparse
+import gc
+import random
+import statistics
+import sys
+import time
+
+
+class Node:
+    __slots__ = ('ref',)
+
+
+def build_heap(n, shape, rng):
+    if shape == 'fragmented':
+        holes = [Node() for i in range(2 * n)]
+        rng.shuffle(holes)
+        del holes[n:]
+        nodes = [Node() for i in range(n)]
+        del holes
+    else:
+        nodes = [Node() for i in range(n)]
+    if shape == 'chain':
+        for i in range(n - 1):
+            nodes[i].ref = nodes[i + 1]
+    else:
+        for node in nodes:
+            node.ref = nodes[rng.randrange(n)]
+    return nodes
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--objects', type=int, default=10_000_000,
+                        help='number of objects in the heap '
+                             '(default: %(default)s)')
+    parser.add_argument('--shape', default='random',
+                        choices=('chain', 'random', 'fragmented'),
+                        help='shape of the heap (default: %(default)s)')
+    parser.add_argument('-r', '--repeat', type=int, default=5,
+                        help='number of collections to time '
+                             '(default: %(default)s)')
+    parser.add_argument('--seed', type=int, default=0,
+                        help='seed of the random heap (default: %(default)s)')
+    args = parser.parse_args()
+
+    gc.disable()
+    t0 = time.perf_counter()
+    heap = build_heap(args.objects, args.shape, random.Random(args.seed))
+    print(f'built {len(heap):,} objects ({args.shape}) '
+          f'in {time.perf_counter() - t0:.1f}s')
+
+    # Move the heap to the oldest generation
+    gc.collect()
+    times = []
+    for i in range(args.repeat):
+        t0 = time.perf_counter()
+        gc.collect()
+        times.append(time.perf_counter() - t0)
+
+    print(f'{sys.version.split()[0]}: full collection '
+          f'min {min(times) * 1e3:.1f} ms, '
+          f'median {statistics.median(times) * 1e3:.1f} ms, '
+          f'{min(times) / len(heap) * 1e9:.1f} ns per object')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""Measure the time of arithmetic on large ints of various sizes.
+
+For every size, given as a number of decimal digits, times:
+
+    mul     the product of two ints of that size
+    square  the square of an int of that size
+    divmod  divmod() of an int of twice that size by one of that size
+    str     the conversion of an int of that size to a decimal string
+    int     the conversion of a decimal string of that size to an int
+
+and prints the best time of each in milliseconds.  The limit on the
+number of digits of int <-> str conversions is lifted.  Run it with two
+interpreters to compare them, for example:
+
+    ./python Tools/scripts/int_arith_benchmark.py
+    ./python Tools/scripts/int_arith_benchmark.py --sizes 1000000 10000000
+"""
+
+import argparse
+import random
+import sys
+import time
+
+
+def bench(func, args, repeat, budget):
+    best = float('inf')
+    total = 0.0
+    for _ in range(repeat):
+        t0 = time.perf_counter()
+        func(*args)
+        t = time.perf_counter() - t0
+        best = min(best, t)
+        total += t
+        if total > budget:
+            break
+    return best * 1e3
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--sizes', type=int, nargs='+',
+                        default=[1_000, 10_000, 100_000, 1_000_000],
+                        help='numbers of decimal digits of the ints '
+                             '(default: %(default)s)')
+    parser.add_argument('--repeat', type=int, default=5,
+                        help='keep the best of up to REPEAT runs '
+                             '(default: %(default)s)')
+    parser.add_argument('--budget', type=float, default=10.0,
+                        help='stop repeating a measurement after BUDGET '
+                             'seconds (default: %(default)s)')
+    parser.add_argument('--seed', type=int, default=0,
+                        help='seed of the random ints (default: %(default)s)')
+    args = parser.parse_args()
+
+    sys.set_int_max_str_digits(0)
+    rng = random.Random(args.seed)
+    ops = {
+        'mul': lambda x, y, z, s: x * y,
+        'square': lambda x, y, z, s: x * x,
+        'divmod': lambda x, y, z, s: divmod(z, y),
+        'str': lambda x, y, z, s: str(x),
+        'int': lambda x, y, z, s: int(s),
+    }
+    print(f'{"digits":>10}  ' + '  '.join(f'{op:>10}' for op in ops)
+          + '  (ms)')
+    for n in args.sizes:
+        bits = int(n * 3.3219280948873626)
+        x = rng.getrandbits(bits) | (1 << (bits - 1))
+        y = rng.getrandbits(bits) | (1 << (bits - 1))
+        z = x * y + rng.getrandbits(bits)
+        s = str(x)
+        times = [bench(op, (x, y, z, s), args.repeat, args.budget)
+                 for op in ops.values()]
+        print(f'{n:>10}  ' + '  '.join(f'{t:10.2f}' for t in times))
+
+
+if __name__ == '__main__':
+    main()
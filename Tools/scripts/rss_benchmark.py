@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""Measure the resident memory of a spike-and-idle workload over time.
+
+Every spike allocates many small objects and then frees most of them,
+keeping one object in every --keep alive, so that no pymalloc arena becomes
+wholly free and can be unmapped.  Between two spikes the process idles.
+The resident set size is sampled all along and printed as a table, to be
+compared between two interpreters or allocator settings, for example:
+
+    ./python Tools/scripts/rss_benchmark.py
+    PYTHONMALLOCHUGEPAGES=1 ./python Tools/scripts/rss_benchmark.py
+    PYTHONMALLOC=malloc ./python Tools/scripts/rss_benchmark.py
+
+Only Linux is supported: the resident set size is read from /proc.
+"""
+
+import argparse
+import os
+import sys
+import time
+
+
+PAGE_SIZE = os.sysconf('SC_PAGE_SIZE')
+
+
+def rss():
+    with open('/proc/self/statm') as f:
+        return int(f.read().split()[1]) * PAGE_SIZE
+
+
+def spike(n, keep, survivors):
+    objects = [(i, [i]) for i in range(n)]
+    survivors.extend(objects[::keep])
+    size = rss()
+    del objects
+    return size
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--objects', type=int, default=2_000_000,
+                        help='number of objects allocated by every spike '
+                             '(default: %(default)s)')
+    parser.add_argument('--keep', type=int, default=5000,
+                        help='keep one object in KEEP alive after every '
+                             'spike (default: %(default)s)')
+    parser.add_argument('--spikes', type=int, default=3,
+                        help='number of spikes (default: %(default)s)')
+    parser.add_argument('--idle', type=float, default=1.0,
+                        help='seconds of idling after every spike '
+                             '(default: %(default)s)')
+    parser.add_argument('--interval', type=float, default=0.25,
+                        help='seconds between two samples '
+                             '(default: %(default)s)')
+    args = parser.parse_args()
+
+    start = time.perf_counter()
+    samples = [(0.0, 'start', rss())]
+    survivors = []
+    peak = 0
+    for i in range(args.spikes):
+        peak = max(peak, spike(args.objects, args.keep, survivors))
+        samples.append((time.perf_counter() - start, f'spike {i + 1}', rss()))
+        deadline = time.perf_counter() + args.idle
+        while time.perf_counter() < deadline:
+            time.sleep(args.interval)
+            samples.append((time.perf_counter() - start, 'idle', rss()))
+
+    print(f'{sys.version.split()[0]}: {args.spikes} spikes of '
+          f'{args.objects:,} objects, {len(survivors):,} kept')
+    print('  time  phase      RSS (MiB)')
+    for t, phase, size in samples:
+        print(f'{t:6.2f}  {phase:<9} {size / 2**20:10.1f}')
+    print(f'peak RSS during spikes: {peak / 2**20:.1f} MiB, '
+          f'final RSS: {samples[-1][2] / 2**20:.1f} MiB')
+
+
+if __name__ == '__main__':
+    main()
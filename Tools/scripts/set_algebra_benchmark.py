@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""Measure the time of set algebra and construction on large sets.
+
+Builds two sets of SIZE ints or strs that share half of their elements
+(the second one holds equal copies, not the same objects) and a dict with
+the keys of the first, then times:
+
+    and       a & b
+    sub       a - b
+    xor       a ^ b
+    or        a | b
+    le        a[:SIZE/2] <= a
+    fromlist  set(list)
+    fromdict  set(dict)
+    fromkeys  set(dict.keys())
+    andkeys   a.intersection(dict.keys())
+    subkeys   a.difference(dict.keys())
+
+and prints the best time of each in milliseconds.  Run it with two
+interpreters to compare them, for example:
+
+    ./python Tools/scripts/set_algebra_benchmark.py
+    ./python Tools/scripts/set_algebra_benchmark.py --kind str --sizes 10000
+"""
+
+import argparse
+import random
+import time
+
+
+def bench(func, repeat):
+    best = float('inf')
+    for _ in range(repeat):
+        t0 = time.perf_counter()
+        func()
+        best = min(best, time.perf_counter() - t0)
+    return best * 1e3
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--sizes', type=int, nargs='+',
+                        default=[10_000, 100_000, 1_000_000],
+                        help='numbers of elements of the sets '
+                             '(default: %(default)s)')
+    parser.add_argument('--kind', choices=['int', 'str'], default='int',
+                        help='type of the elements (default: %(default)s)')
+    parser.add_argument('--repeat', type=int, default=7,
+                        help='keep the best of REPEAT runs '
+                             '(default: %(default)s)')
+    parser.add_argument('--seed', type=int, default=0,
+                        help='seed of the random elements '
+                             '(default: %(default)s)')
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    if args.kind == 'int':
+        make = lambda: rng.getrandbits(62)
+        copy = lambda x: x + 1 - 1
+    else:
+        make = lambda: f'k{rng.getrandbits(62):x}'
+        copy = lambda x: x[:1] + x[1:]
+    ops = ['and', 'sub', 'xor', 'or', 'le', 'fromlist', 'fromdict',
+           'fromkeys', 'andkeys', 'subkeys']
+    print(f'{"size":>10}  ' + '  '.join(f'{op:>8}' for op in ops) + '  (ms)')
+    for n in args.sizes:
+        pool = list({make() for _ in range(2 * n)})
+        a = set(pool[:n])
+        b = set(map(copy, pool[n // 2:n + n // 2]))
+        half = set(map(copy, pool[:n // 2]))
+        items = pool[:n]
+        d = dict.fromkeys(map(copy, pool[n // 2:n + n // 2]))
+        funcs = [lambda: a & b, lambda: a - b, lambda: a ^ b,
+                 lambda: a | b, lambda: half <= a, lambda: set(items),
+                 lambda: set(d), lambda: set(d.keys()),
+                 lambda: a.intersection(d.keys()),
+                 lambda: a.difference(d.keys())]
+        times = [bench(func, args.repeat) for func in funcs]
+        print(f'{n:>10}  ' + '  '.join(f'{t:8.2f}' for t in times))
+
+
+if __name__ == '__main__':
+    main()
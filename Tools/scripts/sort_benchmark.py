@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""Measure the time of list.sort() on large lists of various kinds.
+
+For every size, sorts lists of:
+
+    int     ints below 2**30 in absolute value
+    float   floats
+    str     short ASCII strs
+    key     (str, int) records by their str, with key=itemgetter(0)
+
+in the shapes:
+
+    random  random order
+    noisy   sorted, then a tenth of the items replaced at random
+    runs    eight sorted runs
+
+and prints the best time of each in milliseconds.  Run it with two
+interpreters to compare them, for example:
+
+    ./python Tools/scripts/sort_benchmark.py
+    ./python Tools/scripts/sort_benchmark.py --sizes 10000000 --kinds int
+"""
+
+import argparse
+import random
+import time
+from operator import itemgetter
+
+
+def make_list(kind, shape, n, rng):
+    if kind == 'int':
+        item = lambda: rng.randrange(-1 << 29, 1 << 29)
+    elif kind == 'float':
+        item = rng.random
+    else:
+        alphabet = 'abcdefghijklmnopqrstuvwxyz'
+        word = lambda: ''.join(rng.choices(alphabet, k=rng.randrange(4, 12)))
+        if kind == 'str':
+            item = word
+        else:
+            item = lambda: (word(), rng.randrange(n))
+    L = [item() for _ in range(n)]
+    if shape == 'noisy':
+        L.sort()
+        for _ in range(n // 10):
+            L[rng.randrange(n)] = item()
+    elif shape == 'runs':
+        k = -(-n // 8)
+        L = [x for i in range(0, n, k) for x in sorted(L[i:i + k])]
+    return L
+
+
+def bench(L, kwargs, repeat):
+    best = float('inf')
+    for _ in range(repeat):
+        copy = L[:]
+        t0 = time.perf_counter()
+        copy.sort(**kwargs)
+        best = min(best, time.perf_counter() - t0)
+    return best * 1e3
+
+
+def main():
+    kinds = ['int', 'float', 'str', 'key']
+    shapes = ['random', 'noisy', 'runs']
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--sizes', type=int, nargs='+',
+                        default=[1_000, 100_000, 1_000_000],
+                        help='numbers of items of the lists '
+                             '(default: %(default)s)')
+    parser.add_argument('--kinds', choices=kinds, nargs='+', default=kinds,
+                        help='kinds of items (default: all)')
+    parser.add_argument('--repeat', type=int, default=5,
+                        help='keep the best of REPEAT runs '
+                             '(default: %(default)s)')
+    parser.add_argument('--seed', type=int, default=0,
+                        help='seed of the random items (default: %(default)s)')
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    print(f'{"kind":>6} {"size":>10}  '
+          + '  '.join(f'{shape:>10}' for shape in shapes) + '  (ms)')
+    for kind in args.kinds:
+        kwargs = {'key': itemgetter(0)} if kind == 'key' else {}
+        for n in args.sizes:
+            times = [bench(make_list(kind, shape, n, rng), kwargs, args.repeat)
+                     for shape in shapes]
+            print(f'{kind:>6} {n:>10}  '
+                  + '  '.join(f'{t:10.2f}' for t in times))
+
+
+if __name__ == '__main__':
+    main()
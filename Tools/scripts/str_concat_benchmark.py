@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Measure the time of building a str with repeated += in various holders.
+
+For every number of appends, times `buf += piece` where buf is:
+
+    local   a local variable
+    attr    an attribute of an instance
+    slot    a __slots__ attribute of an instance
+    dict    the value of a str key in a dict
+    list    the last item of a list, indexed with -1
+
+and prints the best time of each in milliseconds.  Appends which copy the
+whole string every time make the times grow quadratically with the number
+of appends, instead of linearly.  Run it with two interpreters to compare
+them, for example:
+
+    ./python Tools/scripts/str_concat_benchmark.py
+    ./python Tools/scripts/str_concat_benchmark.py --counts 1000000
+"""
+
+import argparse
+import time
+
+
+class Instance:
+    def __init__(self):
+        self.buf = ''
+
+
+class Slots:
+    __slots__ = ('buf',)
+
+    def __init__(self):
+        self.buf = ''
+
+
+def concat_local(n, piece):
+    buf = ''
+    for _ in range(n):
+        buf += piece
+    return buf
+
+
+def concat_attr(n, piece, cls=Instance):
+    obj = cls()
+    for _ in range(n):
+        obj.buf += piece
+    return obj.buf
+
+
+def concat_slot(n, piece):
+    return concat_attr(n, piece, Slots)
+
+
+def concat_dict(n, piece):
+    d = {'buf': ''}
+    for _ in range(n):
+        d['buf'] += piece
+    return d['buf']
+
+
+def concat_list(n, piece):
+    parts = ['']
+    for _ in range(n):
+        parts[-1] += piece
+    return parts[-1]
+
+
+def bench(func, args, repeat, budget):
+    best = float('inf')
+    total = 0.0
+    for _ in range(repeat):
+        t0 = time.perf_counter()
+        func(*args)
+        t = time.perf_counter() - t0
+        best = min(best, t)
+        total += t
+        if total > budget:
+            break
+    return best * 1e3
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--counts', type=int, nargs='+',
+                        default=[10_000, 100_000],
+                        help='numbers of appends (default: %(default)s)')
+    parser.add_argument('--piece', default='abcdefgh',
+                        help='the str appended (default: %(default)r)')
+    parser.add_argument('--repeat', type=int, default=5,
+                        help='keep the best of up to REPEAT runs '
+                             '(default: %(default)s)')
+    parser.add_argument('--budget', type=float, default=10.0,
+                        help='stop repeating a measurement after BUDGET '
+                             'seconds (default: %(default)s)')
+    args = parser.parse_args()
+
+    holders = {
+        'local': concat_local,
+        'attr': concat_attr,
+        'slot': concat_slot,
+        'dict': concat_dict,
+        'list': concat_list,
+    }
+    print(f'{"appends":>10}  ' + '  '.join(f'{h:>10}' for h in holders)
+          + '  (ms)')
+    for n in args.counts:
+        times = [bench(func, (n, args.piece), args.repeat, args.budget)
+                 for func in holders.values()]
+        print(f'{n:>10}  ' + '  '.join(f'{t:10.2f}' for t in times))
+
+
+if __name__ == '__main__':
+    main()
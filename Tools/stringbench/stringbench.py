@@ -1354,6 +1354,280 @@ def format_with_dict(STR):
         s % d
 
 
+#### UTF-8 codec on mixed-script text
+
+# Each corpus is about 16 KB of UTF-8, mixing ASCII with the characters of
+# one script, as in the text fields of network payloads.
+_utf8_corpora = {
+    "latin1": (u"L'\u00e9t\u00e9 dernier, nous sommes all\u00e9s \u00e0 "
+               u"la f\u00eate du ch\u00e2teau \u00e0 M\u00fcnchen. "),
+    "cyrillic": (u"\u0412 \u0447\u0430\u0449\u0430\u0445 \u044e\u0433"
+                 u"\u0430 \u0436\u0438\u043b \u0431\u044b "
+                 u"\u0446\u0438\u0442\u0440\u0443\u0441? \u0414\u0430, "
+                 u"\u043d\u043e \u0444\u0430\u043b\u044c\u0448"
+                 u"\u0438\u0432\u044b\u0439 "
+                 u"\u044d\u043a\u0437\u0435\u043c\u043f\u043b\u044f"
+                 u"\u0440! "),
+    "cjk": (u"\u6771\u4eac\u90fd\u306f\u65e5\u672c\u306e\u9996"
+            u"\u90fd\u3067\u3059\u3002 Tokyo 2020, "
+            u"\u4eba\u53e3\u306f\u7d041400\u4e07\u4eba\u3002 "),
+    "json": (u'{"id": 12345, "name": "\u041c\u0430\u0440\u0438\u044f", '
+             u'"city": "M\u00fcnchen", "tag": "\u6771\u4eac"}, '),
+    "emoji": (u"ok \U0001f600 great \U0001f44d see you \U0001f30d! "),
+}
+
+def _get_utf8_text(STR, name):
+    if STR is BYTES:
+        raise UnsupportedType
+    text = _utf8_corpora[name]
+    return text * (16 * 1024 // len(text.encode("utf-8")))
+
+@bench('latin1_text.encode("utf-8").decode("utf-8")', 'UTF-8 decode', 100)
+def utf8_decode_latin1(STR):
+    b = _get_utf8_text(STR, "latin1").encode("utf-8")
+    for x in _RANGE_100:
+        b.decode("utf-8")
+
+@bench('cyrillic_text.encode("utf-8").decode("utf-8")', 'UTF-8 decode', 100)
+def utf8_decode_cyrillic(STR):
+    b = _get_utf8_text(STR, "cyrillic").encode("utf-8")
+    for x in _RANGE_100:
+        b.decode("utf-8")
+
+@bench('cjk_text.encode("utf-8").decode("utf-8")', 'UTF-8 decode', 100)
+def utf8_decode_cjk(STR):
+    b = _get_utf8_text(STR, "cjk").encode("utf-8")
+    for x in _RANGE_100:
+        b.decode("utf-8")
+
+@bench('json_text.encode("utf-8").decode("utf-8")', 'UTF-8 decode', 100)
+def utf8_decode_json(STR):
+    b = _get_utf8_text(STR, "json").encode("utf-8")
+    for x in _RANGE_100:
+        b.decode("utf-8")
+
+@bench('emoji_text.encode("utf-8").decode("utf-8")', 'UTF-8 decode', 100)
+def utf8_decode_emoji(STR):
+    b = _get_utf8_text(STR, "emoji").encode("utf-8")
+    for x in _RANGE_100:
+        b.decode("utf-8")
+
+@bench('latin1_text.encode("utf-8")', 'UTF-8 encode', 100)
+def utf8_encode_latin1(STR):
+    s = _get_utf8_text(STR, "latin1")
+    for x in _RANGE_100:
+        s.encode("utf-8")
+
+@bench('cyrillic_text.encode("utf-8")', 'UTF-8 encode', 100)
+def utf8_encode_cyrillic(STR):
+    s = _get_utf8_text(STR, "cyrillic")
+    for x in _RANGE_100:
+        s.encode("utf-8")
+
+@bench('cjk_text.encode("utf-8")', 'UTF-8 encode', 100)
+def utf8_encode_cjk(STR):
+    s = _get_utf8_text(STR, "cjk")
+    for x in _RANGE_100:
+        s.encode("utf-8")
+
+@bench('json_text.encode("utf-8")', 'UTF-8 encode', 100)
+def utf8_encode_json(STR):
+    s = _get_utf8_text(STR, "json")
+    for x in _RANGE_100:
+        s.encode("utf-8")
+
+@bench('emoji_text.encode("utf-8")', 'UTF-8 encode', 100)
+def utf8_encode_emoji(STR):
+    s = _get_utf8_text(STR, "emoji")
+    for x in _RANGE_100:
+        s.encode("utf-8")
+
+
+#### Short needles in long text of each kind
+
+# About 16K characters of prose, which one trailing character widens to
+# 2 or 4 bytes per character.  The needles of find() do not occur in it.
+_kind_widen = {"ucs1": u"", "ucs2": u"\u20ac", "ucs4": u"\U0001f600"}
+_kind_prose = (u"The quick brown fox jumps over the lazy dog while the "
+               u"cat watches from the window of the old stone house. ")
+
+def _get_kind_text(STR, kind):
+    if STR is BYTES and kind != "ucs1":
+        raise UnsupportedType
+    text = _kind_prose * (16 * 1024 // len(_kind_prose))
+    if STR is BYTES:
+        return text.encode("ascii")
+    return text + _kind_widen[kind]
+
+@bench('ucs1_text.find("zq")', "find 2 characters in long text", 100)
+def kind_find_2_ucs1(STR):
+    s = _get_kind_text(STR, "ucs1")
+    s_find = s.find
+    needle = STR("zq")
+    for x in _RANGE_100:
+        s_find(needle)
+
+@bench('ucs2_text.find("zq")', "find 2 characters in long text", 100)
+def kind_find_2_ucs2(STR):
+    s = _get_kind_text(STR, "ucs2")
+    s_find = s.find
+    needle = STR("zq")
+    for x in _RANGE_100:
+        s_find(needle)
+
+@bench('ucs4_text.find("zq")', "find 2 characters in long text", 100)
+def kind_find_2_ucs4(STR):
+    s = _get_kind_text(STR, "ucs4")
+    s_find = s.find
+    needle = STR("zq")
+    for x in _RANGE_100:
+        s_find(needle)
+
+@bench('ucs1_text.find("lazy cow")', "find 8 characters in long text", 100)
+def kind_find_8_ucs1(STR):
+    s = _get_kind_text(STR, "ucs1")
+    s_find = s.find
+    needle = STR("lazy cow")
+    for x in _RANGE_100:
+        s_find(needle)
+
+@bench('ucs2_text.find("lazy cow")', "find 8 characters in long text", 100)
+def kind_find_8_ucs2(STR):
+    s = _get_kind_text(STR, "ucs2")
+    s_find = s.find
+    needle = STR("lazy cow")
+    for x in _RANGE_100:
+        s_find(needle)
+
+@bench('ucs4_text.find("lazy cow")', "find 8 characters in long text", 100)
+def kind_find_8_ucs4(STR):
+    s = _get_kind_text(STR, "ucs4")
+    s_find = s.find
+    needle = STR("lazy cow")
+    for x in _RANGE_100:
+        s_find(needle)
+
+@bench('ucs1_text.find("the old stone house and the cow")', "find 31 characters in long text", 100)
+def kind_find_31_ucs1(STR):
+    s = _get_kind_text(STR, "ucs1")
+    s_find = s.find
+    needle = STR("the old stone house and the cow")
+    for x in _RANGE_100:
+        s_find(needle)
+
+@bench('ucs2_text.find("the old stone house and the cow")', "find 31 characters in long text", 100)
+def kind_find_31_ucs2(STR):
+    s = _get_kind_text(STR, "ucs2")
+    s_find = s.find
+    needle = STR("the old stone house and the cow")
+    for x in _RANGE_100:
+        s_find(needle)
+
+@bench('ucs4_text.find("the old stone house and the cow")', "find 31 characters in long text", 100)
+def kind_find_31_ucs4(STR):
+    s = _get_kind_text(STR, "ucs4")
+    s_find = s.find
+    needle = STR("the old stone house and the cow")
+    for x in _RANGE_100:
+        s_find(needle)
+
+@bench('ucs1_text.count("o")', "count 1 character in long text", 100)
+def kind_count_char_ucs1(STR):
+    s = _get_kind_text(STR, "ucs1")
+    s_count = s.count
+    needle = STR("o")
+    for x in _RANGE_100:
+        s_count(needle)
+
+@bench('ucs2_text.count("o")', "count 1 character in long text", 100)
+def kind_count_char_ucs2(STR):
+    s = _get_kind_text(STR, "ucs2")
+    s_count = s.count
+    needle = STR("o")
+    for x in _RANGE_100:
+        s_count(needle)
+
+@bench('ucs4_text.count("o")', "count 1 character in long text", 100)
+def kind_count_char_ucs4(STR):
+    s = _get_kind_text(STR, "ucs4")
+    s_count = s.count
+    needle = STR("o")
+    for x in _RANGE_100:
+        s_count(needle)
+
+@bench('ucs1_text.count("the")', "count 3 characters in long text", 100)
+def kind_count_word_ucs1(STR):
+    s = _get_kind_text(STR, "ucs1")
+    s_count = s.count
+    needle = STR("the")
+    for x in _RANGE_100:
+        s_count(needle)
+
+@bench('ucs2_text.count("the")', "count 3 characters in long text", 100)
+def kind_count_word_ucs2(STR):
+    s = _get_kind_text(STR, "ucs2")
+    s_count = s.count
+    needle = STR("the")
+    for x in _RANGE_100:
+        s_count(needle)
+
+@bench('ucs4_text.count("the")', "count 3 characters in long text", 100)
+def kind_count_word_ucs4(STR):
+    s = _get_kind_text(STR, "ucs4")
+    s_count = s.count
+    needle = STR("the")
+    for x in _RANGE_100:
+        s_count(needle)
+
+@bench('ucs1_text.split()', "split whitespace in long text", 100)
+def kind_split_ucs1(STR):
+    s = _get_kind_text(STR, "ucs1")
+    s_split = s.split
+    for x in _RANGE_100:
+        s_split()
+
+@bench('ucs2_text.split()', "split whitespace in long text", 100)
+def kind_split_ucs2(STR):
+    s = _get_kind_text(STR, "ucs2")
+    s_split = s.split
+    for x in _RANGE_100:
+        s_split()
+
+@bench('ucs4_text.split()', "split whitespace in long text", 100)
+def kind_split_ucs4(STR):
+    s = _get_kind_text(STR, "ucs4")
+    s_split = s.split
+    for x in _RANGE_100:
+        s_split()
+
+@bench('ucs1_text.replace("the", "a")', "replace 3 characters in long text", 100)
+def kind_replace_ucs1(STR):
+    s = _get_kind_text(STR, "ucs1")
+    s_replace = s.replace
+    from_str = STR("the")
+    to_str = STR("a")
+    for x in _RANGE_100:
+        s_replace(from_str, to_str)
+
+@bench('ucs2_text.replace("the", "a")', "replace 3 characters in long text", 100)
+def kind_replace_ucs2(STR):
+    s = _get_kind_text(STR, "ucs2")
+    s_replace = s.replace
+    from_str = STR("the")
+    to_str = STR("a")
+    for x in _RANGE_100:
+        s_replace(from_str, to_str)
+
+@bench('ucs4_text.replace("the", "a")', "replace 3 characters in long text", 100)
+def kind_replace_ucs4(STR):
+    s = _get_kind_text(STR, "ucs4")
+    s_replace = s.replace
+    from_str = STR("the")
+    to_str = STR("a")
+    for x in _RANGE_100:
+        s_replace(from_str, to_str)
+
+
 #### Upper- and lower- case conversion
 
 @bench('("Where in the world is Carmen San Deigo?"*10).lower()',